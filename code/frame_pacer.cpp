@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef __EMSCRIPTEN__
+#include <SDL2/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+#include "frame_pacer.h"
+
+//the main loop used to sleep on SDL_GetTicks() until a fixed 16ms had
+//passed, which stutters on any display that isn't exactly 62.5Hz
+//
+//now frames are paced on the high resolution clock against the ROM's
+//real VI rate (59.83Hz NTSC, 49.92Hz PAL). When vsync works and the
+//display refresh is a multiple of the VI rate (60, 120, 240Hz) we
+//present on every Nth vblank instead and let the swap do the waiting,
+//otherwise (144Hz, PAL on 60Hz, no vsync) we sleep to deadlines
+//
+//the browser can't sleep, it calls framePacerFramesDue() from
+//requestAnimationFrame instead, which makes the same choice but returns
+//how many frames to run on that display refresh
+
+#define VSYNC_TOLERANCE 0.02        //how far from N * VI rate the display may be
+#define VSYNC_CHECK_FRAMES 120      //frames between checks that the swap blocks
+#define MAX_FRAMES_BEHIND 4         //resync instead of catching up after a hitch
+#define REFRESH_SAMPLE_FRAMES 120   //display refreshes averaged to measure its rate
+#define REFRESH_MAX_INTERVAL 100.0  //ms, longer gaps are a hidden tab or a hitch
+
+static Uint64 counterFrequency;
+static bool vsyncAvailable;
+static bool freeRunning;
+static double targetRate = 60.0;
+static int hostRefreshRate;
+
+static FramePacerMode mode = FRAME_PACER_TIMED;
+static int vblanksPerFrame = 1;
+
+static Uint64 nextDeadline;
+static Uint64 lastPresent;
+static bool presentedSinceWait;
+
+//presents that came back much faster than the vblank interval
+static int shortPresents;
+static int checkedPresents;
+
+//requestAnimationFrame timestamps, in ms
+static double lastTimestamp;
+static double nextDeadlineMs;
+static double refreshTotalMs;
+static int refreshSamples;
+static int vblanksSinceFrame;
+
+static unsigned int histogram[FRAME_PACER_HISTOGRAM_BUCKETS];
+static unsigned int statFrames;
+static double statTotalMs;
+static double statMaxMs;
+
+static void chooseMode()
+{
+    if (freeRunning)
+    {
+        mode = FRAME_PACER_FREE;
+        return;
+    }
+
+    mode = FRAME_PACER_TIMED;
+    vblanksPerFrame = 1;
+
+    if (!vsyncAvailable || hostRefreshRate <= 0)
+        return;
+
+    double ratio = hostRefreshRate / targetRate;
+    int n = (int)(ratio + 0.5);
+    if (n >= 1 && fabs(ratio - n) <= VSYNC_TOLERANCE * n)
+    {
+        mode = FRAME_PACER_VSYNC;
+        vblanksPerFrame = n;
+    }
+}
+
+//SDL_Delay() for most of the wait, then spin for the last bit
+//since it only has millisecond granularity
+static void sleepUntil(Uint64 target)
+{
+    for (;;)
+    {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= target)
+            return;
+
+        Uint64 remainingMs = (target - now) * 1000 / counterFrequency;
+        if (remainingMs >= 2)
+            SDL_Delay((Uint32)(remainingMs - 1));
+    }
+}
+
+void framePacerInit(bool vsync, bool free)
+{
+    counterFrequency = SDL_GetPerformanceFrequency();
+    vsyncAvailable = vsync;
+    freeRunning = free;
+    nextDeadline = 0;
+    lastPresent = 0;
+    presentedSinceWait = false;
+    shortPresents = 0;
+    checkedPresents = 0;
+    lastTimestamp = 0.0;
+    nextDeadlineMs = 0.0;
+    refreshTotalMs = 0.0;
+    refreshSamples = 0;
+    vblanksSinceFrame = 0;
+    framePacerResetStats();
+    chooseMode();
+}
+
+void framePacerSetTargetRate(double rate)
+{
+    if (rate < 10.0 || rate > 100.0 || rate == targetRate)
+        return;
+
+    targetRate = rate;
+    chooseMode();
+}
+
+void framePacerSetHostRefreshRate(int rate)
+{
+    if (rate == hostRefreshRate)
+        return;
+
+    hostRefreshRate = rate;
+    chooseMode();
+}
+
+//call right after SDL_GL_SwapWindow()
+void framePacerFramePresented()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (lastPresent != 0)
+    {
+        double ms = (now - lastPresent) * 1000.0 / counterFrequency;
+        int bucket = (int)ms;
+        if (bucket >= FRAME_PACER_HISTOGRAM_BUCKETS)
+            bucket = FRAME_PACER_HISTOGRAM_BUCKETS - 1;
+        histogram[bucket]++;
+        statFrames++;
+        statTotalMs += ms;
+        if (ms > statMaxMs)
+            statMaxMs = ms;
+
+        //some drivers ignore the swap interval, go back to sleeping
+        //on the clock if the swaps don't wait for the vblank
+        if (mode == FRAME_PACER_VSYNC)
+        {
+            double vblankMs = 1000.0 / hostRefreshRate;
+            if (ms < vblankMs * 0.5)
+                shortPresents++;
+
+            if (++checkedPresents >= VSYNC_CHECK_FRAMES)
+            {
+                if (shortPresents > VSYNC_CHECK_FRAMES / 4)
+                {
+                    printf("frame pacer: swaps don't wait for vsync, using timed pacing\n");
+                    vsyncAvailable = false;
+                    chooseMode();
+                }
+                shortPresents = 0;
+                checkedPresents = 0;
+            }
+        }
+    }
+
+    lastPresent = now;
+    presentedSinceWait = true;
+}
+
+//call once per main loop iteration, waits until the next frame is due
+void framePacerWait()
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 period = (Uint64)(counterFrequency / targetRate);
+
+    if (mode == FRAME_PACER_VSYNC)
+    {
+        //with N > 1 sleep until half a vblank before the Nth one and let
+        //the swap wait for it, with N == 1 the swap already waited unless
+        //there was nothing to present
+        if (vblanksPerFrame > 1 || !presentedSinceWait)
+        {
+            Uint64 vblank = (Uint64)(counterFrequency / (double)hostRefreshRate);
+            sleepUntil(lastPresent + vblanksPerFrame * vblank - vblank / 2);
+        }
+        nextDeadline = SDL_GetPerformanceCounter();
+    }
+    else if (mode == FRAME_PACER_TIMED)
+    {
+        nextDeadline += period;
+        if (nextDeadline + MAX_FRAMES_BEHIND * period < now)
+            nextDeadline = now;
+        sleepUntil(nextDeadline);
+    }
+
+    presentedSinceWait = false;
+}
+
+//call from requestAnimationFrame with its timestamp, returns the number
+//of frames to run before the browser presents. The display rate is
+//measured from the timestamps since the browser doesn't report it
+int framePacerFramesDue(double timestampMs)
+{
+    double interval = lastTimestamp != 0.0 ? timestampMs - lastTimestamp : 0.0;
+    double period = 1000.0 / targetRate;
+    int frames = 0;
+
+    lastTimestamp = timestampMs;
+
+    if (interval > 0.0 && interval < REFRESH_MAX_INTERVAL)
+    {
+        refreshTotalMs += interval;
+        if (++refreshSamples >= REFRESH_SAMPLE_FRAMES)
+        {
+            framePacerSetHostRefreshRate((int)(1000.0 * refreshSamples / refreshTotalMs + 0.5));
+            refreshTotalMs = 0.0;
+            refreshSamples = 0;
+        }
+    }
+
+    if (mode == FRAME_PACER_FREE)
+        return 1;
+
+    if (mode == FRAME_PACER_VSYNC)
+    {
+        //one frame on every Nth refresh
+        if (++vblanksSinceFrame >= vblanksPerFrame)
+        {
+            vblanksSinceFrame = 0;
+            frames = 1;
+        }
+        nextDeadlineMs = timestampMs;
+        return frames;
+    }
+
+    //run the frames that are due by the middle of this refresh, so a
+    //deadline that lands close to a refresh doesn't flip between two
+    double due = timestampMs + (interval > 0.0 && interval < REFRESH_MAX_INTERVAL ? interval / 2 : 0.0);
+    if (nextDeadlineMs == 0.0 || nextDeadlineMs + MAX_FRAMES_BEHIND * period < due)
+        nextDeadlineMs = timestampMs;
+
+    while (nextDeadlineMs <= due && frames < MAX_FRAMES_BEHIND)
+    {
+        nextDeadlineMs += period;
+        frames++;
+    }
+
+    vblanksSinceFrame = 0;
+    return frames;
+}
+
+void framePacerGetStats(FramePacerStats* stats)
+{
+    stats->mode = mode;
+    stats->targetRate = targetRate;
+    stats->hostRefreshRate = hostRefreshRate;
+    stats->vblanksPerFrame = vblanksPerFrame;
+    stats->frames = statFrames;
+    stats->averageMs = statFrames ? statTotalMs / statFrames : 0.0;
+    stats->maxMs = statMaxMs;
+    memcpy(stats->histogram, histogram, sizeof(histogram));
+}
+
+void framePacerResetStats()
+{
+    memset(histogram, 0, sizeof(histogram));
+    statFrames = 0;
+    statTotalMs = 0.0;
+    statMaxMs = 0.0;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+//frame pacing for the main loop, driven by the emulated VI rate
+//and the refresh rate of the host display, see frame_pacer.cpp
+
+#define FRAME_PACER_HISTOGRAM_BUCKETS 50 //1ms each, the last one is 49ms and up
+
+enum FramePacerMode {
+    FRAME_PACER_FREE,   //host doesn't pace us (browser audio callback)
+    FRAME_PACER_TIMED,  //sleep to deadlines on the high resolution clock
+    FRAME_PACER_VSYNC,  //present on every Nth vblank of the host display
+};
+
+struct FramePacerStats {
+    FramePacerMode mode;
+    double targetRate;      //emulated VI rate in Hz
+    int hostRefreshRate;    //0 if unknown
+    int vblanksPerFrame;    //N in FRAME_PACER_VSYNC mode
+    unsigned int frames;
+    double averageMs;
+    double maxMs;
+    unsigned int histogram[FRAME_PACER_HISTOGRAM_BUCKETS];
+};
+
+void framePacerInit(bool vsync, bool free);
+void framePacerSetTargetRate(double rate);
+void framePacerSetHostRefreshRate(int rate);
+void framePacerFramePresented();
+void framePacerWait();
+int framePacerFramesDue(double timestampMs);
+void framePacerGetStats(FramePacerStats* stats);
+void framePacerResetStats();
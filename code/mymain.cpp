@@ -22,12 +22,15 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <vector>
+#include <unordered_map>
 
 extern "C" {
 #include "neil.h"
 }
 
 #include "neil_controller.h"
+#include "frame_pacer.h"
 
 #ifdef _WIN32
 #define USE_XINPUT //COMMENT OUT TO FALL BACK TO SDL JOYSTICK CODE (UNRELIABLE)
@@ -64,6 +67,14 @@ bool loadSra = false;
 bool loadFla = false;
 bool showFPS = true;
 bool swapSticks = false;
+bool softwareRenderer = false;
+int runAheadFrames = 0;
+int fastForwardSpeed = 4;
+bool fastForward = false;
+bool frameskip = false;
+bool textureCache = false;
+int displayListReplay = 0;
+bool viPipelined = false;
 
 void connectGamepad()
 {
@@ -160,9 +171,6 @@ TTF_Font* font24;
 TTF_Font* font40;
 SDL_Color fontcolorWhite = { 255, 255, 255 };
 SDL_Color fontcolorRed = { 0, 0, 255 }; //needs to be BGRA becuse of emscripten
-Uint32 frameStart, frameTime;
-const int FPS   = 60;
-const int DELAY = 1000.0f / FPS;
 int current_fps = 0;
 int current_fps_counter = 0;
 Uint32 current_frameStart;
@@ -172,6 +180,8 @@ float yLocation = 0.0f;
 unsigned int shaderProgram = 0;
 char* loadFile(char* filename);
 void limitFPS();
+void updateHostRefreshRate();
+extern "C" const char* neil_frame_pacing_stats();
 unsigned int initShaders();
 char rom_name[100];
 bool runApp = true;
@@ -179,6 +189,7 @@ int swapCount = 0;
 int audioDeviceId = 0;
 int vicount = 0;
 int currentSwapCount = 0;
+int currentSkippedFrames = 0;
 int audioBufferQueue = 0;
 int currentAudioBufferQueue = 0;
 int hadSkip = 0;
@@ -196,8 +207,14 @@ bool isReleasedOnce(bool condition, bool* lastPressedVar);
 GLuint imageOverlay;
 void setupDrawTextOpenGL();
 void drawTextOpenGL(const char* text, int x, int y, SDL_Color color, MY_FONT_SIZE fontsize);
+void flushTextOpenGL();
 void drawOpenglTexture(int x, int y, int w, int h, GLuint imageID);
 GLuint loadOpenGLTexture(const char*);
+void drawSoftwareFrame();
+GLuint softwareFrameTexture = 0;
+int softwareFrameTextureWidth = 0;
+int softwareFrameTextureHeight = 0;
+uint8_t* softwareFrameBuffer = NULL;
 unsigned int vertexBufferDrawText;
 float positionsDrawText[] = {
         -1.0f, -1.0f, 0.0f, 1.0f,
@@ -216,6 +233,42 @@ float positionsDrawTextFinal[] = {
         -1.0f, 1.0f, 0.0f, 0.0f,
 };
 
+//all the printable ascii glyphs of font24 and font40 are rendered
+//once into one atlas texture, text is then drawn as a batch of quads
+//so the overlay needs no texture uploads after startup
+#define TEXT_ATLAS_SIZE 512
+#define TEXT_FIRST_GLYPH 32
+#define TEXT_LAST_GLYPH 126
+#define TEXT_LAYOUT_CACHE_MAX 64
+
+struct TextGlyph {
+    float u0, v0, u1, v1;
+    int xoffset, w, h, advance;
+};
+
+//a run of quads in the text batch sharing one color
+struct TextRun {
+    float color[4];
+    int first;
+    int count;
+};
+
+GLuint textAtlasTexture = 0;
+GLint textColorLocation = -1;
+unsigned int vertexBufferText;
+TextGlyph textGlyphs[2][TEXT_LAST_GLYPH - TEXT_FIRST_GLYPH + 1];
+std::unordered_map<std::string, std::vector<float> > textLayoutCache[2];
+std::vector<float> textBatch;
+std::vector<float> textBatchUploaded;
+std::vector<TextRun> textRuns;
+
+//overlay cost, averaged over the last second
+Uint64 overlayTicks = 0;
+Uint64 currentOverlayTicks = 0;
+int overlayFrames = 0;
+int textUploads = 0;
+int currentTextUploads = 0;
+
 //gamepad
 int Joy_Mapping_Up = 0;
 int Joy_Mapping_Down = 0;
@@ -338,6 +391,61 @@ void readConfig()
                     swapSticks = false;
             }
 
+            //software renderer (angrylion)
+            if (counter == 31)
+            {
+                if (mapping == 1)
+                    softwareRenderer = true;
+                else
+                    softwareRenderer = false;
+            }
+
+            //run-ahead frames
+            if (counter == 32)
+            {
+                runAheadFrames = mapping;
+            }
+
+            //fast-forward speed
+            if (counter == 33)
+            {
+                if (mapping > 1)
+                    fastForwardSpeed = mapping;
+            }
+
+            //adaptive frameskip
+            if (counter == 34)
+            {
+                if (mapping == 1)
+                    frameskip = true;
+                else
+                    frameskip = false;
+            }
+
+            //texture disk cache
+            if (counter == 35)
+            {
+                if (mapping == 1)
+                    textureCache = true;
+                else
+                    textureCache = false;
+            }
+
+            //display list replay
+            if (counter == 36)
+            {
+                displayListReplay = mapping;
+            }
+
+            //pipelined software renderer VI
+            if (counter == 37)
+            {
+                if (mapping == 1)
+                    viPipelined = true;
+                else
+                    viPipelined = false;
+            }
+
             counter++;
 
 
@@ -391,6 +499,15 @@ int main(int argc, char* argv[])
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
     SDL_GLContext Context = SDL_GL_CreateContext(WindowOpenGL);
 
+#ifdef __EMSCRIPTEN__
+    //script.js runs the main loop from requestAnimationFrame as often as
+    //neil_frames_due() says, which is always vsynced
+    framePacerInit(true, false);
+#else
+    framePacerInit(SDL_GL_SetSwapInterval(1) == 0, false);
+#endif
+    updateHostRefreshRate();
+
 
 #ifndef __EMSCRIPTEN__
     SDL_AudioSpec AudioSettings = { 0 };
@@ -437,11 +554,11 @@ int main(int argc, char* argv[])
 
     SDL_Rect rect;
 
+    shaderProgram = initShaders();
+
     setupDrawTextOpenGL();
     imageOverlay = loadOpenGLTexture("overlay.png");
 
-    shaderProgram = initShaders();
-
     //clear the screen
     glClearColor(184.0f / 255.0f, 213.0f / 255.0f, 238.0f / 255.0f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -458,6 +575,12 @@ int main(int argc, char* argv[])
     }
 
     readConfig();
+    setSoftwareRenderer(softwareRenderer);
+    setRunAheadFrames(runAheadFrames);
+    setFrameskip(frameskip);
+    setTextureDiskCache(textureCache);
+    setDisplayListReplay(displayListReplay);
+    setViPipelined(viPipelined);
 
     FILE* f = fopen(rom_name, "rb");
     fseek(f, 0, SEEK_END);
@@ -468,6 +591,7 @@ int main(int argc, char* argv[])
     fread(filecontent, 1, fsize, f);
     fclose(f);
 
+    //the core takes ownership of filecontent, no extra copy
     bool loaded = retro_load_game_new(filecontent, fsize, loadEep, loadSra, loadFla);
     if (!loaded)
         printf("problem loading rom\n");
@@ -479,6 +603,8 @@ int main(int argc, char* argv[])
 		mainLoop();
 	}
 
+    printf("frame pacing: %s\n", neil_frame_pacing_stats());
+
     retro_deinit();
     SDL_CloseAudio();
     SDL_Quit();
@@ -504,6 +630,7 @@ char menuItems[][30] = {
     "Load State",
     "Save State",
     "Full Screen",
+    "Fast Forward",
 };
 int selectedMenuItem = 0;
 
@@ -535,7 +662,6 @@ void mainLoop()
 {
 
     SDL_Event windowEvent;
-    frameStart = SDL_GetTicks();
 
 
     connectGamepad();
@@ -710,7 +836,14 @@ void mainLoop()
     //if emulator is too far ahead
     audioBufferQueue = SDL_GetQueuedAudioSize(audioDeviceId);
     if (audioBufferQueue < 20000)
-        retro_run();
+    {
+        if (fastForward)
+            retro_run_fast_forward(fastForwardSpeed);
+        else if (frameskip)
+            retro_run_frameskip();
+        else
+            retro_run_ahead();
+    }
     else
     {
         hadSkip = 1;
@@ -721,6 +854,10 @@ void mainLoop()
 
     if(getReadyToSwap()==1)
     {
+        drawSoftwareFrame();
+
+        Uint64 overlayStart = SDL_GetPerformanceCounter();
+
         if (showOverlay)
         {
             drawOverlay();
@@ -737,8 +874,13 @@ void mainLoop()
             drawTextOpenGL(toast_message, 0, 30, fontcolorWhite, FONTSIZE_24);
             toastCounter--;
         }
+
+        flushTextOpenGL();
+        overlayTicks += SDL_GetPerformanceCounter() - overlayStart;
+        overlayFrames++;
         
         SDL_GL_SwapWindow(WindowOpenGL);
+        framePacerFramePresented();
         resetReadyToSwap();
         swapCount++;
     }
@@ -840,6 +982,17 @@ void processMenuItemButtons()
         }
 #endif
 
+        //"Fast Forward" - 4
+        if (selectedMenuItem == 4)
+        {
+            fastForward = !fastForward;
+            if (fastForward)
+                sprintf(toast_message, "Fast Forward %dx", fastForwardSpeed);
+            else
+                sprintf(toast_message, "Fast Forward Off");
+            toastCounter = 60;
+        }
+
         showOverlay = false;
 
     }
@@ -865,18 +1018,24 @@ void drawOverlay()
 }
 
 
+void updateHostRefreshRate()
+{
+#ifndef __EMSCRIPTEN__
+    //the browser build measures it from the requestAnimationFrame timestamps
+    SDL_DisplayMode mode;
+    int display = SDL_GetWindowDisplayIndex(WindowOpenGL);
+    if (display >= 0 && SDL_GetCurrentDisplayMode(display, &mode) == 0)
+        framePacerSetHostRefreshRate(mode.refresh_rate);
+#endif
+}
+
 void limitFPS()
 {
     // Wait to mantain framerate:
-    frameTime = SDL_GetTicks() - frameStart;
-    if (frameTime < DELAY)
-    {
-#ifdef __EMSCRIPTEN__
-        //emscripten_sleep(1);
-#else
-        SDL_Delay((int)(DELAY - frameTime));
+    framePacerSetTargetRate(getVIRefreshRate());
+#ifndef __EMSCRIPTEN__
+    framePacerWait();
 #endif
-    }
 
 
     //calculate FPS
@@ -887,6 +1046,8 @@ void limitFPS()
         current_fps_counter = 0;
         current_frameStart = SDL_GetTicks();
         currentSwapCount = swapCount; //n64 fps
+        currentSkippedFrames = getSkippedFrames();
+        resetSkippedFrames();
 
 
         //for debugging
@@ -895,9 +1056,25 @@ void limitFPS()
         currentHadSkip = hadSkip;
         hadSkip = 0;
         currentMaxAudioBufferQueue = maxAudioBufferQueue;
+
+        //cpu time spent submitting the overlay and text per swapped frame
+        currentOverlayTicks = overlayFrames ? overlayTicks / overlayFrames : 0;
+        overlayTicks = 0;
+        overlayFrames = 0;
+        currentTextUploads = textUploads;
+        textUploads = 0;
+
+        //the window may have moved to another display
+        updateHostRefreshRate();
     }
 
-    sprintf(fps_text, "FPS: %d GameFPS: %d", current_fps, currentSwapCount);
+    if (showOverlay)
+        sprintf(fps_text, "FPS: %d GameFPS: %d UI: %.2fms %d uploads", current_fps, currentSwapCount,
+            currentOverlayTicks * 1000.0 / SDL_GetPerformanceFrequency(), currentTextUploads);
+    else if (frameskip)
+        sprintf(fps_text, "FPS: %d GameFPS: %d Skipped: %d", current_fps, currentSwapCount, currentSkippedFrames);
+    else
+        sprintf(fps_text, "FPS: %d GameFPS: %d", current_fps, currentSwapCount);
 
     //SDL_SetWindowTitle(WindowOpenGL, fps_text);
 
@@ -910,10 +1087,42 @@ extern "C" {
         mainLoop();
     }
 
+    //called by script.js from requestAnimationFrame, how many times to
+    //call runMainLoop() before this display refresh
+    int neil_frames_due(double timestamp)
+    {
+        return framePacerFramesDue(timestamp);
+    }
+
     struct NeilButtons* getNeilButtons()
     {
         return &neilbuttons;
     }
+
+    //frame pacing diagnostics, presented frame times since the last call
+    //as a 1ms histogram
+    const char* neil_frame_pacing_stats()
+    {
+        static char text[1024];
+        static const char* modes[] = { "free", "timed", "vsync" };
+        FramePacerStats stats;
+        framePacerGetStats(&stats);
+        framePacerResetStats();
+
+        int len = snprintf(text, sizeof(text),
+            "mode %s, target %.3fHz, display %dHz, %d vblank(s)/frame, %u frames, avg %.2fms, max %.2fms, histogram",
+            modes[stats.mode], stats.targetRate, stats.hostRefreshRate, stats.vblanksPerFrame,
+            stats.frames, stats.averageMs, stats.maxMs);
+
+        for (int i = 0; i < FRAME_PACER_HISTOGRAM_BUCKETS && len < (int)sizeof(text); i++)
+        {
+            if (stats.histogram[i])
+                len += snprintf(text + len, sizeof(text) - len, " %d%s:%u", i,
+                    i == FRAME_PACER_HISTOGRAM_BUCKETS - 1 ? "+" : "", stats.histogram[i]);
+        }
+
+        return text;
+    }
 }
 
 
@@ -979,10 +1188,94 @@ unsigned int initShaders()
     return program;
 }
 
+//render one glyph at a time with SDL_ttf and pack them into
+//rows of the atlas, glyphs are white so any color can be applied
+void buildTextAtlas(uint32_t* atlas, int* penX, int* penY, int* rowHeight, MY_FONT_SIZE fontsize)
+{
+    TTF_Font* font = fontsize == FONTSIZE_24 ? font24 : font40;
+    SDL_Color white = { 255, 255, 255, 255 };
+
+    for (int c = TEXT_FIRST_GLYPH; c <= TEXT_LAST_GLYPH; c++)
+    {
+        TextGlyph* glyph = &textGlyphs[fontsize][c - TEXT_FIRST_GLYPH];
+        char text[2] = { (char)c, 0 };
+        int minx, maxx, miny, maxy, advance;
+
+        memset(glyph, 0, sizeof(*glyph));
+        if (!font || TTF_GlyphMetrics(font, c, &minx, &maxx, &miny, &maxy, &advance) != 0)
+            continue;
+        glyph->advance = advance;
+
+        SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, white);
+        if (surface == NULL)
+            continue;
+
+        if (*penX + surface->w > TEXT_ATLAS_SIZE)
+        {
+            *penX = 0;
+            *penY += *rowHeight + 1;
+            *rowHeight = 0;
+        }
+
+        if (*penY + surface->h > TEXT_ATLAS_SIZE)
+        {
+            printf("text atlas full\n");
+            SDL_FreeSurface(surface);
+            continue;
+        }
+
+        SDL_LockSurface(surface);
+        for (int y = 0; y < surface->h; y++)
+        {
+            memcpy(atlas + (*penY + y) * TEXT_ATLAS_SIZE + *penX,
+                (uint8_t*)surface->pixels + y * surface->pitch, surface->w * 4);
+        }
+        SDL_UnlockSurface(surface);
+
+        //the surface starts at the glyph's left edge if it overhangs the pen
+        glyph->xoffset = minx < 0 ? minx : 0;
+        glyph->w = surface->w;
+        glyph->h = surface->h;
+        glyph->u0 = (float)*penX / TEXT_ATLAS_SIZE;
+        glyph->v0 = (float)*penY / TEXT_ATLAS_SIZE;
+        glyph->u1 = (float)(*penX + surface->w) / TEXT_ATLAS_SIZE;
+        glyph->v1 = (float)(*penY + surface->h) / TEXT_ATLAS_SIZE;
+
+        *penX += surface->w + 1;
+        if (surface->h > *rowHeight)
+            *rowHeight = surface->h;
+
+        SDL_FreeSurface(surface);
+    }
+}
+
 void setupDrawTextOpenGL()
 {
-    //create the buffer
+    //create the buffers
     glGenBuffers(1, &vertexBufferDrawText);
+    glGenBuffers(1, &vertexBufferText);
+
+    uint32_t* atlas = (uint32_t*)calloc(TEXT_ATLAS_SIZE * TEXT_ATLAS_SIZE, 4);
+    int penX = 0, penY = 0, rowHeight = 0;
+    buildTextAtlas(atlas, &penX, &penY, &rowHeight, FONTSIZE_24);
+    buildTextAtlas(atlas, &penX, &penY, &rowHeight, FONTSIZE_40);
+
+    glGenTextures(1, &textAtlasTexture);
+    glBindTexture(GL_TEXTURE_2D, textAtlasTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    //glyphs are white so the BGRA order of the surface doesn't matter
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TEXT_ATLAS_SIZE, TEXT_ATLAS_SIZE, 0,
+        GL_RGBA, GL_UNSIGNED_BYTE, atlas);
+    free(atlas);
+
+    //text is tinted with u_Color, everything else is drawn untinted
+    textColorLocation = glGetUniformLocation(shaderProgram, "u_Color");
+    glUseProgram(shaderProgram);
+    glUniform4f(textColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
 }
 
 void translateDrawTextScreenCoordinates(int x, int y, int w, int h)
@@ -1027,101 +1320,132 @@ void translateDrawTextScreenCoordinates(int x, int y, int w, int h)
     }
 }
 
-//we use SDL's API to generate an image of the text but then
-//we need to convert it into an OpenGL Texture
-//NOTE - x and y start at the bottom left corner of the screen
-void drawTextOpenGL(const char* text, int x, int y, SDL_Color color, MY_FONT_SIZE fontsize)
+//lay out a string once as quads in pixels relative to its bottom left
+//corner, the layout is cached since the same strings are drawn every frame
+const std::vector<float>& layoutText(const char* text, MY_FONT_SIZE fontsize)
 {
-    //need this to enable transparency on the texture
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    GLuint texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-
-    TTF_Font* font = NULL;
+    std::unordered_map<std::string, std::vector<float> >& cache = textLayoutCache[fontsize];
 
-    if (fontsize == FONTSIZE_24) font = font24;
-    if (fontsize == FONTSIZE_40) font = font40;
+    std::unordered_map<std::string, std::vector<float> >::iterator it = cache.find(text);
+    if (it != cache.end())
+        return it->second;
 
-    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, text, color);
+    //strings like the fps counter change, don't let the cache grow forever
+    if (cache.size() >= TEXT_LAYOUT_CACHE_MAX)
+        cache.clear();
 
-    //surface->w TEXTURE WIDTH
-    //surface->h TEXTURE HEIGHT
+    std::vector<float>& quads = cache[text];
+    int penX = 0;
 
-    translateDrawTextScreenCoordinates(x, y, surface->w, surface->h);
+    for (const char* c = text; *c; c++)
+    {
+        int index = (unsigned char)*c;
+        if (index < TEXT_FIRST_GLYPH || index > TEXT_LAST_GLYPH)
+            index = '?';
 
-    //we are technically using the same shader for 
-    //drawTextOpenGL() and drawOpenglTexture() so this
-    //code is nearly the same in both however 
-    //keeping it in both in case I ever have seperate shaders
-    glUseProgram(shaderProgram);
+        TextGlyph* glyph = &textGlyphs[fontsize][index - TEXT_FIRST_GLYPH];
+        float x0 = (float)(penX + glyph->xoffset);
+        float x1 = x0 + glyph->w;
+        float y1 = (float)glyph->h;
 
-    //bind it or "select" it
-    glBindBuffer(GL_ARRAY_BUFFER, vertexBufferDrawText);
-    //fill the buffer with data
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 24, positionsDrawTextFinal, GL_DYNAMIC_DRAW);
+        if (glyph->w > 0)
+        {
+            float quad[24] = {
+                x0, 0.0f, glyph->u0, glyph->v1,
+                x1, 0.0f, glyph->u1, glyph->v1,
+                x1, y1,   glyph->u1, glyph->v0,
+                x0, 0.0f, glyph->u0, glyph->v1,
+                x1, y1,   glyph->u1, glyph->v0,
+                x0, y1,   glyph->u0, glyph->v0,
+            };
+            quads.insert(quads.end(), quad, quad + 24);
+        }
 
-    //define the position attribute
-    glVertexAttribPointer(
-        0, //attribute number for shader
-        2, //size or number of components for this attribute, so 2 floats for a position
-        GL_FLOAT, //data type of each component
-        GL_FALSE, //do we want it to auto normalize the data for us (or convert it to a range of 0-1)
-        sizeof(float) * 4, //stride or number of bytes between each vertex
-        (GLvoid*)0 //offset to this attribute - needs to be converted to a pointer (const void*)8 as an example
-    );
+        penX += glyph->advance;
+    }
 
-    //texture coordinate
-    glVertexAttribPointer(
-        1, //attribute number for shader
-        2, //size or number of components for this attribute, so 2 floats for a position
-        GL_FLOAT, //data type of each component
-        GL_FALSE, //do we want it to auto normalize the data for us (or convert it to a range of 0-1)
-        sizeof(float) * 4, //stride or number of bytes between each vertex
-        (GLvoid*)8 //offset to this attribute - needs to be converted to a pointer (const void*)8 as an example
-    );
+    return quads;
+}
 
+//queue the text, it is drawn with all the other text of the frame
+//in flushTextOpenGL()
+//NOTE - x and y start at the bottom left corner of the screen
+void drawTextOpenGL(const char* text, int x, int y, SDL_Color color, MY_FONT_SIZE fontsize)
+{
+    const std::vector<float>& quads = layoutText(text, fontsize);
+    if (quads.empty())
+        return;
+
+    //colors are given BGRA (see fontcolorRed), swap them back
+    float r = color.b / 255.0f;
+    float g = color.g / 255.0f;
+    float b = color.r / 255.0f;
+
+    int first = (int)textBatch.size() / 4;
+    if (textRuns.empty() || textRuns.back().color[0] != r ||
+        textRuns.back().color[1] != g || textRuns.back().color[2] != b)
+    {
+        TextRun run = { { r, g, b, 1.0f }, first, 0 };
+        textRuns.push_back(run);
+    }
+    textRuns.back().count += (int)quads.size() / 4;
 
-    //need to enable this attribute in this case 0th attribute (matches first parameter of glVertexAttribPointer above)
-    glEnableVertexAttribArray(0);
-    glEnableVertexAttribArray(1);
+    //pixels to openGL coordinates, see translateDrawTextScreenCoordinates()
+    float scaleX = 2.0f / 640.0f;
+    float scaleY = 2.0f / 480.0f;
+    for (size_t i = 0; i < quads.size(); i += 4)
+    {
+        textBatch.push_back((x + quads[i]) * scaleX - 1.0f);
+        textBatch.push_back((y + quads[i + 1]) * scaleY - 1.0f);
+        textBatch.push_back(quads[i + 2]);
+        textBatch.push_back(quads[i + 3]);
+    }
+}
 
+//draw all the text queued this frame, one draw call per color and
+//the vertex buffer is only uploaded again when the text has changed
+void flushTextOpenGL()
+{
+    if (textBatch.empty())
+    {
+        textRuns.clear();
+        return;
+    }
 
-    char colors = surface->format->BytesPerPixel;
-    int texture_format;
+    //need this to enable transparency on the texture
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glUseProgram(shaderProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBufferText);
 
-    //Emscripten doesn't support GL_BGRA ??
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, surface->w, surface->h, 0,
-        GL_RGBA, GL_UNSIGNED_BYTE, surface->pixels);
+    if (textBatch != textBatchUploaded)
+    {
+        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * textBatch.size(), textBatch.data(), GL_DYNAMIC_DRAW);
+        textBatchUploaded.swap(textBatch);
+        textUploads++;
+    }
 
+    //same layout as drawOpenglTexture(), position then texture coordinate
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, (GLvoid*)0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(float) * 4, (GLvoid*)8);
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
 
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, texture);
-
-    //render the triangles
-    glDrawArrays(
-        GL_TRIANGLES, //what are we drawing
-        0, //first index to draw
-        6 //how many to draw
-    );
+    glBindTexture(GL_TEXTURE_2D, textAtlasTexture);
 
+    for (size_t i = 0; i < textRuns.size(); i++)
+    {
+        glUniform4fv(textColorLocation, 1, textRuns[i].color);
+        glDrawArrays(GL_TRIANGLES, textRuns[i].first, textRuns[i].count);
+    }
 
+    glUniform4f(textColorLocation, 1.0f, 1.0f, 1.0f, 1.0f);
     glDisable(GL_BLEND);
 
-
-    glDeleteTextures(1, &texture);
-    SDL_FreeSurface(surface);
-
-    // //if we don't destroy this you will see in 
-    // //windows task manager the memory will keep growing
-    // SDL_DestroyTexture(fontTexture); 
+    textBatch.clear();
+    textRuns.clear();
 }
 
 
@@ -1212,6 +1536,66 @@ void drawOpenglTexture(int x, int y, int w, int h, GLuint imageID)
     
 }
 
+//upload the frame of the software renderer and draw it fullscreen,
+//the GL renderers draw directly to the window
+void drawSoftwareFrame()
+{
+    int width, height, pitch;
+    const uint8_t* frame = (const uint8_t*)getSoftwareFrame(&width, &height, &pitch);
+    if (frame == NULL || width <= 0 || height <= 0)
+        return;
+
+    if (softwareFrameTexture == 0)
+    {
+        glGenTextures(1, &softwareFrameTexture);
+        glBindTexture(GL_TEXTURE_2D, softwareFrameTexture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        //largest frame angrylion can output (PAL prescale area)
+        softwareFrameBuffer = (uint8_t*)malloc(640 * 625 * 4);
+    }
+
+    if (width > 640) width = 640;
+    if (height > 625) height = 625;
+
+    //frame is BGRA and Emscripten doesn't support GL_BGRA,
+    //swizzle it to RGBA and force it opaque since we blend
+    for (int y = 0; y < height; y++)
+    {
+        const uint8_t* src = frame + y * pitch;
+        uint8_t* dst = softwareFrameBuffer + y * width * 4;
+        for (int x = 0; x < width; x++)
+        {
+            dst[x * 4 + 0] = src[x * 4 + 2];
+            dst[x * 4 + 1] = src[x * 4 + 1];
+            dst[x * 4 + 2] = src[x * 4 + 0];
+            dst[x * 4 + 3] = 255;
+        }
+    }
+
+    //only reallocate the texture when the game changes resolution,
+    //otherwise just upload the new frame into it
+    glBindTexture(GL_TEXTURE_2D, softwareFrameTexture);
+    if (width != softwareFrameTextureWidth || height != softwareFrameTextureHeight)
+    {
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0,
+            GL_RGBA, GL_UNSIGNED_BYTE, softwareFrameBuffer);
+        softwareFrameTextureWidth = width;
+        softwareFrameTextureHeight = height;
+    }
+    else
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height,
+            GL_RGBA, GL_UNSIGNED_BYTE, softwareFrameBuffer);
+    }
+
+    drawOpenglTexture(0, 0, 640, 480, softwareFrameTexture);
+    glDisable(GL_BLEND);
+}
+
 int getKeyMapping(std::string line)
 {
     //remove carriage return
@@ -10,12 +10,13 @@ in vec2 v_TexCoord;
 //to spit out a color for every pixel
 layout(location = 0) out vec4 color;
 
-// uniform vec4 u_Color;
+//tint for the text atlas, white for everything else
+uniform vec4 u_Color;
 uniform sampler2D u_Texture;
 
 //fragment shader gets called once per pixel
 void main()
 {
     vec4 texColor = texture(u_Texture, v_TexCoord);
-    color = texColor;
+    color = texColor * u_Color;
 }
\ No newline at end of file
@@ -1,70 +1,31 @@
 #include "gDP_funcs.h"
 #include "../plugin.h"
 
-/* Sets a scissoring box at the screen coordinates 
- *
- * mode              - Video mode:
- *                     G_SC_NON_INTERLACE  - Draw all scan lines
- *                     G_SC_ODD_INTERLACE  - Draw only odd-numbered scan lines
- *                     G_SC_EVEN_INTERLACE - Draw only even-numbered scan lines
- *
- * ulx               - Screen's left edge coordinates (0.0~1023.75) 
- * uly               - Screen's top edge coordinates (0.0~1023.75) 
- * lrx               - Screen's right edge coordinates (0.0~1023.75) 
- * lry               - Screen's bottom edge coordinates (0.0~1023.75) 
- * */
-void GDPSetScissor(uint32_t mode,
-      float ulx, float uly, float lrx, float lry )
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gDPSetScissor(mode, ulx, uly, lrx, lry);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLIDEN64)
-         gln64gDPSetScissor(mode, ulx, uly, lrx, lry);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, no HLE */
-         break;
-   }
-}
+#ifndef GFX_HLE_GLIDE64_ONLY
+struct gdp_dispatch gdp_dispatch;
+
+/* renderers without HLE, or that don't implement a call */
+static void gdp_stub_set_scissor(uint32_t mode, float ulx, float uly, float lrx, float lry) { }
+static void gdp_stub_load_block(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
+      uint32_t lr_s, uint32_t dxt) { }
 
-/*
- * Loads a texture image in a continguous block from DRAM to
- * on-chip texture memory (TMEM).
- *
- * The texture image is loaded into memory in a single transfer.
- *
- * tile      - Tile descriptor index 93-bit precision, 0~7).
- * ul_s      - texture tile's upper-left s coordinate (10.2, 0.0~1023.75)
- * ul_t      - texture tile's upper-left t coordinate (10.2, 0.0~1023.75)
- * lr_s      - texture tile's lower-right s coordinate (10.2, 0.0~1023.75)
- * dxt        - amount of change in value of t per scan line (12-bit precision, 0~4095)
- */
-void GDPLoadBlock(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
-      uint32_t lr_s, uint32_t dxt )
+void GDPConnect(enum gfx_plugin_type type)
 {
-   switch (gfx_plugin)
+   gdp_dispatch.setScissor = gdp_stub_set_scissor;
+   gdp_dispatch.loadBlock  = gdp_stub_load_block;
+
+   switch (type)
    {
       case GFX_GLIDE64:
 #ifdef HAVE_GLIDE64
-         glide64gDPLoadBlock(tile, ul_s, ul_t, lr_s, dxt);
+         gdp_dispatch.setScissor = glide64gDPSetScissor;
+         gdp_dispatch.loadBlock  = glide64gDPLoadBlock;
 #endif
          break;
       case GFX_GLN64:
 #ifdef HAVE_GLIDEN64
-         gln64gDPLoadBlock(tile, ul_s, ul_t, lr_s, dxt);
+         gdp_dispatch.setScissor = gln64gDPSetScissor;
+         gdp_dispatch.loadBlock  = gln64gDPLoadBlock;
 #endif
          break;
       case GFX_RICE:
@@ -78,3 +39,4 @@ void GDPLoadBlock(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
          break;
    }
 }
+#endif
@@ -4,12 +4,27 @@
 #include <stdint.h>
 
 #include "gDP_funcs_prot.h"
+#include "../plugin.h"
 
-#define gDPSetScissor(mode, ulx, uly, lrx, lry) GDPSetScissor(mode, ulx, uly, lrx, lry)
-#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) GDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t)
+/* see gDP_funcs_C.h */
+#ifdef GFX_HLE_GLIDE64_ONLY
+#define gDPSetScissor(mode, ulx, uly, lrx, lry) glide64gDPSetScissor(mode, ulx, uly, lrx, lry)
+#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) glide64gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t)
+#else
+#define gDPSetScissor(mode, ulx, uly, lrx, lry) gdp_dispatch.setScissor(mode, ulx, uly, lrx, lry)
+#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) gdp_dispatch.loadBlock(tile, ul_s, ul_t, lr_s, lr_t)
 
-void GDPSetScissor(uint32_t mode, float ulx, float uly, float lrx, float lry );
-void GDPLoadBlock(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
-      uint32_t lr_s, uint32_t dxt );
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct gdp_dispatch gdp_dispatch;
+
+void GDPConnect(enum gfx_plugin_type type);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
 
 #endif
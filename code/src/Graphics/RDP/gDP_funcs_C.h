@@ -4,12 +4,47 @@
 #include <stdint.h>
 
 #include "gDP_funcs_prot.h"
+#include "../plugin.h"
 
-#define gDPSetScissor(mode, ulx, uly, lrx, lry) GDPSetScissorC(mode, ulx, uly, lrx, lry)
-#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) GDPLoadBlockC(tile, ul_s, ul_t, lr_s, lr_t)
+/* gDPSetScissor sets a scissoring box at the screen coordinates
+ *
+ * mode              - Video mode:
+ *                     G_SC_NON_INTERLACE  - Draw all scan lines
+ *                     G_SC_ODD_INTERLACE  - Draw only odd-numbered scan lines
+ *                     G_SC_EVEN_INTERLACE - Draw only even-numbered scan lines
+ *
+ * ulx               - Screen's left edge coordinates (0.0~1023.75) 
+ * uly               - Screen's top edge coordinates (0.0~1023.75) 
+ * lrx               - Screen's right edge coordinates (0.0~1023.75) 
+ * lry               - Screen's bottom edge coordinates (0.0~1023.75) 
+ *
+ * gDPLoadBlock loads a texture image in a continguous block from DRAM
+ * to on-chip texture memory (TMEM), in a single transfer.
+ *
+ * tile      - Tile descriptor index 93-bit precision, 0~7).
+ * ul_s      - texture tile's upper-left s coordinate (10.2, 0.0~1023.75)
+ * ul_t      - texture tile's upper-left t coordinate (10.2, 0.0~1023.75)
+ * lr_s      - texture tile's lower-right s coordinate (10.2, 0.0~1023.75)
+ * dxt        - amount of change in value of t per scan line (12-bit precision, 0~4095)
+ */
+#ifdef GFX_HLE_GLIDE64_ONLY
+#define gDPSetScissor(mode, ulx, uly, lrx, lry) glide64gDPSetScissor(mode, ulx, uly, lrx, lry)
+#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) glide64gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t)
+#else
+#define gDPSetScissor(mode, ulx, uly, lrx, lry) gdp_dispatch_c.setScissor(mode, ulx, uly, lrx, lry)
+#define gDPLoadBlock(tile, ul_s, ul_t, lr_s, lr_t) gdp_dispatch_c.loadBlock(tile, ul_s, ul_t, lr_s, lr_t)
 
-void GDPSetScissorC(uint32_t mode, float ulx, float uly, float lrx, float lry );
-void GDPLoadBlockC(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
-      uint32_t lr_s, uint32_t dxt );
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct gdp_dispatch gdp_dispatch_c;
+
+void GDPConnectC(enum gfx_plugin_type type);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
 
 #endif
@@ -39,6 +39,15 @@ void glide64gDPSetTextureImage(int32_t fmt, int32_t siz,
    int32_t width, int32_t addr);
 void glide64gDPFillRectangle(uint32_t ul_x, uint32_t ul_y, uint32_t lr_x, uint32_t lr_y);
 
+/* gDP calls of the running renderer, for builds with more than one HLE
+ * renderer (see GFX_HLE_GLIDE64_ONLY) */
+struct gdp_dispatch
+{
+   void (*setScissor)(uint32_t mode, float ulx, float uly, float lrx, float lry);
+   void (*loadBlock)(uint32_t tile, uint32_t ul_s, uint32_t ul_t,
+         uint32_t lr_s, uint32_t dxt);
+};
+
 #ifdef __cplusplus
 }
 #endif
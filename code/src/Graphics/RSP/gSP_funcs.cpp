@@ -1,170 +1,52 @@
 #include "gSP_funcs.h"
 #include "../plugin.h"
 
-void GSPCombineMatrices(void)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPCombineMatrices();
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPCombineMatrices();
-#endif
-         break;
-      case GFX_RICE:
-#if defined(HAVE_RICE)
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+#ifndef GFX_HLE_GLIDE64_ONLY
+struct gsp_dispatch gsp_dispatch;
 
-void GSPDlistCount(uint32_t count, uint32_t v)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPDlistCount(count, v);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPDlistCount(count, v);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
-
-void GSPClipVertex(uint32_t v)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPClipVertex(v);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPClipVertex(v);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+/* renderers without HLE, or that don't implement a call */
+static void gsp_stub(void) { }
+static void gsp_stub_u32(uint32_t a) { }
+static void gsp_stub_u32_u32(uint32_t a, uint32_t b) { }
+static void gsp_stub_u32_s32(uint32_t a, int32_t b) { }
 
-/* Loads a LookAt structure in the RSP for specular highlighting
- * and projection mapping.
- *
- * l             - The lookat structure address.
- */
-void GSPLookAt(uint32_t l, uint32_t n)
+void GSPConnect(enum gfx_plugin_type type)
 {
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPLookAt(l, n);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPLookAt(l, n);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+   gsp_dispatch.combineMatrices = gsp_stub;
+   gsp_dispatch.clipVertex      = gsp_stub_u32;
+   gsp_dispatch.lookAt          = gsp_stub_u32_u32;
+   gsp_dispatch.light           = gsp_stub_u32_s32;
+   gsp_dispatch.lightColor      = gsp_stub_u32_u32;
+   gsp_dispatch.viewport        = gsp_stub_u32;
+   gsp_dispatch.forceMatrix     = gsp_stub_u32;
+   gsp_dispatch.dlistCount      = gsp_stub_u32_u32;
 
-/* Loads one light structure to the RSP.
- *
- * l             - The pointer to the light structure.
- * n             - The light number that is replaced (1~8)
- */
-void GSPLight(uint32_t l, int32_t n)
-{
-   switch (gfx_plugin)
+   switch (type)
    {
       case GFX_GLIDE64:
 #ifdef HAVE_GLIDE64
-         glide64gSPLight(l, n);
+         gsp_dispatch.combineMatrices = glide64gSPCombineMatrices;
+         gsp_dispatch.clipVertex      = glide64gSPClipVertex;
+         gsp_dispatch.lookAt          = glide64gSPLookAt;
+         gsp_dispatch.light           = glide64gSPLight;
+         gsp_dispatch.lightColor      = glide64gSPLightColor;
+         gsp_dispatch.viewport        = glide64gSPViewport;
+         gsp_dispatch.forceMatrix     = glide64gSPForceMatrix;
+         gsp_dispatch.dlistCount      = glide64gSPDlistCount;
 #endif
          break;
       case GFX_GLN64:
 #if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPLight(l, n);
+         gsp_dispatch.combineMatrices = gln64gSPCombineMatrices;
+         gsp_dispatch.clipVertex      = gln64gSPClipVertex;
+         gsp_dispatch.lookAt          = gln64gSPLookAt;
+         gsp_dispatch.light           = gln64gSPLight;
+         gsp_dispatch.lightColor      = gln64gSPLightColor;
+         gsp_dispatch.viewport        = gln64gSPViewport;
+         gsp_dispatch.dlistCount      = gln64gSPDlistCount;
 #endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
-
-/* Quickly changes the light color in the RSP.
- *
- * lightNum     - The light number whose color is being modified:
- *                LIGHT_1 (First light)
- *                LIGHT_2 (Second light)
- *                :
- *                LIGHT_u (Eighth light)
- *
- * packedColor - The new light color (32-bit value 0xRRGGBB??)
- *               (?? is ignored)
- * */
-
-void GSPLightColor(uint32_t lightNum, uint32_t packedColor )
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPLightColor(lightNum, packedColor);
-#endif
-         break;
-      case GFX_GLN64:
 #ifdef HAVE_GLN64
-         gln64gSPLightColor(lightNum, packedColor);
+         gsp_dispatch.forceMatrix     = gln64gSPForceMatrix;
 #endif
          break;
       case GFX_RICE:
@@ -178,62 +60,15 @@ void GSPLightColor(uint32_t lightNum, uint32_t packedColor )
          break;
    }
 }
-
-/* Loads the viewport projection parameters.
- *
- * v           - v is the segment address to the viewport
- *               structure "Vp".
- * */
-void GSPViewport(uint32_t v)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPViewport(v);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPViewport(v);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
 #endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
 
-void GSPForceMatrix(uint32_t mptr)
+void GSPDlistCount(uint32_t count, uint32_t v)
 {
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPForceMatrix(mptr);
-#endif
-         break;
-      case GFX_GLN64:
-#if defined(HAVE_GLN64) || defined(HAVE_GLIDEN64)
-         gln64gSPForceMatrix(mptr);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
+#ifdef GFX_HLE_GLIDE64_ONLY
+   glide64gSPDlistCount(count, v);
+#else
+   gsp_dispatch.dlistCount(count, v);
 #endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
 }
 
 extern "C" void GSPEndDisplayListC(void);
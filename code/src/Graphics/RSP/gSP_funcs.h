@@ -4,23 +4,41 @@
 #include <stdint.h>
 
 #include "gSP_funcs_prot.h"
+#include "../plugin.h"
 
-#define gSPCombineMatrices() GSPCombineMatrices()
-#define gSPClipVertex(v)     GSPClipVertex(v)
-#define gSPLookAt(l, n)      GSPLookAt(l, n)
-#define gSPLight(l, n)       GSPLight(l, n)
-#define gSPLightColor(l, c)  GSPLightColor(l, c)
-#define gSPViewport(v)       GSPViewport(v)
-#define gSPForceMatrix(mptr) GSPForceMatrix(mptr)
+/* see gSP_funcs_C.h */
+#ifdef GFX_HLE_GLIDE64_ONLY
+#define gSPCombineMatrices() glide64gSPCombineMatrices()
+#define gSPClipVertex(v)     glide64gSPClipVertex(v)
+#define gSPLookAt(l, n)      glide64gSPLookAt(l, n)
+#define gSPLight(l, n)       glide64gSPLight(l, n)
+#define gSPLightColor(l, c)  glide64gSPLightColor(l, c)
+#define gSPViewport(v)       glide64gSPViewport(v)
+#define gSPForceMatrix(mptr) glide64gSPForceMatrix(mptr)
+#else
+#define gSPCombineMatrices() gsp_dispatch.combineMatrices()
+#define gSPClipVertex(v)     gsp_dispatch.clipVertex(v)
+#define gSPLookAt(l, n)      gsp_dispatch.lookAt(l, n)
+#define gSPLight(l, n)       gsp_dispatch.light(l, n)
+#define gSPLightColor(l, c)  gsp_dispatch.lightColor(l, c)
+#define gSPViewport(v)       gsp_dispatch.viewport(v)
+#define gSPForceMatrix(mptr) gsp_dispatch.forceMatrix(mptr)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct gsp_dispatch gsp_dispatch;
+
+void GSPConnect(enum gfx_plugin_type type);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
 #define gSPEndDisplayList()  GSPEndDisplayList()
 
-void GSPCombineMatrices(void);
-void GSPClipVertex(uint32_t v);
-void GSPLookAt(uint32_t l, uint32_t n);
-void GSPLight(uint32_t l, int32_t n);
-void GSPLightColor(uint32_t lightNum, uint32_t packedColor );
-void GSPViewport(uint32_t v);
-void GSPForceMatrix(uint32_t mptr);
+void GSPDlistCount(uint32_t count, uint32_t v);
 void GSPEndDisplayList(void);
 
 
@@ -2,106 +2,50 @@
 #include "../plugin.h"
 #include "../RSP/RSP_state.h"
 
-void GSPCombineMatricesC(void)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPCombineMatrices();
-#endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPCombineMatrices();
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+#ifndef GFX_HLE_GLIDE64_ONLY
+struct gsp_dispatch gsp_dispatch_c;
 
-void GSPClipVertexC(uint32_t v)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPClipVertex(v);
-#endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPClipVertex(v);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+/* renderers without HLE, or that don't implement a call */
+static void gsp_stub(void) { }
+static void gsp_stub_u32(uint32_t a) { }
+static void gsp_stub_u32_u32(uint32_t a, uint32_t b) { }
+static void gsp_stub_u32_s32(uint32_t a, int32_t b) { }
 
-/* Loads a LookAt structure in the RSP for specular highlighting
- * and projection mapping.
- *
- * l             - The lookat structure address.
- */
-void GSPLookAtC(uint32_t l, uint32_t n)
+void GSPConnectC(enum gfx_plugin_type type)
 {
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPLookAt(l, n);
-#endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPLookAt(l, n);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
+   gsp_dispatch_c.combineMatrices = gsp_stub;
+   gsp_dispatch_c.clipVertex      = gsp_stub_u32;
+   gsp_dispatch_c.lookAt          = gsp_stub_u32_u32;
+   gsp_dispatch_c.light           = gsp_stub_u32_s32;
+   gsp_dispatch_c.lightColor      = gsp_stub_u32_u32;
+   gsp_dispatch_c.viewport        = gsp_stub_u32;
+   gsp_dispatch_c.forceMatrix     = gsp_stub_u32;
+   gsp_dispatch_c.dlistCount      = gsp_stub_u32_u32;
 
-/* Loads one light structure to the RSP.
- *
- * l             - The pointer to the light structure.
- * n             - The light number that is replaced (1~8)
- */
-void GSPLightC(uint32_t l, int32_t n)
-{
-   switch (gfx_plugin)
+   switch (type)
    {
       case GFX_GLIDE64:
 #ifdef HAVE_GLIDE64
-         glide64gSPLight(l, n);
+         gsp_dispatch_c.combineMatrices = glide64gSPCombineMatrices;
+         gsp_dispatch_c.clipVertex      = glide64gSPClipVertex;
+         gsp_dispatch_c.lookAt          = glide64gSPLookAt;
+         gsp_dispatch_c.light           = glide64gSPLight;
+         gsp_dispatch_c.lightColor      = glide64gSPLightColor;
+         gsp_dispatch_c.viewport        = glide64gSPViewport;
+         gsp_dispatch_c.forceMatrix     = glide64gSPForceMatrix;
+         gsp_dispatch_c.dlistCount      = glide64gSPDlistCount;
 #endif
          break;
       case GFX_GLN64:
 #if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPLight(l, n);
+         gsp_dispatch_c.combineMatrices = gln64gSPCombineMatrices;
+         gsp_dispatch_c.clipVertex      = gln64gSPClipVertex;
+         gsp_dispatch_c.lookAt          = gln64gSPLookAt;
+         gsp_dispatch_c.light           = gln64gSPLight;
+         gsp_dispatch_c.lightColor      = gln64gSPLightColor;
+         gsp_dispatch_c.viewport        = gln64gSPViewport;
+         gsp_dispatch_c.forceMatrix     = gln64gSPForceMatrix;
+         gsp_dispatch_c.dlistCount      = gln64gSPDlistCount;
 #endif
          break;
       case GFX_RICE:
@@ -115,101 +59,7 @@ void GSPLightC(uint32_t l, int32_t n)
          break;
    }
 }
-
-/* Quickly changes the light color in the RSP.
- *
- * lightNum     - The light number whose color is being modified:
- *                LIGHT_1 (First light)
- *                LIGHT_2 (Second light)
- *                :
- *                LIGHT_u (Eighth light)
- *
- * packedColor - The new light color (32-bit value 0xRRGGBB??)
- *               (?? is ignored)
- * */
-
-void GSPLightColorC(uint32_t lightNum, uint32_t packedColor )
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPLightColor(lightNum, packedColor);
-#endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPLightColor(lightNum, packedColor);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
-
-/* Loads the viewport projection parameters.
- *
- * v           - v is the segment address to the viewport
- *               structure "Vp".
- * */
-void GSPViewportC(uint32_t v)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPViewport(v);
-#endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPViewport(v);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
-
-void GSPForceMatrixC(uint32_t mptr)
-{
-   switch (gfx_plugin)
-   {
-      case GFX_GLIDE64:
-#ifdef HAVE_GLIDE64
-         glide64gSPForceMatrix(mptr);
 #endif
-         break;
-      case GFX_GLN64:
-#if !defined(HAVE_GLIDEN64) && defined(HAVE_GLN64)
-         gln64gSPForceMatrix(mptr);
-#endif
-         break;
-      case GFX_RICE:
-#ifdef HAVE_RICE
-         /* TODO/FIXME */
-#endif
-         break;
-      case GFX_ANGRYLION:
-      case GFX_PARALLEL:
-         /* Stub, not HLE */
-         break;
-   }
-}
 
 void GSPEndDisplayListC(void)
 {
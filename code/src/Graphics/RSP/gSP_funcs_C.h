@@ -4,27 +4,61 @@
 #include <stdint.h>
 
 #include "gSP_funcs_prot.h"
+#include "../plugin.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#define gSPCombineMatrices() GSPCombineMatricesC()
-#define gSPClipVertex(v)     GSPClipVertexC(v)
-#define gSPLookAt(l, n)      GSPLookAtC(l, n)
-#define gSPLight(l, n)       GSPLightC(l, n)
-#define gSPLightColor(l, c)  GSPLightColorC(l, c)
-#define gSPViewport(v)       GSPViewportC(v)
-#define gSPForceMatrix(mptr) GSPForceMatrixC(mptr)
+/* gSPLookAt loads a LookAt structure in the RSP for specular highlighting
+ * and projection mapping.
+ *
+ * l             - The lookat structure address.
+ *
+ * gSPLight loads one light structure to the RSP.
+ *
+ * l             - The pointer to the light structure.
+ * n             - The light number that is replaced (1~8)
+ *
+ * gSPLightColor quickly changes the light color in the RSP.
+ *
+ * lightNum     - The light number whose color is being modified:
+ *                LIGHT_1 (First light)
+ *                LIGHT_2 (Second light)
+ *                :
+ *                LIGHT_u (Eighth light)
+ *
+ * packedColor - The new light color (32-bit value 0xRRGGBB??)
+ *               (?? is ignored)
+ *
+ * gSPViewport loads the viewport projection parameters.
+ *
+ * v           - v is the segment address to the viewport
+ *               structure "Vp".
+ * */
+#ifdef GFX_HLE_GLIDE64_ONLY
+#define gSPCombineMatrices() glide64gSPCombineMatrices()
+#define gSPClipVertex(v)     glide64gSPClipVertex(v)
+#define gSPLookAt(l, n)      glide64gSPLookAt(l, n)
+#define gSPLight(l, n)       glide64gSPLight(l, n)
+#define gSPLightColor(l, c)  glide64gSPLightColor(l, c)
+#define gSPViewport(v)       glide64gSPViewport(v)
+#define gSPForceMatrix(mptr) glide64gSPForceMatrix(mptr)
+#else
+#define gSPCombineMatrices() gsp_dispatch_c.combineMatrices()
+#define gSPClipVertex(v)     gsp_dispatch_c.clipVertex(v)
+#define gSPLookAt(l, n)      gsp_dispatch_c.lookAt(l, n)
+#define gSPLight(l, n)       gsp_dispatch_c.light(l, n)
+#define gSPLightColor(l, c)  gsp_dispatch_c.lightColor(l, c)
+#define gSPViewport(v)       gsp_dispatch_c.viewport(v)
+#define gSPForceMatrix(mptr) gsp_dispatch_c.forceMatrix(mptr)
+
+extern struct gsp_dispatch gsp_dispatch_c;
+
+void GSPConnectC(enum gfx_plugin_type type);
+#endif
 #define gSPEndDisplayList()  GSPEndDisplayListC()
 
-void GSPCombineMatricesC(void);
-void GSPClipVertexC(uint32_t v);
-void GSPLookAtC(uint32_t l, uint32_t n);
-void GSPLightC(uint32_t l, int32_t n);
-void GSPLightColorC(uint32_t lightNum, uint32_t packedColor );
-void GSPViewportC(uint32_t v);
-void GSPForceMatrixC(uint32_t mptr);
 void GSPEndDisplayListC(void);
 
 #ifdef __cplusplus
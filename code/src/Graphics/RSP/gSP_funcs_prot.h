@@ -62,6 +62,20 @@ void glide64gSPSetDMATexOffset(uint32_t addr);
 
 void gln64gSPDlistCount(uint32_t count, uint32_t v);
 
+/* gSP calls of the running renderer, for builds with more than one HLE
+ * renderer (see GFX_HLE_GLIDE64_ONLY) */
+struct gsp_dispatch
+{
+   void (*combineMatrices)(void);
+   void (*clipVertex)(uint32_t v);
+   void (*lookAt)(uint32_t l, uint32_t n);
+   void (*light)(uint32_t l, int32_t n);
+   void (*lightColor)(uint32_t lightNum, uint32_t packedColor);
+   void (*viewport)(uint32_t v);
+   void (*forceMatrix)(uint32_t mptr);
+   void (*dlistCount)(uint32_t count, uint32_t v);
+};
+
 #ifdef __cplusplus
 }
 #endif
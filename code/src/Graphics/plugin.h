@@ -23,6 +23,16 @@ enum rsp_plugin_type
 
 extern enum gfx_plugin_type gfx_plugin;
 
+/* gDP and gSP calls only ever come from the HLE renderer that is running.
+ * When Glide64 is the only HLE renderer built in they go straight to it
+ * at compile time, otherwise through dispatch tables that
+ * gfx_hle_connect() fills in from plugin_connect_all() */
+#if defined(HAVE_GLIDE64) && !defined(HAVE_GLN64) && !defined(HAVE_GLIDEN64) && !defined(HAVE_RICE)
+#define GFX_HLE_GLIDE64_ONLY
+#endif
+
+void gfx_hle_connect(enum gfx_plugin_type type);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,3 +4,21 @@
 
 /* Just setting this to something, and GFX_GLIDE64 is 0 */
 enum gfx_plugin_type gfx_plugin = GFX_GLIDE64;
+
+#ifndef GFX_HLE_GLIDE64_ONLY
+/* the dispatch tables of the C and C++ gDP/gSP layers */
+void GDPConnectC(enum gfx_plugin_type type);
+void GSPConnectC(enum gfx_plugin_type type);
+void GDPConnect(enum gfx_plugin_type type);
+void GSPConnect(enum gfx_plugin_type type);
+#endif
+
+void gfx_hle_connect(enum gfx_plugin_type type)
+{
+#ifndef GFX_HLE_GLIDE64_ONLY
+   GDPConnectC(type);
+   GSPConnectC(type);
+   GDPConnect(type);
+   GSPConnect(type);
+#endif
+}
@@ -13924,6 +13924,135 @@ void CountCombine(void)
    //alpha_cmb_list_count = sizeof(alpha_cmb_list) >> 3;
 }
 
+//****************************************************************
+// Combine cache
+//
+// Games flip between a handful of combine modes many times a frame,
+// and every flip used to reset cmb, search both lists and rerun the
+// cc_/ac_ functions. Those functions fold the current colors into
+// cmb.ccolor and rdp.col, so the colors are part of the key along
+// with the modes and tile state they look at.
+//****************************************************************
+
+#define COMBINE_CACHE_SIZE          512  // direct mapped, power of 2
+#define COMBINE_CACHE_STATS_PERIOD  300  // frames between reports
+
+typedef struct
+{
+   uint32_t cycle1, cycle2;
+   uint32_t other_mode_l;
+   uint32_t other_mode_h;     // text_lod, text_detail and cycle_type only
+   int32_t  tile_format;
+   uint32_t tiles;            // cur_tile, last_tile, last_tile_size, texrecting
+   uint32_t prim_color, env_color, fog_color, blend_color;
+   uint32_t key_scale, key_center;
+   int32_t  k4, k5, primitive_lod_frac;
+   uint32_t hacks;
+   int32_t  ucode, lodmode;
+} COMBINE_KEY;
+
+typedef struct
+{
+   COMBINE_KEY key;
+   bool valid;
+   COMBINE cmb;
+   float col[4], coladd[4], col_2[4], shade_factor;
+   uint32_t cmb_flags, cmb_flags_2;
+   unsigned noise;
+   int tex;
+   int32_t primitive_lod_frac;  // some combiners replace it with k4
+} COMBINE_CACHE_ENTRY;
+
+static COMBINE_CACHE_ENTRY combine_cache[COMBINE_CACHE_SIZE];
+
+static struct
+{
+   unsigned resolved, hits;
+   unsigned frames;
+} combine_cache_stats;
+
+static void CombineCacheKey(COMBINE_KEY *key)
+{
+   key->cycle1             = rdp.cycle1;
+   key->cycle2             = rdp.cycle2;
+   key->other_mode_l       = gDP.otherMode.l;
+   key->other_mode_h       = gDP.otherMode.h & 0x00350000;
+   key->tile_format        = g_gdp.tile[rdp.cur_tile].format;
+   key->tiles              = (rdp.cur_tile & 0xFF) | ((rdp.last_tile & 0xFF) << 8) |
+      ((rdp.last_tile_size & 0xFF) << 16) | (rdp.texrecting << 24);
+   key->prim_color         = g_gdp.prim_color.total;
+   key->env_color          = g_gdp.env_color.total;
+   key->fog_color          = g_gdp.fog_color.total;
+   key->blend_color        = g_gdp.blend_color.total;
+   key->key_scale          = g_gdp.key_scale.total;
+   key->key_center         = g_gdp.key_center.total;
+   key->k4                 = g_gdp.k4;
+   key->k5                 = g_gdp.k5;
+   key->primitive_lod_frac = g_gdp.primitive_lod_frac;
+   key->hacks              = settings.hacks;
+   key->ucode              = settings.ucode;
+   key->lodmode            = settings.lodmode;
+}
+
+static uint32_t CombineCacheHash(const COMBINE_KEY *key)
+{
+   const uint32_t *w = (const uint32_t*)key;
+   uint32_t hash = 2166136261u;
+   unsigned i;
+
+   for (i = 0; i < sizeof(COMBINE_KEY) / sizeof(uint32_t); i++)
+      hash = (hash ^ w[i]) * 16777619u;
+
+   return (hash ^ (hash >> 16)) & (COMBINE_CACHE_SIZE - 1);
+}
+
+static void CombineCacheStore(COMBINE_CACHE_ENTRY *entry, const COMBINE_KEY *key)
+{
+   entry->key                = *key;
+   entry->valid              = true;
+   entry->cmb                = cmb;
+   memcpy(entry->col, rdp.col, sizeof(entry->col));
+   memcpy(entry->coladd, rdp.coladd, sizeof(entry->coladd));
+   memcpy(entry->col_2, rdp.col_2, sizeof(entry->col_2));
+   entry->shade_factor       = rdp.shade_factor;
+   entry->cmb_flags          = rdp.cmb_flags;
+   entry->cmb_flags_2        = rdp.cmb_flags_2;
+   entry->noise              = rdp.noise;
+   entry->tex                = rdp.tex;
+   entry->primitive_lod_frac = g_gdp.primitive_lod_frac;
+}
+
+static void CombineCacheRestore(const COMBINE_CACHE_ENTRY *entry)
+{
+   cmb                      = entry->cmb;
+   memcpy(rdp.col, entry->col, sizeof(entry->col));
+   memcpy(rdp.coladd, entry->coladd, sizeof(entry->coladd));
+   memcpy(rdp.col_2, entry->col_2, sizeof(entry->col_2));
+   rdp.shade_factor         = entry->shade_factor;
+   rdp.cmb_flags            = entry->cmb_flags;
+   rdp.cmb_flags_2          = entry->cmb_flags_2;
+   rdp.noise                = entry->noise;
+   rdp.tex                  = entry->tex;
+   g_gdp.primitive_lod_frac = entry->primitive_lod_frac;
+}
+
+void CombineCacheEndFrame(void)
+{
+#ifdef PERF_STATS
+   if (++combine_cache_stats.frames < COMBINE_CACHE_STATS_PERIOD)
+      return;
+
+   printf("combine cache: %.1f combines/frame, %.1f resolved, %.1f hits (%.0f%%)\n",
+         (combine_cache_stats.resolved + combine_cache_stats.hits) / (float)combine_cache_stats.frames,
+         combine_cache_stats.resolved / (float)combine_cache_stats.frames,
+         combine_cache_stats.hits / (float)combine_cache_stats.frames,
+         combine_cache_stats.hits * 100.0f /
+         MAX(1, combine_cache_stats.resolved + combine_cache_stats.hits));
+
+   memset(&combine_cache_stats, 0, sizeof(combine_cache_stats));
+#endif
+}
+
 //****************************************************************
 // Main Combine
 //****************************************************************
@@ -13933,6 +14062,8 @@ void Combine(void)
    uint32_t found, cmb_mode_a, cmb_mode_c;
    uint32_t actual_combine, current_combine, color_combine, alpha_combine;
    int left, right, current, last;
+   COMBINE_CACHE_ENTRY *entry;
+   COMBINE_KEY key;
 
 #if 0
    FRDP (" | |- color combine: %08lx, #1: (%s-%s)*%s+%s, #2: (%s-%s)*%s+%s\n",
@@ -13944,6 +14075,19 @@ void Combine(void)
          Alpha0[(rdp.cycle1>>16)&7], Alpha1[(rdp.cycle1>>19)&7], Alpha2[(rdp.cycle1>>22)&7], Alpha3[(rdp.cycle1>>25)&7],
          Alpha0[(rdp.cycle2>>16)&7], Alpha1[(rdp.cycle2>>19)&7], Alpha2[(rdp.cycle2>>22)&7], Alpha3[(rdp.cycle2>>25)&7]);
 #endif
+   memset(&key, 0, sizeof(key));
+   CombineCacheKey(&key);
+   entry = &combine_cache[CombineCacheHash(&key)];
+   if (entry->valid && !memcmp(&entry->key, &key, sizeof(key)))
+   {
+      CombineCacheRestore(entry);
+      combine_cache_stats.hits++;
+      grChromakeyMode(GR_CHROMAKEY_DISABLE);
+      LRDP(" | + Combine cached\n");
+      return;
+   }
+   combine_cache_stats.resolved++;
+
    if (!(gDP.otherMode.textureLOD) || rdp.cur_tile == gDP.otherMode.textureDetail)
       lod_frac = g_gdp.primitive_lod_frac;
    else if (settings.lodmode == 0)
@@ -14113,6 +14257,8 @@ void Combine(void)
    }
    cmb.shade_mod_hash = (rdp.cmb_flags + rdp.cmb_flags_2) * (g_gdp.prim_color.total + g_gdp.env_color.total + g_gdp.k5);
 
+   CombineCacheStore(entry, &key);
+
    LRDP(" | + Combine end\n");
 }
 
@@ -14297,6 +14443,7 @@ void InitCombine(void)
 {
    LOG ("InitCombine() ");
    memset(&cmb, 0, sizeof(cmb));
+   memset(combine_cache, 0, sizeof(combine_cache));
    LOG ("initialized.");
    cmb.dc0_lodbias = cmb.dc1_lodbias = 31;
    cmb.dc0_detailscale = cmb.dc1_detailscale = 7;
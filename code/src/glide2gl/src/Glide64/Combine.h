@@ -106,6 +106,7 @@ void Combine(void);
 void CombineBlender(void);
 void CountCombine(void);
 void InitCombine(void);
+void CombineCacheEndFrame(void);
 void ColorCombinerToExtension(void);
 void AlphaCombinerToExtension(void);
 void TexColorCombinerToExtension(int32_t tmu);
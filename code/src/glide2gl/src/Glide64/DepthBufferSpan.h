@@ -0,0 +1,56 @@
+/* Span writer of the software depth buffer render in Framebuffer_glide64.c,
+ * kept in its own file so that tools/depthspancmp.c can check it against
+ * the loop it replaced. Expects INLINE to be defined. */
+
+#define DEPTH_SPAN_LANES 8
+
+/* Writes one span of the triangle to the RDRAM depth buffer, keeping the
+ * nearer of the old and the new value. Each group of lanes first gets its
+ * z and LUT index in a loop with no branches or table accesses, then the
+ * LUT lookups and depth compares run one lane at a time. gcc vectorizes
+ * the first loop with SSE2 on x86-64; the wasm build is compiled without
+ * -msimd128 and runs it as scalar code. Lane z wraps exactly like the old
+ * z += dzdx per pixel. */
+static INLINE void DepthBufferSpan(uint16_t *ptr_dst, int shift, int z, int dzdx, int width, const uint16_t *lut)
+{
+   int x = 0;
+
+   for (; x + DEPTH_SPAN_LANES <= width; x += DEPTH_SPAN_LANES)
+   {
+      int lut_index[DEPTH_SPAN_LANES];
+      int i;
+
+      for (i = 0; i < DEPTH_SPAN_LANES; i++)
+      {
+         int trueZ = (int)((uint32_t)z + (uint32_t)i * (uint32_t)dzdx) / 8192;
+         trueZ = trueZ < 0 ? 0 : trueZ;
+         lut_index[i] = trueZ > 0x3FFFF ? 0x3FFFF : trueZ;
+      }
+
+      for (i = 0; i < DEPTH_SPAN_LANES; i++)
+      {
+         uint16_t encodedZ = lut[lut_index[i]];
+         int idx           = (shift + x + i) ^ 1;
+         if (encodedZ < ptr_dst[idx])
+            ptr_dst[idx] = encodedZ;
+      }
+
+      z = (int)((uint32_t)z + DEPTH_SPAN_LANES * (uint32_t)dzdx);
+   }
+
+   for (; x < width; x++)
+   {
+      int idx;
+      uint16_t encodedZ;
+      int trueZ = z / 8192;
+      if (trueZ < 0)
+         trueZ = 0;
+      else if (trueZ > 0x3FFFF)
+         trueZ = 0x3FFFF;
+      encodedZ = lut[trueZ];
+      idx = (shift+x)^1;
+      if(encodedZ < ptr_dst[idx]) 
+         ptr_dst[idx] = encodedZ;
+      z = (int)((uint32_t)z + (uint32_t)dzdx);
+   }
+}
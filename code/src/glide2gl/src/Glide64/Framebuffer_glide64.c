@@ -55,6 +55,7 @@
 #include "../Glitch64/glide.h"
 #include "GlideExtensions.h"
 #include "rdp.h"
+#include "DepthBufferSpan.h"
 
 #define ZLUT_SIZE 0x40000
 
@@ -295,28 +296,13 @@ static void DepthBufferRasterize(struct vertexi * vtx, int vertices, int dzdx)
       {
          /* Prestep initial z */
 
-         unsigned x;
          int       prestep = (x1 << 16) - left_x;
          int             z = left_z + IMUL16(prestep, dzdx);
          uint16_t *ptr_dst = (uint16_t*)(gfx_info.RDRAM + g_gdp.zb_address);
          int         shift = x1 + y1 * rdp.zi_width;
 
          /* draw to depth buffer */
-         for (x = 0; x < width; x++)
-         {
-            int idx;
-            uint16_t encodedZ;
-            int trueZ = z / 8192;
-            if (trueZ < 0)
-               trueZ = 0;
-            else if (trueZ > 0x3FFFF)
-               trueZ = 0x3FFFF;
-            encodedZ = zLUT[trueZ];
-            idx = (shift+x)^1;
-            if(encodedZ < ptr_dst[idx]) 
-               ptr_dst[idx] = encodedZ;
-            z += dzdx;
-         }
+         DepthBufferSpan(ptr_dst, shift, z, dzdx, width, zLUT);
       }
 
       y1++;
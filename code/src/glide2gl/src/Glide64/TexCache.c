@@ -50,6 +50,10 @@
 #include <clamping.h>
 #include <encodings/crc32.h>
 
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif
+
 #include "../../../Graphics/GBI.h"
 #include "../../../Graphics/RDP/gDP_state.h"
 #include "../../../Graphics/image_convert.h"
@@ -727,6 +731,282 @@ void TexCache(void)
    }
 }
 
+//****************************************************************
+// Disk cache
+//
+// Converted textures are appended to TEXDISK_FILE so the next session can
+// hand them straight to grTexSource instead of converting them from TMEM
+// again. The file is a magic number followed by records, each one a
+// TEXDISK_RECORD and the payload. Only the records are read when the file
+// is opened, a payload is read when LoadTex finds its key. The web frontend
+// keeps the file in IndexedDB between sessions, each sync only copies the
+// bytes written since the last one.
+
+#define TEXDISK_FILE "texcache.bin"
+#define TEXDISK_MAGIC 0x31435447 /* "GTC1" */
+#define TEXDISK_BUCKETS 4096
+#define TEXDISK_MAX_ENTRIES 16384
+#define TEXDISK_MAX_BYTES (128 << 20)
+#define TEXDISK_STATS_PERIOD 300
+#define TEXDISK_SYNC_PERIOD 600
+
+extern bool texture_disk_cache;
+
+/* everything the conversion in LoadTex depends on */
+typedef struct
+{
+   uint32_t crc;
+   uint32_t flags;
+   uint32_t format;
+   uint32_t width, height;
+   uint32_t load_width, load_height;
+   uint32_t real_x, real_y;
+   uint32_t wid_64, line;
+   uint32_t mod, modcolor, modcolor1, modcolor2, modfactor;
+} TEXDISK_KEY;
+
+typedef struct
+{
+   TEXDISK_KEY key;
+   uint32_t result;
+   uint32_t bytes;
+} TEXDISK_RECORD;
+
+typedef struct
+{
+   TEXDISK_RECORD record;
+   long offset;
+   int next;
+} TEXDISK_ENTRY;
+
+static struct
+{
+   FILE *file;
+   bool opened;
+   TEXDISK_ENTRY *entries;
+   int count;
+   int buckets[TEXDISK_BUCKETS];
+   long end;
+   unsigned frames, hits, misses, stored;
+   uint64_t bytes_read;
+   long synced;               // the frontend has the file up to here
+   unsigned unsynced_frames;
+} texdisk;
+
+static bool TexDiskKey(TEXDISK_KEY *key, int id, int td, uint32_t real_x, uint32_t real_y,
+      uint32_t mod, uint32_t modcolor, uint32_t modcolor1, uint32_t modcolor2, uint32_t modfactor)
+{
+   /* YUV is read from RDRAM so the crc doesn't cover it, the noise mod is random */
+   if (g_gdp.tile[td].format == G_IM_FMT_YUV || mod == TMOD_TEX_INTER_NOISE_USING_COL)
+      return false;
+
+   memset(key, 0, sizeof(*key));
+   key->crc         = texinfo[id].crc;
+   key->flags       = texinfo[id].flags;
+   key->format      = g_gdp.tile[td].format | (g_gdp.tile[td].size << 8) | (rdp.tlut_mode << 16);
+   key->width       = gDP.tiles[td].width;
+   key->height      = gDP.tiles[td].height;
+   key->load_width  = texinfo[id].width;
+   key->load_height = texinfo[id].height;
+   key->real_x      = real_x;
+   key->real_y      = real_y;
+   key->wid_64      = texinfo[id].wid_64;
+   key->line        = texinfo[id].line;
+   if (mod)
+   {
+      key->mod       = mod;
+      key->modcolor  = modcolor;
+      key->modcolor1 = modcolor1;
+      key->modcolor2 = modcolor2;
+      key->modfactor = modfactor;
+   }
+   return true;
+}
+
+static unsigned TexDiskHash(const TEXDISK_KEY *key)
+{
+   const uint32_t *w = (const uint32_t*)key;
+   uint32_t hash = 2166136261u;
+   unsigned i;
+
+   for (i = 0; i < sizeof(TEXDISK_KEY) / sizeof(uint32_t); i++)
+      hash = (hash ^ w[i]) * 16777619u;
+
+   return (hash ^ (hash >> 16)) & (TEXDISK_BUCKETS - 1);
+}
+
+static void TexDiskInsert(int index)
+{
+   unsigned hash = TexDiskHash(&texdisk.entries[index].record.key);
+
+   texdisk.entries[index].next = texdisk.buckets[hash];
+   texdisk.buckets[hash]       = index;
+}
+
+static TEXDISK_ENTRY *TexDiskFind(const TEXDISK_KEY *key)
+{
+   int i;
+
+   for (i = texdisk.buckets[TexDiskHash(key)]; i >= 0; i = texdisk.entries[i].next)
+      if (!memcmp(&texdisk.entries[i].record.key, key, sizeof(TEXDISK_KEY)))
+         return &texdisk.entries[i];
+
+   return NULL;
+}
+
+static void TexDiskOpen(void)
+{
+   uint32_t magic = 0;
+   long size;
+   int i;
+
+   texdisk.opened = true;
+   for (i = 0; i < TEXDISK_BUCKETS; i++)
+      texdisk.buckets[i] = -1;
+
+   texdisk.entries = (TEXDISK_ENTRY*)malloc(TEXDISK_MAX_ENTRIES * sizeof(TEXDISK_ENTRY));
+   if (!texdisk.entries)
+      return;
+
+   texdisk.file = fopen(TEXDISK_FILE, "r+b");
+   if (texdisk.file && (fread(&magic, sizeof(magic), 1, texdisk.file) != 1 || magic != TEXDISK_MAGIC))
+   {
+      /* unknown layout, start over */
+      fclose(texdisk.file);
+      texdisk.file = NULL;
+   }
+
+   texdisk.end = sizeof(magic);
+
+   if (!texdisk.file)
+   {
+      magic        = TEXDISK_MAGIC;
+      texdisk.file = fopen(TEXDISK_FILE, "w+b");
+      if (texdisk.file && fwrite(&magic, sizeof(magic), 1, texdisk.file) != 1)
+      {
+         fclose(texdisk.file);
+         texdisk.file = NULL;
+      }
+      if (!texdisk.file)
+         printf("texture cache: can't create %s\n", TEXDISK_FILE);
+      texdisk.synced = 0;
+      return;
+   }
+
+   fseek(texdisk.file, 0, SEEK_END);
+   size = ftell(texdisk.file);
+   fseek(texdisk.file, texdisk.end, SEEK_SET);
+
+   /* a record cut short by a failed write ends the file, it gets overwritten */
+   while (texdisk.count < TEXDISK_MAX_ENTRIES)
+   {
+      TEXDISK_ENTRY *entry = &texdisk.entries[texdisk.count];
+
+      if (fread(&entry->record, sizeof(TEXDISK_RECORD), 1, texdisk.file) != 1)
+         break;
+
+      entry->offset = texdisk.end + sizeof(TEXDISK_RECORD);
+      if (entry->record.bytes > sizeof(tex1) || entry->offset + (long)entry->record.bytes > size)
+         break;
+
+      fseek(texdisk.file, entry->record.bytes, SEEK_CUR);
+      TexDiskInsert(texdisk.count++);
+      texdisk.end = entry->offset + entry->record.bytes;
+   }
+   texdisk.synced = texdisk.end;
+
+   printf("texture cache: %d textures in %s\n", texdisk.count, TEXDISK_FILE);
+}
+
+static bool TexDiskLoad(const TEXDISK_KEY *key, uint32_t *result)
+{
+   TEXDISK_ENTRY *entry;
+
+   if (!texdisk.opened)
+      TexDiskOpen();
+   if (!texdisk.file)
+      return false;
+
+   entry = TexDiskFind(key);
+   if (!entry
+         || fseek(texdisk.file, entry->offset, SEEK_SET) != 0
+         || fread(texture, 1, entry->record.bytes, texdisk.file) != entry->record.bytes)
+   {
+      texdisk.misses++;
+      return false;
+   }
+
+   texdisk.hits++;
+   texdisk.bytes_read += entry->record.bytes;
+   *result = entry->record.result;
+   return true;
+}
+
+static void TexDiskStore(const TEXDISK_KEY *key, uint32_t result, const uint8_t *data, uint32_t bytes)
+{
+   TEXDISK_ENTRY *entry;
+
+   if (!texdisk.file || texdisk.count >= TEXDISK_MAX_ENTRIES ||
+         texdisk.end + sizeof(TEXDISK_RECORD) + bytes > TEXDISK_MAX_BYTES)
+      return;
+
+   entry                = &texdisk.entries[texdisk.count];
+   entry->record.key    = *key;
+   entry->record.result = result;
+   entry->record.bytes  = bytes;
+   entry->offset        = texdisk.end + sizeof(TEXDISK_RECORD);
+
+   if (fseek(texdisk.file, texdisk.end, SEEK_SET) != 0
+         || fwrite(&entry->record, sizeof(TEXDISK_RECORD), 1, texdisk.file) != 1
+         || fwrite(data, 1, bytes, texdisk.file) != bytes)
+   {
+      printf("texture cache: can't write %s, disabled\n", TEXDISK_FILE);
+      fclose(texdisk.file);
+      texdisk.file = NULL;
+      return;
+   }
+
+   TexDiskInsert(texdisk.count++);
+   texdisk.end       = entry->offset + bytes;
+   texdisk.stored++;
+   texdisk.unsynced_frames = 0;
+}
+
+void TexCacheEndFrame(void)
+{
+   if (!texdisk.file)
+      return;
+
+   /* let the frontend copy what was appended to persistent storage
+    * once no new texture was stored for TEXDISK_SYNC_PERIOD frames */
+   if (texdisk.end > texdisk.synced && ++texdisk.unsynced_frames >= TEXDISK_SYNC_PERIOD)
+   {
+      fflush(texdisk.file);
+#ifdef __EMSCRIPTEN__
+      EM_ASM({
+         myApp.TexCacheEvent($0, $1);
+      }, texdisk.synced, texdisk.end);
+#endif
+      texdisk.synced          = texdisk.end;
+      texdisk.unsynced_frames = 0;
+   }
+
+#ifdef PERF_STATS
+   if (++texdisk.frames < TEXDISK_STATS_PERIOD)
+      return;
+
+   if (texdisk.hits || texdisk.misses)
+      printf("texture cache: %u disk hits, %u misses, %u stored, %.1f KB read\n",
+            texdisk.hits, texdisk.misses, texdisk.stored, texdisk.bytes_read / 1024.0);
+
+   texdisk.frames     = 0;
+   texdisk.hits       = 0;
+   texdisk.misses     = 0;
+   texdisk.stored     = 0;
+   texdisk.bytes_read = 0;
+#endif
+}
+
 // Does the actual texture loading after everything is prepared
 static void LoadTex(int id, int tmu)
 {
@@ -734,6 +1014,8 @@ static void LoadTex(int id, int tmu)
    uint32_t size_x, size_y, real_x, real_y, result;
    uint32_t mod, modcolor, modcolor1, modcolor2, modfactor;
    CACHE_LUT *cache;
+   TEXDISK_KEY disk_key;
+   bool disk_cacheable = false;
    int td = rdp.cur_tile + id;
 
    if (texinfo[id].width < 0 || texinfo[id].height < 0)
@@ -1123,6 +1405,14 @@ static void LoadTex(int id, int tmu)
 
    texture = (uint8_t *)tex1;
 
+   if (texture_disk_cache)
+   {
+      disk_cacheable = TexDiskKey(&disk_key, id, td, real_x, real_y,
+            mod, modcolor, modcolor1, modcolor2, modfactor);
+      if (disk_cacheable && TexDiskLoad(&disk_key, &result))
+         goto converted;
+   }
+
    {
       uint32_t size;
       int min_x, min_y;
@@ -1671,7 +1961,11 @@ static void LoadTex(int id, int tmu)
       }
    }
 
+   if (disk_cacheable)
+      TexDiskStore(&disk_key, result, texture,
+            grTexCalcMemRequired(lod, aspect, LOWORD(result)));
 
+converted:
    cache->t_info.format = LOWORD(result);
    cache->realwidth     = real_x;
    cache->realheight    = real_y;
@@ -49,6 +49,7 @@ extern "C" {
 void TexCacheInit(void);
 void TexCache(void);
 void ClearCache(void);
+void TexCacheEndFrame(void);
 
 extern uint8_t * texture_buffer;
 
@@ -8,424 +8,7 @@
 #include "../../Graphics/RDP/gDP_state.h"
 #include "../../Graphics/image_convert.h"
 
-#define ALOWORD(x)   (*((uint16_t*)&x))   // low word
-
-static INLINE void load4bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, uint16_t line, int ext, uint16_t *palette)
-{
-    uint32_t *src32 =(uint32_t*)src;
-    uint32_t *dst32 =(uint32_t*)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            uint32_t v12 = m64p_swap32(src32[odd]);
-            uint32_t v16 = m64p_swap32(src32[!odd]);
-            uint32_t pix = width + 1;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 23) & 0x1E)), 1);
-            pix = pix << 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 27) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 15) & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 19) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 7) & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 11) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint8_t)v12 & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 3) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 23) & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 27) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 15) & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 19) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 7) & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 11) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint8_t)v16 & 0x1E)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 3) & 0x1E)), 1);
-            *dst32++ = pix;
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
-        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
-
-        odd ^= 1;
-    }
-}
-
-static INLINE void load4bIAPal(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
-{
-    uint32_t *src32 =(uint32_t*)src;
-    uint32_t *dst32 =(uint32_t*)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-        while (width--)
-        {
-            uint32_t ab = m64p_swap32(src32[odd]);
-            uint32_t cd = m64p_swap32(src32[!odd]);
-            uint32_t pix = width + 1;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 23) & 0x1E)), 8);
-            pix = pix << 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 27) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 15) & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 19) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 7) & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 11) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + (2 *(uint8_t)ab & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 3) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 23) & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 27) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 15) & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 19) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 7) & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 11) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + (2 *(uint8_t)cd & 0x1E)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 3) & 0x1E)), 8);
-            *dst32++ = pix;
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
-        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
-
-        odd ^= 1;
-    }
-}
-
-static INLINE void load4bIA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-   unsigned odd = 0;
-   uint32_t *src32 = (uint32_t*)src;
-   uint32_t *dst32 = (uint32_t*)dst;
-
-   while (height--)
-   {
-      int count = wid_64;
-      while (count--)
-      {
-         uint32_t v1, v2, v3, v4, v5, v6, v7, v8, v9, v10;
-
-#define do_load4biA \
-         v2 = v1;\
-         v3 = (8 * (v1 & 0x100000)) | (4 * (v1 & 0x100000)) | (2 * (v1 & 0x100000)) | (v1 & 0x100000) | ((((v1 >> 16) & 0xE00) >> 3) & 0x100) | ((v1 >> 16) & 0xE00) | (8 * ((v1 >> 12) & 0x1000)) | (4 * ((v1 >> 12) & 0x1000)) | (2 * ((v1 >> 12) & 0x1000)) | ((v1 >> 12) & 0x1000) | ((((v1 >> 28) & 0xE) >> 3)) | ((v1 >> 28) & 0xE) | (8 * ((v1 >> 24) & 0x10)) | (4 * ((v1 >> 24) & 0x10)) | (2 * ((v1 >> 24) & 0x10)) | ((v1 >> 24) & 0x10);\
-         v1 = (v1 >> 4) & 0xE0000u;\
-         v4 = v1 | v3;\
-         v1 >>= 3;\
-         *dst32++ = ((((v2 << 8) & 0xE000000) >> 3) & 0x1000000) | ((v2 << 8) & 0xE000000) | (8 * ((v2 << 12) & 0x10000000)) | (4 * ((v2 << 12) & 0x10000000)) | (2 * ((v2 << 12) & 0x10000000)) | ((v2 << 12) & 0x10000000) | (v1 & 0x10000) | v4;\
-         \
-         v5 = 16 * (uint16_t)v2 & 0x1000;\
-         v6 = (((v2 & 0xE00) >> 3) & 0x100) | (v2 & 0xE00) | (8 * v5) | (4 * v5) | (2 * v5) | (v5) | ((((v2 >> 12) & 0xE) >> 3)) | ((v2 >> 12) & 0xE) | (8 * ((v2 >> 8) & 0x10)) | (4 * ((v2 >> 8) & 0x10)) | (2 * ((v2 >> 8) & 0x10)) | ((v2 >> 8) & 0x10);\
-         v7 = v2 << 16;\
-         v8 = (8 * (v7 & 0x100000)) | (4 * (v7 & 0x100000)) | (2 * (v7 & 0x100000)) | (v7 & 0x100000) | v6;\
-         v9 = (v2 << 12) & 0xE0000u;\
-         v10 = v9 | v8;\
-         v9 >>= 3;\
-         *dst32++ = ((((v2 << 24) & 0xE000000) >> 3) & 0x1000000) | ((v2 << 24) & 0xE000000) | (8 * ((v2 << 28) & 0x10000000)) | (4 * ((v2 << 28) & 0x10000000)) | (2 * ((v2 << 28) & 0x10000000)) | ((v2 << 28) & 0x10000000) | (v9 & 0x10000) | v10
-
-         v1 = m64p_swap32(src32[odd]);
-         do_load4biA;
-
-         v1 = m64p_swap32(src32[!odd]);
-
-         do_load4biA;
-#undef do_load4biA
-
-         src32 += 2;
-      }
-
-      src32 = (uint32_t*)((char*)src32 + line);
-      dst32 = (uint32_t*)((char*)dst32 + ext);
-      odd ^= 1;
-   }
-}
-
-static INLINE void load4bI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-    uint32_t *src32 =(uint32_t*)src;
-    uint32_t *dst32 =(uint32_t*)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            uint32_t ab = m64p_swap32(src32[odd]);
-            uint32_t cd = m64p_swap32(src32[!odd]);
-            uint32_t pix;
-
-            pix = ab >> 4;
-            *dst32++ = (16 * ((ab << 8) & 0xF000000)) | ((ab << 8) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * ((ab >> 16) & 0xF00)) | ((ab >> 16) & 0xF00) | (16 * (ab >> 28)) | (ab >> 28);
-
-            pix = ab << 12;
-            *dst32++ = (16 * ((ab << 24) & 0xF000000)) | ((ab << 24) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * (ab & 0xF00)) | (ab & 0xF00) | (16 * ((uint16_t)ab >> 12)) | ((uint16_t)ab >> 12);
-
-            pix = cd >> 4;
-            *dst32++ = (16 * ((cd << 8) & 0xF000000)) | ((cd << 8) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * ((cd >> 16) & 0xF00)) | ((cd >> 16) & 0xF00) | (16 * (cd >> 28)) | (cd >> 28);
-
-            pix = cd << 12;
-            *dst32++ = (16 * ((cd << 24) & 0xF000000)) | ((cd << 24) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * (cd & 0xF00)) | (cd & 0xF00) | (16 * ((uint16_t)cd >> 12)) | ((uint16_t)cd >> 12);
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)((uint8_t*)src32 + line);
-        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
-        odd ^= 1;
-    }
-}
-
-static INLINE void load8bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
-{
-    uint32_t *src32 =(uint32_t*)src;
-    uint32_t *dst32 =(uint32_t *)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            uint32_t abcd = m64p_swap32(src32[odd]);
-            uint32_t efgh = m64p_swap32(src32[!odd]);
-            uint32_t pix = width + 1;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 15) & 0x1FE)), 1);
-            pix = pix << 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 23) & 0x1FE)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint16_t)abcd & 0x1FE)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 7) & 0x1FE)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 15) & 0x1FE)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 23) & 0x1FE)), 1);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint16_t)efgh & 0x1FE)), 1);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 7) & 0x1FE)), 1);
-            *dst32++ = pix;
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
-        dst32 =(uint32_t*)((char *)dst32 + ext);
-
-        odd ^= 1;
-    }
-}
-
-static INLINE void load8bIA8(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
-{
-    uint32_t *src32 =(uint32_t *)src;
-    uint32_t *dst32 =(uint32_t *)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            uint32_t abcd = m64p_swap32(src32[odd]);
-            uint32_t efgh = m64p_swap32(src32[!odd]);
-            uint32_t pix  = width + 1;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 15) & 0x1FE)), 8);
-            pix = pix << 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 23) & 0x1FE)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + (2 *(uint16_t)abcd & 0x1FE)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 7) & 0x1FE)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 15) & 0x1FE)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 23) & 0x1FE)), 8);
-            *dst32++ = pix;
-
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + (2 *(uint16_t)efgh & 0x1FE)), 8);
-            pix <<= 16;
-            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 7) & 0x1FE)), 8);
-            *dst32++ = pix;
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t *)((uint8_t*)src32 + line);
-        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
-        odd ^= 1;
-    }
-}
-
-static INLINE void load8bIA4(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-    uint32_t *src32 =(uint32_t *)src;
-    uint32_t *dst32 =(uint32_t *)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while(width--)
-        {
-            uint32_t ab = src32[odd];
-            uint32_t cd = src32[!odd];
-
-            *dst32++ = (16 * ab & 0xF0F0F0F0) | ((ab >> 4) & 0xF0F0F0F);
-            *dst32++ = (16 * cd & 0xF0F0F0F0) | ((cd >> 4) & 0xF0F0F0F);
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t *)((uint8_t*)src32 + line);
-        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
-        odd ^= 1;
-    }
-}
-
-static INLINE void load8bI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-    uint32_t *src32 =(uint32_t *)src;
-    uint32_t *dst32 =(uint32_t *)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            *dst32++ = src32[odd];
-            *dst32++ = src32[!odd];
-            src32 += 2;
-        }
-
-        src32 =(uint32_t *)((uint8_t*)src32 + line);
-        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
-        odd ^= 1;
-    }
-}
-
-
-static INLINE void load16bRGBA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-    uint32_t *src32 =(uint32_t*)src;
-    uint32_t *dst32 =(uint32_t*)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            uint32_t ab = m64p_swap32(src32[odd]);
-            uint32_t cd = m64p_swap32(src32[!odd]);
-
-            ALOWORD(ab) = ror16((uint16_t)ab, 1);
-            ALOWORD(cd) = ror16((uint16_t)cd, 1);
-            ab = ror32(ab, 16);
-            cd = ror32(cd, 16);
-            ALOWORD(ab) = ror16((uint16_t)ab, 1);
-            ALOWORD(cd) = ror16((uint16_t)cd, 1);
-
-            *dst32++ = ab;
-            *dst32++ = cd;
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0xFFF];
-        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
-
-        odd ^= 1;
-    }
-}
-
-static INLINE void load16bIA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
-{
-    uint32_t *src32 =(uint32_t *)src;
-    uint32_t *dst32 =(uint32_t *)dst;
-    unsigned odd = 0;
-
-    while (height--)
-    {
-        int width = wid_64;
-
-        while (width--)
-        {
-            *dst32++ = src32[odd];
-            *dst32++ = src32[!odd];
-
-            src32 += 2;
-        }
-
-        src32 =(uint32_t*)((uint8_t*)src32 + line);
-        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
-
-        odd ^= 1;
-    }
-}
+#include "TexLoadRow.h"
 
 static uint32_t LoadNone(uintptr_t dst, uintptr_t src, int wid_64, int height, int line, int real_width, int tile)
 {
@@ -904,17 +487,6 @@ static INLINE void load_block_line(uint32_t *src, uint32_t *dst,
    }
 }
 
-static INLINE void dxt_swap(uint32_t *line, int width)
-{
-   while (width--)
-   {
-      line[0] ^= line[1];
-      line[1] ^= line[0];
-      line[0] ^= line[1];
-      line += 2;
-   }
-}
-
 void loadTile(uint32_t *src, uint32_t *dst,
       int width, int height, int line, int off, uint32_t *end)
 {
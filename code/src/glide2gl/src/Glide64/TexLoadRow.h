@@ -0,0 +1,254 @@
+/* TMEM row converters of TexLoad.c, kept in their own file so that
+ * tools/texloadcmp.c can check them against the converters they replaced.
+ * Expects INLINE and ror16() from Util.h to be defined. */
+
+/* The converters below work a row at a time. TMEM keeps every other row
+ * with the 32-bit words of each 64-bit word swapped, so a row is read as
+ * a byte or word stream with that swizzle folded into the index, and the
+ * per texel work is a few shifts and masks with no branches. The swizzled
+ * index keeps gcc from vectorizing the texel loops (only dxt_swap() is),
+ * and the wasm build is compiled without -msimd128, so what these save
+ * over the old converters is the per word unpacking, not SIMD width. */
+
+static INLINE void load4bPalRow(const uint8_t *src, uint16_t *dst, int wid_64, unsigned swizzle, const uint16_t *palette, uint16_t rot)
+{
+    int i;
+
+    for (i = 0; i < (wid_64 << 3); i++)
+    {
+        uint8_t b = src[i ^ swizzle];
+        dst[2 * i]     = ror16(palette[b >> 4], rot);
+        dst[2 * i + 1] = ror16(palette[b & 0xF], rot);
+    }
+}
+
+static INLINE void load8bPalRow(const uint8_t *src, uint16_t *dst, int wid_64, unsigned swizzle, const uint16_t *palette, uint16_t rot)
+{
+    int i;
+
+    for (i = 0; i < (wid_64 << 3); i++)
+        dst[i] = ror16(palette[src[i ^ swizzle]], rot);
+}
+
+static INLINE void load4bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, uint16_t line, int ext, uint16_t *palette)
+{
+    uintptr_t offset = 0;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        load4bPalRow(src + offset, (uint16_t*)dst, wid_64, odd << 2, palette, 1);
+
+        offset = (offset + (wid_64 << 3) + line) & 0x7FF;
+        dst   += (wid_64 << 5) + ext;
+        odd   ^= 1;
+    }
+}
+
+static INLINE void load4bIAPal(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    uintptr_t offset = 0;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        load4bPalRow(src + offset, (uint16_t*)dst, wid_64, odd << 2, palette, 8);
+
+        offset = (offset + (wid_64 << 3) + line) & 0x7FF;
+        dst   += (wid_64 << 5) + ext;
+        odd   ^= 1;
+    }
+}
+
+static INLINE void load4bIA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+   unsigned odd = 0;
+
+   while (height--)
+   {
+      int i;
+      unsigned swizzle = odd << 2;
+
+      /* IA31 -> IA44: intensity widened to 4 bits, alpha bit to a nibble */
+      for (i = 0; i < (wid_64 << 3); i++)
+      {
+         uint8_t b  = src[i ^ swizzle];
+         uint8_t hi = b >> 4;
+         uint8_t lo = b & 0xF;
+         dst[2 * i]     = (hi & 0xE) | (hi >> 3) | ((hi & 1) * 0xF0);
+         dst[2 * i + 1] = (lo & 0xE) | (lo >> 3) | ((lo & 1) * 0xF0);
+      }
+
+      src += (wid_64 << 3) + line;
+      dst += (wid_64 << 4) + ext;
+      odd ^= 1;
+   }
+}
+
+static INLINE void load4bI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int i;
+        unsigned swizzle = odd << 2;
+
+        /* I4 -> IA44 with the intensity in both nibbles */
+        for (i = 0; i < (wid_64 << 3); i++)
+        {
+            uint8_t b = src[i ^ swizzle];
+            dst[2 * i]     = (b >> 4) * 0x11;
+            dst[2 * i + 1] = (b & 0xF) * 0x11;
+        }
+
+        src += (wid_64 << 3) + line;
+        dst += (wid_64 << 4) + ext;
+        odd ^= 1;
+    }
+}
+
+static INLINE void load8bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    uintptr_t offset = 0;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        load8bPalRow(src + offset, (uint16_t*)dst, wid_64, odd << 2, palette, 1);
+
+        offset = (offset + (wid_64 << 3) + line) & 0x7FF;
+        dst   += (wid_64 << 4) + ext;
+        odd   ^= 1;
+    }
+}
+
+static INLINE void load8bIA8(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        load8bPalRow(src, (uint16_t*)dst, wid_64, odd << 2, palette, 8);
+
+        src += (wid_64 << 3) + line;
+        dst += (wid_64 << 4) + ext;
+        odd ^= 1;
+    }
+}
+
+static INLINE void load8bIA4(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uint32_t *src32 =(uint32_t *)src;
+    uint32_t *dst32 =(uint32_t *)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while(width--)
+        {
+            uint32_t ab = src32[odd];
+            uint32_t cd = src32[!odd];
+
+            *dst32++ = (16 * ab & 0xF0F0F0F0) | ((ab >> 4) & 0xF0F0F0F);
+            *dst32++ = (16 * cd & 0xF0F0F0F0) | ((cd >> 4) & 0xF0F0F0F);
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t *)((uint8_t*)src32 + line);
+        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
+        odd ^= 1;
+    }
+}
+
+static INLINE void load8bI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uint32_t *src32 =(uint32_t *)src;
+    uint32_t *dst32 =(uint32_t *)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            *dst32++ = src32[odd];
+            *dst32++ = src32[!odd];
+            src32 += 2;
+        }
+
+        src32 =(uint32_t *)((uint8_t*)src32 + line);
+        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
+        odd ^= 1;
+    }
+}
+
+
+/* RGBA5551 -> ARGB1555 for both texels of a word: byte swap each half,
+ * then rotate it right by one */
+static INLINE uint32_t rgba16_to_argb1555(uint32_t w)
+{
+    uint32_t s = ((w & 0x00FF00FF) << 8) | ((w >> 8) & 0x00FF00FF);
+    return ((s >> 1) & 0x7FFF7FFF) | ((s & 0x00010001) << 15);
+}
+
+static INLINE void load16bRGBA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uintptr_t offset = 0;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        const uint32_t *src32 = (const uint32_t*)(src + offset);
+        uint32_t *dst32       = (uint32_t*)dst;
+        int i;
+
+        for (i = 0; i < (wid_64 << 1); i++)
+            dst32[i] = rgba16_to_argb1555(src32[i ^ odd]);
+
+        offset = (offset + (wid_64 << 3) + line) & 0xFFF;
+        dst   += (wid_64 << 3) + ext;
+        odd   ^= 1;
+    }
+}
+
+static INLINE void load16bIA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uint32_t *src32 =(uint32_t *)src;
+    uint32_t *dst32 =(uint32_t *)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            *dst32++ = src32[odd];
+            *dst32++ = src32[!odd];
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)((uint8_t*)src32 + line);
+        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
+
+        odd ^= 1;
+    }
+}
+
+static INLINE void dxt_swap(uint32_t *line, int width)
+{
+   int i;
+
+   for (i = 0; i < width; i++)
+   {
+      uint32_t tmp    = line[2 * i];
+      line[2 * i]     = line[2 * i + 1];
+      line[2 * i + 1] = tmp;
+   }
+}
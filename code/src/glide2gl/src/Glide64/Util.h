@@ -73,6 +73,13 @@ void apply_shade_modulation(VERTEX *v);
 
 void update(void);
 void update_scissor(bool set_scissor);
+void TriangleStatsEndFrame(void);
+
+/* display list replay, see glide64_rdp.c */
+extern bool dlist_cache_recording;
+void DListCacheRecordTriangles(VERTEX **v, unsigned count);
+void DListCacheRecordDraw(uint32_t mode, uint32_t count, VERTEX *v);
+void DListCacheRecordDepthBias(int32_t level);
 
 float ScaleZ(float z);
 
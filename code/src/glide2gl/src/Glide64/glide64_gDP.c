@@ -155,6 +155,8 @@ static void glide64gDPLLETriangle(uint32_t w0, uint32_t w1, int shade, int textu
 
    yh &= ~3;
 
+   if (rdp.skip_frame)
+      return;
 
    if (shade)
    {
@@ -713,7 +715,7 @@ void glide64gDPFillRectangle(uint32_t ul_x, uint32_t ul_y, uint32_t lr_x, uint32
    }
 
    /* Fillrect skipped */
-   if (rdp.skip_drawing)
+   if (rdp.skip_drawing || rdp.skip_frame)
       return;
 
    /* Update scissor */
@@ -451,6 +451,11 @@ static INLINE void pre_update(void)
    }
 }
 
+void glide64gSPPreUpdate(void)
+{
+   pre_update();
+}
+
 /*
  * Loads into the RSP vertex buffer the vertices that will be used by the 
  * gSP1Triangle commands to generate polygons.
@@ -465,6 +470,11 @@ void glide64gSPVertex(uint32_t v, uint32_t n, uint32_t v0)
    float x, y, z;
    uint32_t iter = 16;
    void   *vertex  = (void*)(gfx_info.RDRAM + v);
+   /* fixed for the whole load, don't test it per vertex */
+   bool point_lighting = settings.ucode == 2 && (gSP.geometryMode & G_POINT_LIGHTING);
+
+   if (dlist_cache_recording)
+      DListCacheRecordVertex(v, n, v0);
 
    pre_update();
 
@@ -508,7 +518,7 @@ void glide64gSPVertex(uint32_t v, uint32_t n, uint32_t v0)
          vtx->vec[1] = (int8_t)color[2];
          vtx->vec[2] = (int8_t)color[1];
 
-         if (settings.ucode == 2 && gSP.geometryMode & G_POINT_LIGHTING)
+         if (point_lighting)
          {
             float tmpvec[3] = {x, y, z};
             glide64gSPPointLightVertex(vtx, tmpvec);
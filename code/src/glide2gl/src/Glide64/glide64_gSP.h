@@ -33,6 +33,9 @@ extern int dzdx;
 extern int deltaZ;
 
 void cull_trianglefaces(VERTEX **v, unsigned iterations, bool do_update, bool do_cull, int32_t wd);
+void glide64gSPPreUpdate(void);
+extern bool dlist_cache_recording;
+void DListCacheRecordVertex(uint32_t addr, uint32_t n, uint32_t v0);
 void glide64gSPLightVertex(void *data);
 void glide64gSPDMATriangles(uint32_t tris, uint32_t n);
 void glide64gSPSetDMAOffsets(uint32_t mtxoffset, uint32_t vtxoffset);
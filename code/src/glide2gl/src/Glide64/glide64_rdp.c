@@ -37,7 +37,9 @@
 //****************************************************************
 
 #include <math.h>
+#include <stddef.h>
 #include <encodings/crc32.h>
+#include <features/features_cpu.h>
 #include "Gfx_1.3.h"
 #include "3dmath.h"
 #include "Util.h"
@@ -311,6 +313,10 @@ input:    none
 output:   none
 *******************************************************************/
 void DetectFrameBufferUsage(void);
+static void DetectFrameBufferSignature(uint32_t w0, uint32_t w1);
+static void DetectFrameBufferVerify(void);
+static void DListCacheStep(uint32_t a, uint32_t pci);
+static void DListCacheEndFrame(void);
 uint32_t fbreads_front = 0;
 uint32_t fbreads_back = 0;
 int cpu_fb_read_called = false;
@@ -322,10 +328,158 @@ uint32_t swapped_addr = 0;
 int depth_buffer_fog;
 
 extern bool frame_dupe;
+extern bool skip_render;
+extern unsigned skip_render_count;
+extern int dlist_replay_mode;
+
+/* The display list interpreter. Every list is run by a loop specialized
+ * for its microcode: the command table row is a constant, and whether
+ * frame buffer detection and the replay cache run is decided once per
+ * list rather than tested on every command. Returns the number of
+ * commands executed. */
+static INLINE uint32_t dlist_interpret(const int ucode, const bool fb_detect, const bool replay)
+{
+   rdp_instr *table = gfx_instruction[ucode];
+   uint32_t a, pci;
+   uint32_t count   = 0;
+
+   do
+   {
+      /* Get the address of the next command */
+      a        = __RSP.PC[__RSP.PCi] & BMASK;
+
+      /* Load the next command and its input */
+      __RSP.w0 = ((uint32_t*)gfx_info.RDRAM)[a>>2];   // \ Current command, 64 bit
+      __RSP.w1 = ((uint32_t*)gfx_info.RDRAM)[(a>>2)+1]; // /
+      /* RDP state's w2 and w3 are filled only when needed, by the function that needs them */
+
+#ifdef LOG_COMMANDS
+      // Output the address before the command
+      FRDP ("%08lx (c0:%08lx, c1:%08lx): ", a, __RSP.w0, __RSP.w1);
+#endif
+
+      // Go to the next instruction
+      __RSP.PC[__RSP.PCi] = (a+8) & BMASK;
+
+      if (fb_detect)
+         DetectFrameBufferSignature(__RSP.w0, __RSP.w1);
+
+      // Process this instruction
+      pci = __RSP.PCi;
+      table[__RSP.w0 >> 24](__RSP.w0, __RSP.w1);
+
+      RSP_CheckDLCounter();
+
+      if (replay)
+         DListCacheStep(a, pci);
+
+      count++;
+   } while (!__RSP.halt);
+
+   return count;
+}
+
+#define DLIST_INTERPRETER(name, ucode) \
+static uint32_t name(bool fb_detect, bool replay) \
+{ \
+   if (fb_detect) \
+      return replay ? dlist_interpret(ucode, true, true) : dlist_interpret(ucode, true, false); \
+   return replay ? dlist_interpret(ucode, false, true) : dlist_interpret(ucode, false, false); \
+}
+
+DLIST_INTERPRETER(dlist_interpret_f3d,    ucode_Fast3D)
+DLIST_INTERPRETER(dlist_interpret_f3dex,  ucode_F3DEX)
+DLIST_INTERPRETER(dlist_interpret_f3dex2, ucode_F3DEX2)
+DLIST_INTERPRETER(dlist_interpret_s2dex,  ucode_S2DEX)
+
+/* the less common microcodes share one loop indexed at run time */
+static uint32_t dlist_interpret_any(bool fb_detect, bool replay)
+{
+   return dlist_interpret(settings.ucode, fb_detect, replay);
+}
+
+#ifdef PERF_STATS
+#define DLIST_STATS_PERIOD 300
+#define DLIST_STATS_UCODES 12
+
+static const char *dlist_ucode_names[DLIST_STATS_UCODES] = {
+   "F3D", "F3DEX", "F3DEX2", "WaveRace", "StarWars", "DiddyKong",
+   "S2DEX", "PerfectDark", "CBFD", "ZSort", "F3DTEXA", "F3DEX2ACCLAIM"
+};
+
+static struct
+{
+   uint32_t frames;
+   uint64_t commands[DLIST_STATS_UCODES];
+   retro_time_t usec[DLIST_STATS_UCODES];
+} dlist_stats;
+#endif
+
+static void DListRun(void)
+{
+   bool fb_detect = fb_emulation_enabled;
+   bool replay    = dlist_replay_mode != 0;
+#ifdef PERF_STATS
+   retro_time_t start = cpu_features_get_time_usec();
+#endif
+   uint32_t count;
+
+   switch (settings.ucode)
+   {
+      case ucode_Fast3D:
+         count = dlist_interpret_f3d(fb_detect, replay);
+         break;
+      case ucode_F3DEX:
+         count = dlist_interpret_f3dex(fb_detect, replay);
+         break;
+      case ucode_F3DEX2:
+         count = dlist_interpret_f3dex2(fb_detect, replay);
+         break;
+      case ucode_S2DEX:
+         count = dlist_interpret_s2dex(fb_detect, replay);
+         break;
+      default:
+         count = dlist_interpret_any(fb_detect, replay);
+         break;
+   }
+
+#ifdef PERF_STATS
+   if (settings.ucode >= 0 && settings.ucode < DLIST_STATS_UCODES)
+   {
+      dlist_stats.commands[settings.ucode] += count;
+      dlist_stats.usec[settings.ucode]     += cpu_features_get_time_usec() - start;
+   }
+#else
+   (void)count;
+#endif
+}
+
+static void DListStatsEndFrame(void)
+{
+#ifdef PERF_STATS
+   int i;
+
+   if (++dlist_stats.frames < DLIST_STATS_PERIOD)
+      return;
+
+   for (i = 0; i < DLIST_STATS_UCODES; i++)
+   {
+      if (!dlist_stats.commands[i])
+         continue;
+
+      printf("display lists: %s %.1f commands/frame, %.2fM commands/s\n",
+            dlist_ucode_names[i],
+            dlist_stats.commands[i] / (float)dlist_stats.frames,
+            dlist_stats.commands[i] / (double)MAX(1, dlist_stats.usec[i]));
+   }
+
+   memset(&dlist_stats, 0, sizeof(dlist_stats));
+#endif
+}
 
 void glide64ProcessDList(void)
 {
-  uint32_t dlist_start, dlist_length, a;
+  uint32_t dlist_start, dlist_length;
 
   no_dlist            = false;
   update_screen_count = 0;
@@ -354,6 +508,15 @@ void glide64ProcessDList(void)
   if (exception)
     return;
 
+  /* frame that won't be shown, only the full sync at the end of the
+   * list matters to the game */
+  if (skip_render && settings.render_skip)
+  {
+    skip_render_count++;
+    gdp_full_sync(__RSP.w0, __RSP.w1);
+    return;
+  }
+
   /* Set states */
   if (settings.swapmode > 0)
     SwapOK                            = true;
@@ -371,6 +534,7 @@ void glide64ProcessDList(void)
   gSP.geometryMode                    = 0;
   rdp.maincimg[1]                     = rdp.maincimg[0];
   rdp.skip_drawing                    = false;
+  rdp.skip_frame                      = false;
   rdp.s2dex_tex_loaded                = false;
   rdp.bg_image_height                 = 0xFFFF;
   fbreads_front                       = 0;
@@ -399,6 +563,16 @@ void glide64ProcessDList(void)
     DetectFrameBufferUsage();
   if (!(settings.hacks&hack_Lego) || rdp.num_of_ci > 1)
     rdp.last_bg = 0;
+
+  /* games that opted out of dropping the whole list still run it, but
+   * nothing is drawn unless the frame buffer is going to be read back */
+  if (skip_render && settings.buff_clear && !(settings.frame_buffer & fb_ref))
+  {
+    rdp.skip_frame = !fb_emulation_enabled ||
+       (rdp.num_of_ci <= 1 && !rdp.read_whole_frame && !rdp.motionblur && !rdp.copy_zi_index);
+    if (rdp.skip_frame)
+      skip_render_count++;
+  }
   //* End of set states *//
 
   // Get the start of the display list and the length of it
@@ -429,31 +603,18 @@ void glide64ProcessDList(void)
   else
   {
      /* MAIN PROCESSING LOOP */
-     do
-     {
-        /* Get the address of the next command */
-        a        = __RSP.PC[__RSP.PCi] & BMASK;
-
-        /* Load the next command and its input */
-        __RSP.w0 = ((uint32_t*)gfx_info.RDRAM)[a>>2];   // \ Current command, 64 bit
-        __RSP.w1 = ((uint32_t*)gfx_info.RDRAM)[(a>>2)+1]; // /
-        /* RDP state's w2 and w3 are filled only when needed, by the function that needs them */
-
-#ifdef LOG_COMMANDS
-        // Output the address before the command
-        FRDP ("%08lx (c0:%08lx, c1:%08lx): ", a, __RSP.w0, __RSP.w1);
-#endif
-
-        // Go to the next instruction
-        __RSP.PC[__RSP.PCi] = (a+8) & BMASK;
+     DListRun();
 
-        // Process this instruction
-        gfx_instruction[settings.ucode][__RSP.w0 >> 24](__RSP.w0, __RSP.w1);
-
-        RSP_CheckDLCounter();
-     } while (!__RSP.halt);
+     if (fb_emulation_enabled)
+        DetectFrameBufferVerify();
   }
 
+  CombineCacheEndFrame();
+  TexCacheEndFrame();
+  TriangleStatsEndFrame();
+  DListCacheEndFrame();
+  DListStatsEndFrame();
+
   if (fb_emulation_enabled)
   {
     rdp.scale_x = rdp.scale_x_bak;
@@ -617,7 +778,7 @@ static void rdp_texrect(uint32_t w0, uint32_t w1)
       return;
    }
 
-   if (rdp.skip_drawing || (!fb_emulation_enabled && (gDP.colorImage.address == g_gdp.zb_address)) || __RDP.w3 == 0)
+   if (rdp.skip_drawing || rdp.skip_frame || (!fb_emulation_enabled && (gDP.colorImage.address == g_gdp.zb_address)) || __RDP.w3 == 0)
    {
       if ((settings.hacks&hack_PMario) && rdp.ci_status == CI_USELESS)
          colorimage_palette_modification();
@@ -1749,16 +1910,237 @@ void glide64FBGetFrameBufferInfo(void *p)
 
 #include "ucodeFB.h"
 
+/* Most frames draw to the same color images in the same order as the
+ * last time the same list ran into the same buffers, so the results of
+ * the walk below are kept per list and buffer combination. The key also
+ * holds the segment table and a hash of the commands of the top level
+ * list the walk reacts to, which catches most changes without walking
+ * the nested lists. The real pass hashes the image commands it runs and
+ * a reused entry is dropped as soon as that hash changes, so a change
+ * only a nested list makes is scanned again the frame after. Viewport
+ * and rectangle heights aren't hashed, so entries are also rescanned
+ * every FB_DETECT_RESCAN_PERIOD uses. */
+
+#define FB_DETECT_CACHE_SIZE     4
+#define FB_DETECT_RESCAN_PERIOD  60
+#define FB_DETECT_TOP_COMMANDS   256   // most top level commands hashed
+
+typedef struct
+{
+   uint32_t dlist_start, dlist_length;
+   uint32_t ci, ci_width, zi;
+   uint32_t maincimg_addr, maincimg_width, maincimg_height;
+   uint32_t last_drawn_ci_addr;
+   int32_t  clip_yl;
+   uint32_t frame_buffer;
+   int32_t  ucode, vi_swap;
+   uint32_t segment[16];
+   uint32_t top_hash;
+} FB_DETECT_KEY;
+
+typedef struct
+{
+   FB_DETECT_KEY key;
+   bool valid, verified;
+   uint32_t signature;
+   unsigned uses;
+   COLOR_IMAGE frame_buffers[NUMTEXBUF+2];
+   uint8_t ci_count, main_ci_index, copy_ci_index, copy_zi_index;
+   int swap_ci_index, black_ci_index;
+   uint32_t main_ci, main_ci_end, main_ci_bg, main_ci_last_tex_addr;
+   uint32_t zimg_end, tmpzimg, ocimg;
+   int motionblur, read_previous_ci, scale_reset;
+   uint32_t segment[16];      // as the walk left them for the real pass
+} FB_DETECT_ENTRY;
+
+static struct
+{
+   FB_DETECT_ENTRY entries[FB_DETECT_CACHE_SIZE];
+   FB_DETECT_ENTRY *current;  // entry the running list was classified with
+   unsigned next_victim;
+   uint32_t signature;
+} fb_detect;
+
+/* hashes the commands of the top level list that have a handler in the
+ * walk, up to its end or a branch, without following the calls */
+static uint32_t DetectFrameBufferTopHash(uint32_t dlist_start)
+{
+   rdp_instr *lite = gfx_instruction_lite[settings.ucode];
+   uint32_t hash   = 2166136261u;
+   uint32_t a      = dlist_start & BMASK;
+   int i;
+
+   for (i = 0; i < FB_DETECT_TOP_COMMANDS; i++, a = (a+8) & BMASK)
+   {
+      uint32_t w0 = ((uint32_t*)gfx_info.RDRAM)[a>>2];
+      uint32_t w1 = ((uint32_t*)gfx_info.RDRAM)[(a>>2)+1];
+      rdp_instr cmd = lite[w0 >> 24];
+
+      if (!cmd)
+         continue;
+
+      hash = (hash ^ w0) * 16777619u;
+      hash = (hash ^ w1) * 16777619u;
+
+      if (cmd == F3D_EndDL || (cmd == uc0_displaylist && _SHIFTR(w0, 16, 8) == G_DL_NOPUSH))
+         break;
+   }
+
+   return hash;
+}
+
+static void DetectFrameBufferKey(FB_DETECT_KEY *key, uint32_t dlist_start)
+{
+   memset(key, 0, sizeof(*key));
+   key->dlist_start        = dlist_start;
+   key->dlist_length       = *(uint32_t*)(gfx_info.DMEM+0xFF4);
+   key->ci                 = gDP.colorImage.address;
+   key->ci_width           = gDP.colorImage.width;
+   key->zi                 = g_gdp.zb_address;
+   key->maincimg_addr      = rdp.maincimg[0].addr;
+   key->maincimg_width     = rdp.maincimg[0].width;
+   key->maincimg_height    = rdp.maincimg[0].height;
+   key->last_drawn_ci_addr = rdp.last_drawn_ci_addr;
+   key->clip_yl            = g_gdp.__clip.yl;
+   key->frame_buffer       = settings.frame_buffer;
+   key->ucode              = settings.ucode;
+   key->vi_swap            = (settings.swapmode == 2) && (rdp.vi_org_reg == *gfx_info.VI_ORIGIN_REG);
+   memcpy(key->segment, gSP.segment, sizeof(key->segment));
+   key->top_hash           = DetectFrameBufferTopHash(dlist_start);
+}
+
+static void DetectFrameBufferStore(FB_DETECT_ENTRY *entry)
+{
+   memcpy(entry->frame_buffers, rdp.frame_buffers, rdp.ci_count * sizeof(COLOR_IMAGE));
+   entry->ci_count              = rdp.ci_count;
+   entry->main_ci_index         = rdp.main_ci_index;
+   entry->copy_ci_index         = rdp.copy_ci_index;
+   entry->copy_zi_index         = rdp.copy_zi_index;
+   entry->swap_ci_index         = rdp.swap_ci_index;
+   entry->black_ci_index        = rdp.black_ci_index;
+   entry->main_ci               = rdp.main_ci;
+   entry->main_ci_end           = rdp.main_ci_end;
+   entry->main_ci_bg            = rdp.main_ci_bg;
+   entry->main_ci_last_tex_addr = rdp.main_ci_last_tex_addr;
+   entry->zimg_end              = rdp.zimg_end;
+   entry->tmpzimg               = rdp.tmpzimg;
+   entry->ocimg                 = rdp.ocimg;
+   entry->motionblur            = rdp.motionblur;
+   entry->read_previous_ci      = rdp.read_previous_ci;
+   entry->scale_reset           = rdp.scale_x != rdp.scale_x_bak;
+   memcpy(entry->segment, gSP.segment, sizeof(entry->segment));
+}
+
+static void DetectFrameBufferRestore(const FB_DETECT_ENTRY *entry)
+{
+   memcpy(rdp.frame_buffers, entry->frame_buffers, entry->ci_count * sizeof(COLOR_IMAGE));
+   rdp.ci_count              = entry->ci_count;
+   rdp.main_ci_index         = entry->main_ci_index;
+   rdp.copy_ci_index         = entry->copy_ci_index;
+   rdp.copy_zi_index         = entry->copy_zi_index;
+   rdp.swap_ci_index         = entry->swap_ci_index;
+   rdp.black_ci_index        = entry->black_ci_index;
+   rdp.main_ci               = entry->main_ci;
+   rdp.main_ci_end           = entry->main_ci_end;
+   rdp.main_ci_bg            = entry->main_ci_bg;
+   rdp.main_ci_last_tex_addr = entry->main_ci_last_tex_addr;
+   rdp.zimg_end              = entry->zimg_end;
+   rdp.tmpzimg               = entry->tmpzimg;
+   rdp.ocimg                 = entry->ocimg;
+   rdp.motionblur            = entry->motionblur;
+   rdp.read_previous_ci      = entry->read_previous_ci;
+   if (entry->scale_reset)
+   {
+      rdp.scale_x = 1.0f;
+      rdp.scale_y = 1.0f;
+   }
+   memcpy(gSP.segment, entry->segment, sizeof(gSP.segment));
+}
+
+/* called by the real pass for every command, hashes the ones that
+ * decide how the color images get classified */
+static void DetectFrameBufferSignature(uint32_t w0, uint32_t w1)
+{
+   rdp_instr lite = gfx_instruction_lite[settings.ucode][w0 >> 24];
+   uint32_t addr;
+
+   if (!fb_detect.current)
+      return;
+
+   if (lite == fb_setcolorimage || lite == fb_setdepthimage || lite == fb_setscissor)
+      addr = RSP_SegmentToPhysical(w1);
+   else if (lite == fb_settextureimage && ((w0 >> 19) & 0x03) >= 2)
+      addr = RSP_SegmentToPhysical(w1);
+   else if (lite == fb_bg_copy)
+   {
+      addr = RSP_SegmentToPhysical(w1) >> 1;
+      addr = RSP_SegmentToPhysical(((uint32_t*)gfx_info.RDRAM)[(addr+8)>>1]);
+   }
+   else
+      return;
+
+   fb_detect.signature = (fb_detect.signature ^ w0) * 16777619u;
+   fb_detect.signature = (fb_detect.signature ^ addr) * 16777619u;
+}
+
+static void DetectFrameBufferVerify(void)
+{
+   FB_DETECT_ENTRY *entry = fb_detect.current;
+
+   if (!entry)
+      return;
+
+   if (!entry->verified)
+   {
+      entry->signature = fb_detect.signature;
+      entry->verified  = true;
+   }
+   else if (entry->signature != fb_detect.signature)
+      entry->valid = false;
+
+   fb_detect.current = NULL;
+}
+
+static FB_DETECT_ENTRY *DetectFrameBufferLookup(const FB_DETECT_KEY *key, bool *hit)
+{
+   FB_DETECT_ENTRY *entry;
+   int i;
+
+   for (i = 0; i < FB_DETECT_CACHE_SIZE; i++)
+   {
+      entry = &fb_detect.entries[i];
+      if (entry->valid && !memcmp(&entry->key, key, sizeof(*key)))
+      {
+         *hit = entry->verified && ++entry->uses < FB_DETECT_RESCAN_PERIOD;
+         return entry;
+      }
+   }
+
+   entry = &fb_detect.entries[fb_detect.next_victim];
+   fb_detect.next_victim = (fb_detect.next_victim + 1) % FB_DETECT_CACHE_SIZE;
+   *hit = false;
+   return entry;
+}
+
 void DetectFrameBufferUsage(void)
 {
    uint32_t ci, zi;
    int i, previous_ci_was_read, all_zimg;
+   FB_DETECT_ENTRY *entry;
+   FB_DETECT_KEY key;
+   bool hit;
    uint32_t dlist_start = *(uint32_t*)(gfx_info.DMEM+0xFF0);
 
+   fb_detect.current   = NULL;
+   fb_detect.signature = 2166136261u;
+
    /* Do nothing if dlist is empty */
    if (dlist_start == 0)
       return;
 
+   DetectFrameBufferKey(&key, dlist_start);
+   entry = DetectFrameBufferLookup(&key, &hit);
+
    ci                   = gDP.colorImage.address;
    zi                   = g_gdp.zb_address;
 
@@ -1778,14 +2160,23 @@ void DetectFrameBufferUsage(void)
    rdp.read_whole_frame = false;
    rdp.swap_ci_index    = rdp.black_ci_index = -1;
    SwapOK               = true;
+   rdp.scale_x_bak      = rdp.scale_x;
+   rdp.scale_y_bak      = rdp.scale_y;
+
+   if (settings.ucode != ucode_Turbo3d)
+      fb_detect.current = entry;
+
+   if (hit)
+   {
+      DetectFrameBufferRestore(entry);
+      goto classified;
+   }
 
    // Start executing at the start of the display list
    __RSP.PCi            = 0;
    __RSP.PC[__RSP.PCi]  = dlist_start;
    __RSP.count          = -1;
    __RSP.halt           = 0;
-   rdp.scale_x_bak      = rdp.scale_x;
-   rdp.scale_y_bak      = rdp.scale_y;
 
    do
    {
@@ -1816,6 +2207,8 @@ void DetectFrameBufferUsage(void)
       rdp.num_of_ci          = rdp.ci_count;
       rdp.scale_x            = rdp.scale_x_bak;
       rdp.scale_y            = rdp.scale_y_bak;
+      entry->valid           = false;
+      fb_detect.current      = NULL;
       return;
    }
 
@@ -1863,6 +2256,13 @@ void DetectFrameBufferUsage(void)
          rdp.frame_buffers[i].status = CI_MAIN;
    }
 
+   entry->key      = key;
+   entry->valid    = true;
+   entry->verified = false;
+   entry->uses     = 0;
+   DetectFrameBufferStore(entry);
+
+classified:
 #ifndef NDEBUG
    LRDP("detect fb final results: \n");
    for (i = 0; i < rdp.ci_count; i++)
@@ -1928,6 +2328,490 @@ void DetectFrameBufferUsage(void)
    //rdp.scale_y = rdp.scale_y_bak;
 }
 
+/* Display list replay
+ *
+ * Static scenery is mostly drawn by small lists, called with G_DL, that
+ * only load vertices and draw triangles. When such a list runs again
+ * with the same state and the same list and vertex data in RDRAM, the
+ * vertex arrays it handed to glide last time are handed over again
+ * instead of transforming, lighting, clipping and converting them.
+ *
+ * update() is run before the state gets hashed, so the combiner and
+ * textures are set up live and the list itself can't change them. The
+ * state hash is a heuristic, dlist_replay_mode 2 records the hits as
+ * well and counts the replays that would have drawn something else.
+ * Nothing is cached while triangles are also rendered into the depth
+ * buffer in RDRAM (accuracy 3 and up), a replay doesn't write it. */
+
+#define DLIST_CACHE_SIZE         512
+#define DLIST_CACHE_MAX_LOADS    32
+#define DLIST_CACHE_MAX_LENGTH   0x2000   // longest list recorded, in bytes
+#define DLIST_CACHE_STATS_PERIOD 300
+#define DLIST_VERTEX_BYTES       offsetof(VERTEX, u)  // what glide reads of a VERTEX
+#define DLIST_ITEM_DEPTH_BIAS    0xFFFFFFFF
+
+bool dlist_cache_recording = false;
+
+typedef struct
+{
+   uint32_t addr, n, v0;
+} DLIST_CACHE_LOAD;
+
+typedef struct
+{
+   uint32_t mode;    // glide primitive, or DLIST_ITEM_DEPTH_BIAS
+   int32_t  count;   // vertices, or the bias level
+} DLIST_CACHE_ITEM;
+
+typedef struct
+{
+   bool valid;
+   uint32_t addr, length;
+   uint32_t state_hash, data_hash;
+   uint32_t tex_ctr;
+   DLIST_CACHE_LOAD loads[DLIST_CACHE_MAX_LOADS];
+   unsigned num_loads;
+   DLIST_CACHE_ITEM *items;
+   unsigned num_items, max_items;
+   uint8_t *verts;
+   unsigned num_verts, max_verts;
+   VERTEX *vtx;              // rdp.vtx[vtx_first..] as the list left them
+   unsigned vtx_first, vtx_count, max_vtx;
+   uint32_t u_cull_mode;
+} DLIST_CACHE_ENTRY;
+
+static struct
+{
+   DLIST_CACHE_ENTRY entries[DLIST_CACHE_SIZE];
+   DLIST_CACHE_ENTRY record;           // swapped into its slot when the list ends
+   uint32_t rejected[DLIST_CACHE_SIZE]; // addr | 1 of lists that can't be recorded
+   uint32_t loaded[MAX_VTX / 32];      // rdp.vtx slots the recorded list loaded
+   uint32_t depth;                     // __RSP.PCi the recorded list runs at
+   bool verify;
+   struct
+   {
+      unsigned frames, lookups, hits, recorded, rejected;
+      unsigned checked, mismatches;
+      uint32_t replayed_verts;
+   } stats;
+} dlist_cache;
+
+static INLINE unsigned DListCacheSlot(uint32_t addr)
+{
+   return (addr >> 3) & (DLIST_CACHE_SIZE - 1);
+}
+
+static uint32_t DListCacheHashBytes(uint32_t hash, const void *data, size_t size)
+{
+   const uint8_t *p = (const uint8_t*)data;
+   size_t i;
+
+   for (i = 0; i + 4 <= size; i += 4)
+   {
+      uint32_t w;
+      memcpy(&w, p + i, 4);
+      hash = (hash ^ w) * 16777619u;
+   }
+   for (; i < size; i++)
+      hash = (hash ^ p[i]) * 16777619u;
+
+   return hash;
+}
+
+static INLINE uint32_t DListCacheHashRange(uint32_t hash, const void *base, size_t first, size_t end)
+{
+   return DListCacheHashBytes(hash, (const uint8_t*)base + first, end - first);
+}
+
+/* everything vertex loading and triangle setup read, taken after
+ * update() so the texture scales of this draw are in it */
+static uint32_t DListCacheStateHash(void)
+{
+   uint32_t hash = 2166136261u;
+   int i;
+
+   hash = (hash ^ settings.ucode) * 16777619u;
+   hash = (hash ^ cmb.shade_mod_hash) * 16777619u;
+
+   hash = DListCacheHashRange(hash, &gSP, 0, offsetof(struct gSPInfo, matrix.modelView));
+   hash = DListCacheHashBytes(hash, gSP.matrix.modelView[gSP.matrix.modelViewi], sizeof(gSP.matrix.modelView[0]));
+   hash = DListCacheHashRange(hash, &gSP, offsetof(struct gSPInfo, matrix.projection), offsetof(struct gSPInfo, textureTile));
+   hash = DListCacheHashRange(hash, &gSP, offsetof(struct gSPInfo, viewport), sizeof(gSP));
+
+   hash = DListCacheHashRange(hash, &gDP, 0, offsetof(struct gDPInfo, TexFilterPalette));
+   hash = DListCacheHashRange(hash, &g_gdp, 0, offsetof(struct gdp_global, sckeepodd));
+
+   hash = DListCacheHashRange(hash, &rdp, offsetof(struct RDP, vi_width), offsetof(struct RDP, timg));
+   hash = DListCacheHashRange(hash, &rdp, offsetof(struct RDP, cur_tile), offsetof(struct RDP, pal_8));
+   hash = DListCacheHashRange(hash, &rdp, offsetof(struct RDP, light), offsetof(struct RDP, tex_ctr));
+   hash = (hash ^ rdp.tlut_mode) * 16777619u;
+   hash = (hash ^ rdp.force_wrap) * 16777619u;
+   hash = (hash ^ rdp.rm) * 16777619u;
+   hash = (hash ^ rdp.render_mode_changed) * 16777619u;
+   hash = (hash ^ rdp.fog_mode) * 16777619u;
+
+   for (i = 0; i < MAX_TMU; i++)
+   {
+      if (rdp.cur_cache[i])
+         hash = DListCacheHashBytes(hash, &rdp.cur_cache[i]->c_off, 3 * sizeof(float));
+   }
+
+   return hash;
+}
+
+static uint32_t DListCacheDataHash(const DLIST_CACHE_ENTRY *entry)
+{
+   uint32_t hash = DListCacheHashBytes(2166136261u, gfx_info.RDRAM + entry->addr, entry->length);
+   unsigned i;
+
+   for (i = 0; i < entry->num_loads; i++)
+      hash = DListCacheHashBytes(hash, gfx_info.RDRAM + entry->loads[i].addr, entry->loads[i].n * 16);
+
+   return hash;
+}
+
+static bool DListCacheGrow(void **array, unsigned *max, unsigned needed, size_t size)
+{
+   unsigned grown;
+   void *p;
+
+   if (needed <= *max)
+      return true;
+
+   grown = MAX(MAX(needed, *max * 2), 64);
+   p     = realloc(*array, grown * size);
+   if (!p)
+      return false;
+
+   *array = p;
+   *max   = grown;
+   return true;
+}
+
+/* commands a recorded list may contain, anything else ends recording */
+static bool DListCacheCommandOK(uint32_t w0)
+{
+   rdp_instr cmd = gfx_instruction[settings.ucode][w0 >> 24];
+
+   if (cmd == uc2_vertex)
+      return (w0 & 0x00FFFFFF) != 0;
+   if (cmd == uc2_tri1)
+      return (w0 & 0x00FFFFFF) != 0x17;
+   if (cmd == uc2_quad)
+      return (w0 & 0x00FFFFFF) != 0x2F;
+
+   return cmd == uc0_vertex || cmd == uc1_vertex || cmd == uc3_vertex || cmd == uc4_vertex
+      || cmd == uc0_tri1 || cmd == uc1_tri1 || cmd == uc1_tri2 || cmd == uc3_tri1
+      || cmd == uc3_tri2 || cmd == uc3_quad3d || cmd == uc4_tri1 || cmd == uc4_quad3d
+      || cmd == gdp_no_op || cmd == F3D_EndDL;
+}
+
+static bool DListCacheSameOutput(const DLIST_CACHE_ENTRY *a, const DLIST_CACHE_ENTRY *b)
+{
+   return a->num_items == b->num_items && a->num_verts == b->num_verts
+      && !memcmp(a->items, b->items, a->num_items * sizeof(DLIST_CACHE_ITEM))
+      && !memcmp(a->verts, b->verts, a->num_verts * DLIST_VERTEX_BYTES);
+}
+
+static void DListCacheReject(void)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+
+   dlist_cache_recording = false;
+
+   /* a hit that doesn't record the same way again was a bad hit */
+   if (dlist_cache.verify)
+   {
+      dlist_cache.stats.checked++;
+      dlist_cache.stats.mismatches++;
+      dlist_cache.entries[DListCacheSlot(record->addr)].valid = false;
+      return;
+   }
+
+   dlist_cache.rejected[DListCacheSlot(record->addr)] = record->addr | 1;
+   dlist_cache.stats.rejected++;
+}
+
+void DListCacheRecordVertex(uint32_t addr, uint32_t n, uint32_t v0)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+   DLIST_CACHE_LOAD  *load;
+   uint32_t i;
+
+   if (record->num_loads == DLIST_CACHE_MAX_LOADS || v0 + n > MAX_VTX)
+   {
+      DListCacheReject();
+      return;
+   }
+
+   load       = &record->loads[record->num_loads++];
+   load->addr = addr;
+   load->n    = n;
+   load->v0   = v0;
+
+   for (i = v0; i < v0 + n; i++)
+      dlist_cache.loaded[i >> 5] |= 1u << (i & 31);
+}
+
+/* triangles on vertices the list didn't load itself depend on
+ * whatever ran before it */
+void DListCacheRecordTriangles(VERTEX **v, unsigned count)
+{
+   unsigned i;
+
+   for (i = 0; i < count; i++)
+   {
+      uint32_t index = (uint32_t)(v[i] - rdp.vtx);
+
+      if (index >= MAX_VTX || !(dlist_cache.loaded[index >> 5] & (1u << (index & 31))))
+      {
+         DListCacheReject();
+         return;
+      }
+   }
+}
+
+void DListCacheRecordDraw(uint32_t mode, uint32_t count, VERTEX *v)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+   DLIST_CACHE_ITEM  *item;
+   uint32_t i;
+
+   if (count > MAX_VTX
+         || !DListCacheGrow((void**)&record->items, &record->max_items, record->num_items + 1, sizeof(DLIST_CACHE_ITEM))
+         || !DListCacheGrow((void**)&record->verts, &record->max_verts, record->num_verts + count, DLIST_VERTEX_BYTES))
+   {
+      DListCacheReject();
+      return;
+   }
+
+   item        = &record->items[record->num_items++];
+   item->mode  = mode;
+   item->count = count;
+
+   for (i = 0; i < count; i++)
+      memcpy(record->verts + (record->num_verts + i) * DLIST_VERTEX_BYTES, &v[i], DLIST_VERTEX_BYTES);
+   record->num_verts += count;
+}
+
+void DListCacheRecordDepthBias(int32_t level)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+   DLIST_CACHE_ITEM  *item;
+
+   if (!DListCacheGrow((void**)&record->items, &record->max_items, record->num_items + 1, sizeof(DLIST_CACHE_ITEM)))
+   {
+      DListCacheReject();
+      return;
+   }
+
+   item        = &record->items[record->num_items++];
+   item->mode  = DLIST_ITEM_DEPTH_BIAS;
+   item->count = level;
+}
+
+static void DListCacheStartRecording(uint32_t addr, uint32_t state_hash, bool verify)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+
+   record->valid      = false;
+   record->addr       = addr;
+   record->state_hash = state_hash;
+   record->tex_ctr    = rdp.tex_ctr;
+   record->num_loads  = 0;
+   record->num_items  = 0;
+   record->num_verts  = 0;
+
+   memset(dlist_cache.loaded, 0, sizeof(dlist_cache.loaded));
+   dlist_cache.depth     = __RSP.PCi;
+   dlist_cache.verify    = verify;
+   dlist_cache_recording = true;
+}
+
+static void DListCacheFinish(uint32_t end)
+{
+   DLIST_CACHE_ENTRY *record = &dlist_cache.record;
+   DLIST_CACHE_ENTRY *entry  = &dlist_cache.entries[DListCacheSlot(record->addr)];
+   DLIST_CACHE_ENTRY swap;
+   unsigned first = MAX_VTX, last = 0, i;
+
+   dlist_cache_recording = false;
+
+   if (end - record->addr > DLIST_CACHE_MAX_LENGTH)
+   {
+      DListCacheReject();
+      return;
+   }
+   record->length = end - record->addr;
+
+   for (i = 0; i < MAX_VTX; i++)
+   {
+      if (dlist_cache.loaded[i >> 5] & (1u << (i & 31)))
+      {
+         if (first == MAX_VTX)
+            first = i;
+         last = i;
+      }
+   }
+
+   record->vtx_first = 0;
+   record->vtx_count = 0;
+   if (first < MAX_VTX)
+   {
+      if (!DListCacheGrow((void**)&record->vtx, &record->max_vtx, last - first + 1, sizeof(VERTEX)))
+      {
+         DListCacheReject();
+         return;
+      }
+      record->vtx_first = first;
+      record->vtx_count = last - first + 1;
+      memcpy(record->vtx, &rdp.vtx[first], record->vtx_count * sizeof(VERTEX));
+   }
+
+   record->u_cull_mode = rdp.u_cull_mode;
+   record->data_hash   = DListCacheDataHash(record);
+   record->valid       = true;
+
+   if (dlist_cache.verify)
+   {
+      dlist_cache.stats.checked++;
+      if (!DListCacheSameOutput(entry, record))
+      {
+         dlist_cache.stats.mismatches++;
+         entry->valid = false;
+      }
+      return;
+   }
+
+   swap    = *entry;
+   *entry  = *record;
+   *record = swap;
+   dlist_cache.stats.recorded++;
+}
+
+static void DListCacheReplay(const DLIST_CACHE_ENTRY *entry)
+{
+   static VERTEX scratch[MAX_VTX];
+   const uint8_t *src = entry->verts;
+   unsigned i;
+   int j;
+
+   for (i = 0; i < entry->num_items; i++)
+   {
+      const DLIST_CACHE_ITEM *item = &entry->items[i];
+
+      if (item->mode == DLIST_ITEM_DEPTH_BIAS)
+      {
+         grDepthBiasLevel(item->count);
+         continue;
+      }
+
+      for (j = 0; j < item->count; j++, src += DLIST_VERTEX_BYTES)
+         memcpy(&scratch[j], src, DLIST_VERTEX_BYTES);
+
+      cmb.cmb_ext_use = cmb.tex_cmb_ext_use = 0;
+      grDrawVertexArrayContiguous(item->mode, item->count, scratch);
+   }
+
+   /* later lists may draw with the vertices this one loaded, the ones
+    * it calculated texture coordinates for are current again */
+   if (entry->vtx_count)
+   {
+      memcpy(&rdp.vtx[entry->vtx_first], entry->vtx, entry->vtx_count * sizeof(VERTEX));
+      for (i = entry->vtx_first; i < entry->vtx_first + entry->vtx_count; i++)
+         rdp.vtx[i].uv_calculated = (rdp.vtx[i].uv_calculated == entry->tex_ctr) ? rdp.tex_ctr : 0xFFFFFFFF;
+   }
+
+   rdp.u_cull_mode = entry->u_cull_mode;
+
+   dlist_cache.stats.replayed_verts += entry->num_verts;
+}
+
+/* called with the list G_DL just pushed */
+static void DListCacheEnter(uint32_t addr)
+{
+   unsigned slot            = DListCacheSlot(addr);
+   DLIST_CACHE_ENTRY *entry = &dlist_cache.entries[slot];
+   uint32_t state_hash;
+
+   if (rdp.skip_frame || rdp.skip_drawing || settings.lodmode
+         || (fb_depth_render_enabled && gfx_plugin_accuracy >= 3)
+         || settings.ucode > ucode_StarWars || __RSP.count != -1
+         || dlist_cache.rejected[slot] == (addr | 1))
+      return;
+
+   /* what the first vertex load and triangle of the list would do */
+   glide64gSPPreUpdate();
+   update();
+
+   if (rdp.noise != NOISE_MODE_NONE)
+      return;
+
+   state_hash = DListCacheStateHash();
+   dlist_cache.stats.lookups++;
+
+   if (entry->valid && entry->addr == addr && entry->state_hash == state_hash
+         && entry->data_hash == DListCacheDataHash(entry))
+   {
+      dlist_cache.stats.hits++;
+
+      if (dlist_replay_mode == 2)
+      {
+         DListCacheStartRecording(addr, state_hash, true);
+         return;
+      }
+
+      DListCacheReplay(entry);
+      __RSP.PCi--;
+      return;
+   }
+
+   DListCacheStartRecording(addr, state_hash, false);
+}
+
+/* called after every command of the main loop, pci is __RSP.PCi from
+ * before the command at a ran */
+static void DListCacheStep(uint32_t a, uint32_t pci)
+{
+   if (dlist_cache_recording)
+   {
+      if (__RSP.PCi > pci || !DListCacheCommandOK(((uint32_t*)gfx_info.RDRAM)[a>>2]))
+         DListCacheReject();
+      else if (__RSP.PCi < dlist_cache.depth)
+      {
+         DListCacheFinish(a + 8);
+         return;
+      }
+   }
+
+   if (!dlist_cache_recording && __RSP.PCi > pci)
+      DListCacheEnter(__RSP.PC[__RSP.PCi]);
+}
+
+static void DListCacheEndFrame(void)
+{
+   dlist_cache_recording = false;
+
+   if (!dlist_replay_mode || ++dlist_cache.stats.frames < DLIST_CACHE_STATS_PERIOD)
+      return;
+
+#ifdef PERF_STATS
+   printf("display list cache: %.1f lists/frame, %.1f hits (%.0f%%), %.1f recorded, %.1f rejected, %.0f vertices replayed\n",
+         dlist_cache.stats.lookups / (float)dlist_cache.stats.frames,
+         dlist_cache.stats.hits / (float)dlist_cache.stats.frames,
+         dlist_cache.stats.hits * 100.0f / MAX(1, dlist_cache.stats.lookups),
+         dlist_cache.stats.recorded / (float)dlist_cache.stats.frames,
+         dlist_cache.stats.rejected / (float)dlist_cache.stats.frames,
+         dlist_cache.stats.replayed_verts / (float)dlist_cache.stats.frames);
+#endif
+
+   if (dlist_replay_mode == 2)
+      printf("display list cache: %u of %u checked hits would have drawn differently\n",
+            dlist_cache.stats.mismatches, dlist_cache.stats.checked);
+
+   memset(&dlist_cache.stats, 0, sizeof(dlist_cache.stats));
+}
+
 static void rdp_trifill(uint32_t w0, uint32_t w1)
 {
    glide64gDPTriangle(w0, w1, 0, 0, 0);
@@ -722,11 +722,21 @@ static void clip_tri(int interpolate_colors)
    rdp.n_global = n;
 }
 
+/* a skipped frame still has to be rasterized into the depth buffer in
+ * RDRAM when that's enabled, everything else can go */
+static INLINE bool skip_frame_triangles(void)
+{
+   return rdp.skip_frame && !(fb_depth_render_enabled && gfx_plugin_accuracy >= 3);
+}
+
 static void render_tri (uint16_t linew, int old_interpolate)
 {
    int i, n;
    float fog;
 
+   if (skip_frame_triangles())
+      return;
+
    if (rdp.clip)
       clip_tri(old_interpolate);
 
@@ -887,15 +897,29 @@ static void render_tri (uint16_t linew, int old_interpolate)
          v[3].y    = V1->y + wy;
       }
 
-      grDrawVertexArrayContiguous(GR_TRIANGLE_STRIP, 4, &v[0]);
+      if (!rdp.skip_frame)
+      {
+         if (dlist_cache_recording)
+            DListCacheRecordDraw(GR_TRIANGLE_STRIP, 4, &v[0]);
+         grDrawVertexArrayContiguous(GR_TRIANGLE_STRIP, 4, &v[0]);
+      }
    }
    else
    {
       DrawDepthBuffer(rdp.vtxbuf, n);
 
+      if (rdp.skip_frame)
+         return;
+
       if ((rdp.rm & 0xC10) == 0xC10)
+      {
+         if (dlist_cache_recording)
+            DListCacheRecordDepthBias(-deltaZ);
          grDepthBiasLevel(-deltaZ);
+      }
 
+      if (dlist_cache_recording)
+         DListCacheRecordDraw(GR_TRIANGLE_FAN, n, rdp.vtx_buffer ? rdp.vtx2 : rdp.vtx1);
       grDrawVertexArrayContiguous(GR_TRIANGLE_FAN, n,
             rdp.vtx_buffer ? rdp.vtx2 : rdp.vtx1);
    }
@@ -1375,61 +1399,95 @@ static void clip_w (void)
    rdp.n_global = index;
 }
 
-static int cull_tri(VERTEX **v) // type changed to VERTEX** [Dave2001]
-{
-   int i, draw, iarea;
-   unsigned int mode;
-   float x1, y1, x2, y2, area;
+/* Culls a whole gSP1Triangle/gSP2Triangles/gSP4Triangles batch at once.
+ * The batch is rejected in one go when all its triangles are off the same
+ * screen edge, and accepted in one go when the cull mode culls no faces.
+ * Otherwise the facing test runs over small per-batch arrays. Only the
+ * triangles left get set up and clipped. */
 
-   if (v[0]->scr_off & v[1]->scr_off & v[2]->scr_off)
-      return true;
+#define CULL_BATCH_MAX        4
+#define TRIANGLE_STATS_PERIOD 300
 
-   // Triangle can't be culled, if it need clipping
-   draw = false;
+static struct
+{
+   unsigned frames;
+   uint32_t submitted, culled, clipped;
+} triangle_stats;
 
-   for (i=0; i<3; i++)
+static void cull_tris(VERTEX **v, unsigned count, bool *culled)
+{
+   float x1[CULL_BATCH_MAX], y1[CULL_BATCH_MAX], x2[CULL_BATCH_MAX], y2[CULL_BATCH_MAX];
+   float area[CULL_BATCH_MAX];
+   int off[CULL_BATCH_MAX], need_clip[CULL_BATCH_MAX];
+   uint32_t cull_mode = rdp.flags & G_CULL_BOTH;
+   int mode           = (int)(cull_mode << 19UL);
+   bool any           = false;
+   unsigned i, j;
+
+   for (i = 0; i < count; i++)
    {
-      if (!v[i]->screen_translated)
-      {
-         v[i]->sx = gSP.viewport.vtrans[0] + v[i]->x_w * gSP.viewport.vscale[0] + rdp.offset_x;
-         v[i]->sy = gSP.viewport.vtrans[1] + v[i]->y_w * gSP.viewport.vscale[1] + rdp.offset_y;
-         v[i]->sz = gSP.viewport.vtrans[2] + v[i]->z_w * gSP.viewport.vscale[2];
-         v[i]->screen_translated = 1;
-      }
-      if (v[i]->w < 0.01f) //need clip_z. can't be culled now
-         draw = 1;
+      off[i] = v[i*3]->scr_off & v[i*3+1]->scr_off & v[i*3+2]->scr_off;
+      any   |= !off[i];
    }
 
-   rdp.u_cull_mode = (rdp.flags & G_CULL_BOTH);
-   if (draw || rdp.u_cull_mode == 0 || rdp.u_cull_mode == G_CULL_BOTH) //no culling set
+   if (!any)
    {
-      rdp.u_cull_mode >>= CULLSHIFT;
-      return false;
+      for (i = 0; i < count; i++)
+         culled[i] = true;
+      return;
    }
 
-   x1 = v[0]->sx - v[1]->sx;
-   y1 = v[0]->sy - v[1]->sy;
-   x2 = v[2]->sx - v[1]->sx;
-   y2 = v[2]->sy - v[1]->sy;
-   area = y1 * x2 - x1 * y2;
-   iarea = *(int*)&area;
+   for (i = 0; i < count; i++)
+   {
+      if (off[i])
+         continue;
+
+      for (j = i*3; j < i*3 + 3; j++)
+      {
+         if (!v[j]->screen_translated)
+         {
+            v[j]->sx = gSP.viewport.vtrans[0] + v[j]->x_w * gSP.viewport.vscale[0] + rdp.offset_x;
+            v[j]->sy = gSP.viewport.vtrans[1] + v[j]->y_w * gSP.viewport.vscale[1] + rdp.offset_y;
+            v[j]->sz = gSP.viewport.vtrans[2] + v[j]->z_w * gSP.viewport.vscale[2];
+            v[j]->screen_translated = 1;
+         }
+      }
+   }
 
-   mode = (rdp.u_cull_mode << 19UL);
-   rdp.u_cull_mode >>= CULLSHIFT;
+   rdp.u_cull_mode = cull_mode >> CULLSHIFT;
 
-   if ((iarea & 0x7FFFFFFF) == 0)
+   if (cull_mode == 0 || cull_mode == G_CULL_BOTH) //no culling set
    {
-      //LRDP (" zero area triangles\n");
-      return true;
+      for (i = 0; i < count; i++)
+         culled[i] = off[i] != 0;
+      return;
    }
 
-   if ((rdp.flags & G_CULL_BOTH) && ((int)(iarea ^ mode)) >= 0)
+   for (i = 0; i < count; i++)
    {
-      //LRDP (" culled\n");
-      return true;
+      x1[i]   = v[i*3]->sx - v[i*3+1]->sx;
+      y1[i]   = v[i*3]->sy - v[i*3+1]->sy;
+      x2[i]   = v[i*3+2]->sx - v[i*3+1]->sx;
+      y2[i]   = v[i*3+2]->sy - v[i*3+1]->sy;
+      // Triangle can't be culled, if it need clipping
+      need_clip[i] = (v[i*3]->w < 0.01f) | (v[i*3+1]->w < 0.01f) | (v[i*3+2]->w < 0.01f);
    }
 
-   return false;
+   for (i = 0; i < count; i++)
+      area[i] = y1[i] * x2[i] - x1[i] * y2[i];
+
+   for (i = 0; i < count; i++)
+   {
+      int iarea;
+      memcpy(&iarea, &area[i], sizeof(iarea));
+
+      if (off[i])
+         culled[i] = true;
+      else if (need_clip[i])
+         culled[i] = false;
+      else
+         culled[i] = (iarea & 0x7FFFFFFF) == 0 || (iarea ^ mode) >= 0;
+   }
 }
 
 static void draw_tri_uv_calculation(VERTEX **vtx, VERTEX *v)
@@ -1477,6 +1535,7 @@ static void draw_tri_uv_calculation(VERTEX **vtx, VERTEX *v)
 static void draw_tri (VERTEX **vtx, uint16_t linew)
 {
    int i;
+   bool clipped = false;
 
    org_vtx = vtx;
 
@@ -1510,28 +1569,69 @@ static void draw_tri (VERTEX **vtx, uint16_t linew)
    if ((vtx[0]->scr_off & 16) ||
          (vtx[1]->scr_off & 16) ||
          (vtx[2]->scr_off & 16))
+   {
       clip_w();
+      clipped = true;
+   }
 
    do_triangle_stuff (linew, false);
+
+   if (clipped || rdp.clip)
+      triangle_stats.clipped++;
 }
 
 void cull_trianglefaces(VERTEX **v, unsigned iterations, bool do_update, bool do_cull, int32_t wd)
 {
-   uint32_t i;
-   int32_t vcount = 0;
+   bool culled[CULL_BATCH_MAX];
+   uint32_t i, j;
+
+   if (skip_frame_triangles())
+      return;
+
+   if (dlist_cache_recording)
+      DListCacheRecordTriangles(v, iterations * 3);
 
    if (do_update)
       update();
 
-   for (i = 0; i < iterations; i++, vcount += 3)
+   triangle_stats.submitted += iterations;
+
+   for (i = 0; i < iterations; i += CULL_BATCH_MAX)
    {
+      VERTEX **batch = v + i * 3;
+      unsigned count = MIN(iterations - i, CULL_BATCH_MAX);
+
       if (do_cull)
-         if (cull_tri(v + vcount))
+         cull_tris(batch, count, culled);
+
+      for (j = 0; j < count; j++)
+      {
+         if (do_cull && culled[j])
+         {
+            triangle_stats.culled++;
             continue;
+         }
 
-      deltaZ = dzdx = 0;
-      if (wd == 0 && (fb_depth_render_enabled || (rdp.rm & ZMODE_DECAL) == ZMODE_DECAL))
-         draw_tri_depth(v + vcount);
-      draw_tri (v + vcount, wd);
+         deltaZ = dzdx = 0;
+         if (wd == 0 && (fb_depth_render_enabled || (rdp.rm & ZMODE_DECAL) == ZMODE_DECAL))
+            draw_tri_depth(batch + j * 3);
+         draw_tri (batch + j * 3, wd);
+      }
    }
 }
+
+void TriangleStatsEndFrame(void)
+{
+#ifdef PERF_STATS
+   if (++triangle_stats.frames < TRIANGLE_STATS_PERIOD)
+      return;
+
+   printf("triangles: %.1f submitted/frame, %.1f culled (%.0f%%), %.1f clipped\n",
+         triangle_stats.submitted / (float)triangle_stats.frames,
+         triangle_stats.culled / (float)triangle_stats.frames,
+         triangle_stats.culled * 100.0f / MAX(1, triangle_stats.submitted),
+         triangle_stats.clipped / (float)triangle_stats.frames);
+
+   memset(&triangle_stats, 0, sizeof(triangle_stats));
+#endif
+}
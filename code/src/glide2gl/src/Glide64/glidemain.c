@@ -686,6 +686,10 @@ void newSwapBuffers(void)
 
    rdp.updatescreen = 0;
 
+   /* nothing was drawn, keep showing the last frame */
+   if (rdp.skip_frame)
+      return;
+
    g_gdp.flags |= UPDATE_SCISSOR | UPDATE_COMBINE | UPDATE_ZBUF_ENABLED | UPDATE_CULL_MODE;
    grClipWindow (0, 0, settings.scr_res_x, settings.scr_res_y);
    grDepthBufferFunction (GR_CMP_ALWAYS);
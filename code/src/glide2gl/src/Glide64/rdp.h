@@ -228,6 +228,7 @@ typedef struct
    int zmode_compare_less; //force GR_CMP_LESS for zmode=0 (opaque)and zmode=1 (interpenetrating)
    int old_style_adither; //apply alpha dither regardless of alpha_dither_mode
    int n64_z_scale; //scale vertex z value before writing to depth buffer, as N64 does.
+   int render_skip; //fast-forward may drop display lists of frames that aren't shown
 
    uint32_t hacks;
 } SETTINGS;
@@ -432,6 +433,7 @@ struct RDP
    int  motionblur, fb_drawn, fb_drawn_front, read_previous_ci, read_whole_frame;
    CI_STATUS ci_status;
    int skip_drawing; //rendering is not required. used for frame buffer emulation
+   int skip_frame; //frameskip: the display list only runs for its side effects
 
    //fog related slots. Added by Gonetz
    unsigned fog_mode;
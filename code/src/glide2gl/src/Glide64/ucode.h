@@ -153,6 +153,8 @@ static void uc2_vertex_neon(uint32_t w0, uint32_t w1);
 static void uc2_vertex(uint32_t w0, uint32_t w1);
 static void uc2_modifyvtx(uint32_t w0, uint32_t w1);
 static void uc2_culldl(uint32_t w0, uint32_t w1);
+static void uc2_setothermode_h(uint32_t w0, uint32_t w1);
+static void uc2_setothermode_l(uint32_t w0, uint32_t w1);
 static void uc2_tri1(uint32_t w0, uint32_t w1);
 static void uc2_line3d(uint32_t w0, uint32_t w1);
 static void uc2_special3(uint32_t w0, uint32_t w1);
@@ -434,7 +436,7 @@ static rdp_instr gfx_instruction[12][256] =
       uc2_special2,           uc2_dlist_cnt,          uc2_dma_io,             uc0_texture,
       uc2_pop_matrix,         uc2_geom_mode,          uc2_matrix,             uc2_moveword,
       uc2_movemem,            uc2_load_ucode,         uc0_displaylist,        F3D_EndDL,
-      gdp_no_op,                 uc1_rdphalf_1,          uc0_setothermode_l,     uc0_setothermode_h,
+      gdp_no_op,                 uc1_rdphalf_1,          uc2_setothermode_l,     uc2_setothermode_h,
       rdp_texrect,            rdp_texrect,            gdp_load_sync,           gdp_pipe_sync,
       gdp_tile_sync,           gdp_full_sync,           gdp_set_key_gb,         gdp_set_key_r,
       gdp_set_convert,         rdp_setscissor,         gdp_set_prim_depth,       rdp_setothermode,
@@ -883,7 +885,7 @@ static rdp_instr gfx_instruction[12][256] =
       uc2_special2,                   uc2_dlist_cnt,                  uc2_dma_io,                             uc0_texture,
       uc2_pop_matrix,                 uc2_geom_mode,                  uc2_matrix,                             uc8_moveword,
       uc8_movemem,                    uc2_load_ucode,                 uc0_displaylist,                F3D_EndDL,
-      gdp_no_op,                                 rdphalf_1,                      uc0_setothermode_l,             uc0_setothermode_h,
+      gdp_no_op,                                 rdphalf_1,                      uc2_setothermode_l,             uc2_setothermode_h,
       rdp_texrect,            rdp_texrect,            gdp_load_sync,           gdp_pipe_sync,
       gdp_tile_sync,           gdp_full_sync,           gdp_set_key_gb,           gdp_set_key_r,
       gdp_set_convert,         rdp_setscissor,         gdp_set_prim_depth,       rdp_setothermode,
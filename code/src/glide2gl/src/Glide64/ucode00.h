@@ -199,14 +199,16 @@ static void uc0_texture(uint32_t w0, uint32_t w1)
          );
 }
 
-static void uc0_setothermode_h(uint32_t w0, uint32_t w1)
+/* F3DEX2 and CBFD count the shift from the other end, the uc0 and uc2
+ * handlers pass it as a constant so the check folds away */
+static INLINE void setothermode_h(uint32_t w0, bool gbi2)
 {
    int i;
    int len       = _SHIFTR(w0, 0, 8);
    int shift     = _SHIFTR(w0, 8, 8);
    uint32_t mask = 0;
 
-   if ((settings.ucode == ucode_F3DEX2) || (settings.ucode == ucode_CBFD))
+   if (gbi2)
       shift = 32 - shift - (++len);
 
    i = len;
@@ -230,14 +232,14 @@ static void uc0_setothermode_h(uint32_t w0, uint32_t w1)
       g_gdp.flags |= UPDATE_ZBUF_ENABLED;
 }
 
-static void uc0_setothermode_l(uint32_t w0, uint32_t w1)
+static INLINE void setothermode_l(uint32_t w0, bool gbi2)
 {
    int i;
    int len       = _SHIFTR(w0, 0, 8);
    int shift     = _SHIFTR(w0, 8, 8);
    uint32_t mask = 0;
 
-   if ((settings.ucode == ucode_F3DEX2) || (settings.ucode == ucode_CBFD))
+   if (gbi2)
    {
       shift = 32 - shift - (++len);
       if (shift < 0) shift = 0;
@@ -266,6 +268,16 @@ static void uc0_setothermode_l(uint32_t w0, uint32_t w1)
    // there is not one setothermode_l that's not handled :)
 }
 
+static void uc0_setothermode_h(uint32_t w0, uint32_t w1)
+{
+   setothermode_h(w0, false);
+}
+
+static void uc0_setothermode_l(uint32_t w0, uint32_t w1)
+{
+   setothermode_l(w0, false);
+}
+
 static void uc0_setgeometrymode(uint32_t w0, uint32_t w1)
 {
    glide64gSPSetGeometryMode(w1);
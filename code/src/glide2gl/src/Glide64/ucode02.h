@@ -154,6 +154,16 @@ static void uc2_dma_io(uint32_t w0, uint32_t w1)
 {
 }
 
+static void uc2_setothermode_h(uint32_t w0, uint32_t w1)
+{
+   setothermode_h(w0, true);
+}
+
+static void uc2_setothermode_l(uint32_t w0, uint32_t w1)
+{
+   setothermode_l(w0, true);
+}
+
 static void uc2_pop_matrix(uint32_t w0, uint32_t w1)
 {
    glide64gSPPopMatrixN( 0, w1 >> 6 );
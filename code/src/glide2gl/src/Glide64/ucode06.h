@@ -114,6 +114,9 @@ static void DrawImage (DRAWIMAGE *d)
    int ul_u, ul_v, lr_u, lr_v;
    float ul_x, ul_y, lr_x, lr_y;
 
+   if (rdp.skip_frame)
+      return;
+
    if (d->imageW == 0 || d->imageH == 0 || d->frameH == 0)
       return;
 
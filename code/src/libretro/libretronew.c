@@ -36,6 +36,9 @@
 #include "main/cheat.h"
 #include "main/version.h"
 #include "main/savestates.h"
+#include "main/device.h"
+#include "main/rom.h"
+#include <features/features_cpu.h>
 #include "dd/dd_disk.h"
 #include "pi/pi_controller.h"
 #include "si/pif.h"
@@ -140,6 +143,11 @@ static bool     first_context_reset = false;
 static bool     pushed_frame = false;
 
 bool frame_dupe = false;
+bool skip_render = false;
+unsigned skip_render_count = 0;
+bool texture_disk_cache = false;
+static bool vi_pipelined = false;
+int dlist_replay_mode = 0;
 
 uint32_t gfx_plugin_accuracy = 2;
 static enum rsp_plugin_type
@@ -152,6 +160,7 @@ uint32_t send_allist_to_hle_rsp = 0;
 
 unsigned int BUFFERSWAP = 0;
 unsigned int FAKE_SDL_TICKS = 0;
+static unsigned int fake_ticks_usec = 0;
 
 bool alternate_mapping;
 
@@ -221,7 +230,11 @@ static void core_settings_autoselect_gfx_plugin(void)
 
 static void core_settings_autoselect_rsp_plugin(void)
 {
-    rsp_plugin = RSP_HLE;
+    /* angrylion needs the display lists run on the LLE RSP */
+    if (gfx_plugin == GFX_ANGRYLION)
+        rsp_plugin = RSP_CXD4;
+    else
+        rsp_plugin = RSP_HLE;
 }
 
 unsigned libretro_get_gfx_plugin(void)
@@ -273,14 +286,14 @@ static bool emu_step_load_data()
         if (log_cb)
             log_cb(RETRO_LOG_INFO, "EmuThread: M64CMD_ROM_OPEN\n");
 
-        if (CoreDoCommand(M64CMD_ROM_OPEN, cart_size, (void*)cart_data))
+        /* the core adopts cart_data on success */
+        if (CoreDoCommand(M64CMD_ROM_OPEN_BUFFER, cart_size, (void*)cart_data))
         {
             if (log_cb)
                 log_cb(RETRO_LOG_ERROR, "mupen64plus: Failed to load ROM\n");
             goto load_fail;
         }
 
-        free(cart_data);
         cart_data = NULL;
 
         if (log_cb)
@@ -443,7 +456,7 @@ int retro_stop_stepping(void)
 }
 
 #ifdef HAVE_THR_AL
-extern struct rgba prescale[PRESCALE_WIDTH * PRESCALE_HEIGHT];
+extern struct rgba* angrylion_frame;
 #endif
 
 int ready_to_swap = 0;
@@ -456,7 +469,8 @@ bool emu_step_render(void)
         {
         case GFX_ANGRYLION:
 #ifdef HAVE_THR_AL
-            video_cb(prescale, screen_width, screen_height, screen_pitch);
+            /* the frontend uploads angrylion_frame, see getSoftwareFrame() */
+            ready_to_swap = 1;
 #endif
             break;
 
@@ -490,6 +504,45 @@ bool emu_step_render(void)
     return false;
 }
 
+void setSoftwareRenderer(bool enabled)
+{
+#ifdef HAVE_THR_AL
+    gfx_plugin = enabled ? GFX_ANGRYLION : GFX_GLIDE64;
+#endif
+}
+
+void setTextureDiskCache(bool enabled)
+{
+    texture_disk_cache = enabled;
+}
+
+void setViPipelined(bool enabled)
+{
+    /* applied to angrylion by update_variables() */
+    vi_pipelined = enabled;
+}
+
+void setDisplayListReplay(int mode)
+{
+    if (mode < 0 || mode > 2)
+        mode = 0;
+    dlist_replay_mode = mode;
+}
+
+const void* getSoftwareFrame(int* width, int* height, int* pitch)
+{
+#ifdef HAVE_THR_AL
+    if (gfx_plugin == GFX_ANGRYLION && angrylion_frame != NULL)
+    {
+        *width = screen_width;
+        *height = screen_height;
+        *pitch = screen_pitch;
+        return angrylion_frame;
+    }
+#endif
+    return NULL;
+}
+
 int getReadyToSwap()
 {
     return ready_to_swap;
@@ -753,14 +806,17 @@ void retro_deinit(void)
 #if defined(HAVE_OPENGL) || defined(HAVE_OPENGLES)
 extern void glide_set_filtering(unsigned value);
 #endif
-//extern void angrylion_set_vi(unsigned value);
-//extern void angrylion_set_filtering(unsigned value);
-//extern void angrylion_set_dithering(unsigned value);
-//extern void  angrylion_set_threads(unsigned value);
-//extern void  angrylion_set_overscan(unsigned value);
-//extern void  angrylion_set_vi_dedither(unsigned value);
-//extern void  angrylion_set_vi_blur(unsigned value);
-//extern void angrylion_set_synclevel(unsigned value);
+#ifdef HAVE_THR_AL
+extern void angrylion_set_vi(unsigned value);
+extern void angrylion_set_filtering(unsigned value);
+extern void angrylion_set_dithering(unsigned value);
+extern void  angrylion_set_threads(unsigned value);
+extern void  angrylion_set_overscan(unsigned value);
+extern void  angrylion_set_vi_dedither(unsigned value);
+extern void  angrylion_set_vi_blur(unsigned value);
+extern void  angrylion_set_vi_pipelined(unsigned value);
+extern void angrylion_set_synclevel(unsigned value);
+#endif
 
 extern void ChangeSize();
 
@@ -852,107 +908,19 @@ void update_variables(bool startup)
 
 
 #ifdef HAVE_THR_AL
-    var.key = "parallel-n64-angrylion-vioverlay";
-    var.value = NULL;
-
-    environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var);
-
-    if (var.value)
-    {
-        if (!strcmp(var.value, "Filtered"))
-        {
-            angrylion_set_vi(0);
-            angrylion_set_vi_dedither(1);
-            angrylion_set_vi_blur(1);
-        }
-        else if (!strcmp(var.value, "AA+Blur"))
-        {
-            angrylion_set_vi(0);
-            angrylion_set_vi_dedither(0);
-            angrylion_set_vi_blur(1);
-        }
-        else if (!strcmp(var.value, "AA+Dedither"))
-        {
-            angrylion_set_vi(0);
-            angrylion_set_vi_dedither(1);
-            angrylion_set_vi_blur(0);
-        }
-        else if (!strcmp(var.value, "AA only"))
-        {
-            angrylion_set_vi(0);
-            angrylion_set_vi_dedither(0);
-            angrylion_set_vi_blur(0);
-        }
-        else if (!strcmp(var.value, "Unfiltered"))
-        {
-            angrylion_set_vi(1);
-            angrylion_set_vi_dedither(1);
-            angrylion_set_vi_blur(1);
-        }
-        else if (!strcmp(var.value, "Depth"))
-        {
-            angrylion_set_vi(2);
-            angrylion_set_vi_dedither(1);
-            angrylion_set_vi_blur(1);
-        }
-        else if (!strcmp(var.value, "Coverage"))
-        {
-            angrylion_set_vi(3);
-            angrylion_set_vi_dedither(1);
-            angrylion_set_vi_blur(1);
-        }
-    }
-    else
-    {
-        angrylion_set_vi(0);
-        angrylion_set_vi_dedither(1);
-        angrylion_set_vi_blur(1);
-    }
-
-    var.key = "parallel-n64-angrylion-sync";
-    var.value = NULL;
-
-    environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var);
-
-    if (var.value)
-    {
-        if (!strcmp(var.value, "High"))
-            angrylion_set_synclevel(2);
-        else if (!strcmp(var.value, "Medium"))
-            angrylion_set_synclevel(1);
-        else if (!strcmp(var.value, "Low"))
-            angrylion_set_synclevel(0);
-    }
-    else
-        angrylion_set_synclevel(0);
-
-    var.key = "parallel-n64-angrylion-multithread";
-    var.value = NULL;
-
-    if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
-    {
-        if (!strcmp(var.value, "all threads"))
-            angrylion_set_threads(0);
-        else
-            angrylion_set_threads(atoi(var.value));
-    }
-    else
-        angrylion_set_threads(0);
-
-    var.key = "parallel-n64-angrylion-overscan";
-    var.value = NULL;
-
-    environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var);
-
-    if (var.value)
-    {
-        if (!strcmp(var.value, "enabled"))
-            angrylion_set_overscan(1);
-        else if (!strcmp(var.value, "disabled"))
-            angrylion_set_overscan(0);
-    }
-    else
-        angrylion_set_overscan(0);
+    /* no core options here, these are the defaults of the old
+     * parallel-n64-angrylion-* options: filtered VI, lowest sync
+     * level, no overscan. Zero workers picks one per core, it can be
+     * forced with ANGRYLION_NUM_THREADS. The web build isn't linked
+     * with pthreads, so there it always runs a single worker on the
+     * main thread (see parallel_alinit()). */
+    angrylion_set_vi(0);
+    angrylion_set_vi_dedither(1);
+    angrylion_set_vi_blur(1);
+    angrylion_set_synclevel(0);
+    angrylion_set_threads(0);
+    angrylion_set_overscan(0);
+    angrylion_set_vi_pipelined(vi_pipelined);
 #endif
 
 
@@ -1139,17 +1107,16 @@ bool retro_load_game_new(uint8_t* romdata, int size, bool loadEep, bool loadSra,
         }
     }
 
+    /* romdata is adopted, not copied */
     if (is_cartridge_rom(romdata))
     {
-        cart_data = malloc(size);
+        cart_data = romdata;
         cart_size = size;
-        memcpy(cart_data, romdata, size);
     }
     else
     {
-        disk_data = malloc(size);
+        disk_data = romdata;
         disk_size = size;
-        memcpy(disk_data, romdata, size);
     }
 
     stop = false;
@@ -1206,11 +1173,36 @@ static void glsm_enter(void)
 }
 #endif
 
+/* The VI clock divided by the length of a field: H_SYNC is the line
+ * length in VI clocks minus one and V_SYNC the number of half lines minus
+ * one. Gives 59.83Hz for NTSC and 49.92Hz for PAL. */
+double getVIRefreshRate()
+{
+    uint32_t h_sync = (g_dev.vi.regs[VI_H_SYNC_REG] & 0xfff) + 1;
+    uint32_t v_sync = (g_dev.vi.regs[VI_V_SYNC_REG] & 0x3ff) + 1;
+    double rate;
+
+    if (g_dev.vi.clock == 0 || h_sync < 2 || v_sync < 2)
+        return g_dev.vi.expected_refresh_rate ? g_dev.vi.expected_refresh_rate : 60.0;
+
+    rate = 2.0 * g_dev.vi.clock / ((double)h_sync * v_sync);
+
+    /* games briefly program odd timings while switching modes */
+    if (rate < 40.0 || rate > 75.0)
+        return g_dev.vi.expected_refresh_rate ? g_dev.vi.expected_refresh_rate : 60.0;
+
+    return rate;
+}
+
 void retro_run(void)
 {
     static bool updated = false;
 
-    FAKE_SDL_TICKS += 16;
+    /* advance the fake millisecond clock by one VI period, carrying the
+     * fraction so PAL and NTSC games see the right pace */
+    fake_ticks_usec += (unsigned int)(1000000.0 / getVIRefreshRate());
+    FAKE_SDL_TICKS += fake_ticks_usec / 1000;
+    fake_ticks_usec %= 1000;
     pushed_frame = false;
 
     //do
@@ -1268,11 +1260,287 @@ void retro_run(void)
     //while (emu_step_render());
 }
 
+/* Adaptive frameskip: the emulation time of every frame is compared with
+ * a budget of 90% of the VI period, the rest is left for presenting. While
+ * frames run over, the next ones are emulated with skip_render set so glide
+ * runs their display lists without drawing anything, at most
+ * FRAMESKIP_MAX_RUN in a row so the picture keeps moving. Glide still
+ * draws the frames whose frame buffer the game reads back. */
+#define FRAMESKIP_MAX_RUN 3
+#define FRAMESKIP_BUDGET 0.9
+
+static bool frameskip_enabled = false;
+static bool frameskip_next = false;
+static int frameskip_run = 0;
+static retro_time_t frameskip_debt = 0;
+static int frameskip_skipped = 0;
+
+void setFrameskip(bool enabled)
+{
+    frameskip_enabled = enabled;
+    frameskip_next = false;
+    frameskip_run = 0;
+    frameskip_debt = 0;
+}
+
+void retro_run_frameskip(void)
+{
+    retro_time_t budget = (retro_time_t)(FRAMESKIP_BUDGET * 1000000.0 / getVIRefreshRate());
+    unsigned skipped_before = skip_render_count;
+    retro_time_t start;
+
+    if (!frameskip_enabled)
+    {
+        retro_run();
+        return;
+    }
+
+    start = cpu_features_get_time_usec();
+    skip_render = frameskip_next;
+    retro_run();
+    skip_render = false;
+
+    frameskip_debt += cpu_features_get_time_usec() - start - budget;
+    if (frameskip_debt < -budget)
+        frameskip_debt = -budget;
+    if (frameskip_debt > FRAMESKIP_MAX_RUN * budget)
+        frameskip_debt = FRAMESKIP_MAX_RUN * budget;
+
+    /* glide draws the frame anyway when the game reads it back */
+    if (skip_render_count != skipped_before)
+    {
+        frameskip_skipped++;
+        frameskip_run++;
+    }
+    else
+        frameskip_run = 0;
+
+    frameskip_next = frameskip_debt > 0 && frameskip_run < FRAMESKIP_MAX_RUN;
+}
+
+int getSkippedFrames()
+{
+    return frameskip_skipped;
+}
+
+void resetSkippedFrames()
+{
+    frameskip_skipped = 0;
+}
+
+/* Fast-forward: speed frames are emulated per call. The ones before the
+ * last are marked with skip_render so glide can drop their display lists
+ * (unless the game's settings opt out), and the audio of all of them is
+ * decimated back down to one frame's worth instead of being resampled. */
+#define FAST_FORWARD_MAX_SPEED 8
+#define FAST_FORWARD_STATS_USEC 5000000
+
+static struct
+{
+    retro_time_t start;
+    unsigned frames;
+    unsigned skipped;
+    int speed;
+} fast_forward_stats;
+
+static void fast_forward_stats_update(int speed)
+{
+#ifdef PERF_STATS
+    retro_time_t now = cpu_features_get_time_usec();
+    retro_time_t elapsed;
+
+    if (speed != fast_forward_stats.speed || fast_forward_stats.start == 0)
+    {
+        fast_forward_stats.start = now;
+        fast_forward_stats.frames = 0;
+        fast_forward_stats.skipped = skip_render_count;
+        fast_forward_stats.speed = speed;
+        return;
+    }
+
+    fast_forward_stats.frames += speed;
+    elapsed = now - fast_forward_stats.start;
+    if (elapsed < FAST_FORWARD_STATS_USEC)
+        return;
+
+    printf("fast-forward: %s at %.2fx (%dx requested), %u of %u frames not rendered\n",
+        ROM_PARAMS.headername,
+        fast_forward_stats.frames / (elapsed / 1000000.0) / getVIRefreshRate(),
+        speed,
+        skip_render_count - fast_forward_stats.skipped,
+        fast_forward_stats.frames);
+
+    fast_forward_stats.start = now;
+    fast_forward_stats.frames = 0;
+    fast_forward_stats.skipped = skip_render_count;
+#endif
+}
+
+void retro_run_fast_forward(int speed)
+{
+    int i;
+
+    if (speed > FAST_FORWARD_MAX_SPEED)
+        speed = FAST_FORWARD_MAX_SPEED;
+    if (speed <= 1)
+    {
+        fast_forward_stats.start = 0;
+        retro_run();
+        return;
+    }
+
+    audio_libretro_set_decimation(speed);
+
+    skip_render = true;
+    for (i = 1; i < speed; i++)
+        retro_run();
+    skip_render = false;
+    retro_run();
+
+    audio_libretro_set_decimation(1);
+    fast_forward_stats_update(speed);
+}
+
 unsigned char savestate_buffer[16788288 + 1024];
 
 int savestates_load_m64p(const unsigned char *data, size_t size);
+int savestates_rollback_m64p(const unsigned char *data, size_t size);
 int savestates_save_m64p(unsigned char *data, size_t size);
 
+/* Run-ahead: the real frame is emulated with its audio, the state is saved
+ * to memory, runahead_frames more frames are emulated with the same input
+ * and no audio, then the state is rolled back. The last of those frames is
+ * the one presented, so input shows up runahead_frames frames earlier; the
+ * others go through skip_render like fast-forward's hidden frames. Rolling
+ * back only invalidates the recompiled code of the pages the hidden frames
+ * wrote to.
+ *
+ * The save doesn't go through gzip like neil_serialize() does, it's a
+ * straight copy of RDRAM and the registers. Plugin side state (glide's
+ * texture cache, angrylion, the RSP) isn't part of it and keeps whatever
+ * the discarded frames left there, which only matters for games that
+ * read back their own framebuffer. */
+#define RUNAHEAD_MAX_FRAMES 4
+#define RUNAHEAD_STATS_PERIOD 300
+
+static unsigned char *runahead_state = NULL;
+static int runahead_frames = 0;
+
+static struct
+{
+    retro_time_t frame_usec;
+    retro_time_t ahead_usec;
+    retro_time_t save_usec;
+    retro_time_t load_usec;
+    unsigned frames;
+} runahead_stats;
+
+/* the timings are only taken for the report */
+#ifdef PERF_STATS
+#define runahead_time() cpu_features_get_time_usec()
+#else
+#define runahead_time() 0
+#endif
+
+void setRunAheadFrames(int frames)
+{
+    if (frames < 0)
+        frames = 0;
+    if (frames > RUNAHEAD_MAX_FRAMES)
+        frames = RUNAHEAD_MAX_FRAMES;
+
+    if (frames > 0 && runahead_state == NULL)
+    {
+        runahead_state = (unsigned char*)malloc(sizeof(savestate_buffer));
+        if (runahead_state == NULL)
+        {
+            printf("run-ahead: couldn't allocate the state buffer\n");
+            frames = 0;
+        }
+    }
+
+    runahead_frames = frames;
+    memset(&runahead_stats, 0, sizeof(runahead_stats));
+}
+
+static void runahead_stats_update(void)
+{
+#ifdef PERF_STATS
+    double frames;
+
+    if (++runahead_stats.frames < RUNAHEAD_STATS_PERIOD)
+        return;
+
+    frames = runahead_stats.frames;
+    printf("run-ahead: %d frame(s), frame %.2f ms, run-ahead frame %.2f ms, save %.2f ms, load %.2f ms\n",
+        runahead_frames,
+        runahead_stats.frame_usec / 1000.0 / frames,
+        runahead_stats.ahead_usec / 1000.0 / (frames * runahead_frames),
+        runahead_stats.save_usec / 1000.0 / frames,
+        runahead_stats.load_usec / 1000.0 / frames);
+    printf("run-ahead: %.2f ms of extra CPU time per presented frame\n",
+        (runahead_stats.ahead_usec + runahead_stats.save_usec + runahead_stats.load_usec) / 1000.0 / frames);
+
+    memset(&runahead_stats, 0, sizeof(runahead_stats));
+#endif
+}
+
+void retro_run_ahead(void)
+{
+    struct ai_dma ai_fifo[AI_DMA_FIFO_SIZE];
+    unsigned int ai_samples_format_changed;
+    unsigned int ticks, ticks_usec;
+    retro_time_t start, saved, ahead;
+    int i;
+
+    /* the state can only be taken between frames of an initialized core */
+    if (runahead_frames == 0 || first_time)
+    {
+        retro_run();
+        return;
+    }
+
+    start = runahead_time();
+    skip_render = true;
+    retro_run();
+    saved = runahead_time();
+    runahead_stats.frame_usec += saved - start;
+
+    if (!savestates_save_m64p(runahead_state, sizeof(savestate_buffer)))
+    {
+        skip_render = false;
+        return;
+    }
+
+    /* not in the savestate format, the loader only guesses these */
+    memcpy(ai_fifo, g_dev.ai.fifo, sizeof(ai_fifo));
+    ai_samples_format_changed = g_dev.ai.samples_format_changed;
+    ticks = FAKE_SDL_TICKS;
+    ticks_usec = fake_ticks_usec;
+
+    start = runahead_time();
+    runahead_stats.save_usec += start - saved;
+
+    audio_libretro_set_muted(1);
+    for (i = 1; i < runahead_frames; i++)
+        retro_run();
+    skip_render = false;
+    retro_run();
+    audio_libretro_set_muted(0);
+
+    ahead = runahead_time();
+    runahead_stats.ahead_usec += ahead - start;
+
+    savestates_rollback_m64p(runahead_state, sizeof(savestate_buffer));
+    memcpy(g_dev.ai.fifo, ai_fifo, sizeof(ai_fifo));
+    g_dev.ai.samples_format_changed = ai_samples_format_changed;
+    FAKE_SDL_TICKS = ticks;
+    fake_ticks_usec = ticks_usec;
+
+    runahead_stats.load_usec += runahead_time() - ahead;
+    runahead_stats_update();
+}
+
  void write_save_state_file()
  {
      FILE* f = fopen("savestate.sav", "wb");
@@ -2,15 +2,39 @@
 void neil_invoke_linker();
 void retro_init(void);
 void retro_deinit(void);
+/* Takes ownership of romdata, which must come from malloc(). */
 bool retro_load_game_new(uint8_t* romdata, int size, bool loadEep, bool loadSra, bool loadFla);
 void retro_run(void);
+/* retro_run() plus the given number of frames run ahead and rolled back,
+ * set with setRunAheadFrames() (0 to 4). */
+void retro_run_ahead(void);
+void setRunAheadFrames(int frames);
+/* Emulates speed frames (up to 8) and only renders the last one. */
+void retro_run_fast_forward(int speed);
+/* retro_run() that stops drawing frames while emulation runs over budget. */
+void retro_run_frameskip(void);
+void setFrameskip(bool enabled);
+int getSkippedFrames();
+void resetSkippedFrames();
 void setDeviceId(int id);
+void setSoftwareRenderer(bool enabled);
+/* Keeps converted glide textures in texcache.bin for the next session. */
+void setTextureDiskCache(bool enabled);
+/* Replays the glide output of unchanged glide display lists,
+ * 0 off, 1 on, 2 only compare what a replay would have drawn. */
+void setDisplayListReplay(int mode);
+/* Runs the angrylion VI filters on their own thread, one frame late. */
+void setViPipelined(bool enabled);
+/* BGRA frame of the angrylion renderer, NULL for the GL renderers. */
+const void* getSoftwareFrame(int* width, int* height, int* pitch);
 int getReadyToSwap();
 void resetReadyToSwap();
 int getVI_Count();
 void resetVI_Count();
 int getVIFPS_Count();
 void resetVIFPS_Count();
+/* Field rate the game has programmed the VI for, in Hz. */
+double getVIRefreshRate();
 bool neil_serialize();
 bool neil_unserialize();
 bool neil_export_eep();
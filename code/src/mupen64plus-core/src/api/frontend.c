@@ -222,6 +222,20 @@ EXPORT m64p_error CALL CoreDoCommand(m64p_command Command, int ParamInt, void *P
                return M64ERR_INVALID_STATE;
             l_DDDiskOpen = 0;
             return close_dd_disk();
+        case M64CMD_ROM_OPEN_BUFFER:
+            /* like M64CMD_ROM_OPEN, but the core takes ownership of the
+             * malloc()ed image on success instead of copying it */
+            if (g_EmulatorRunning || l_ROMOpen)
+                return M64ERR_INVALID_STATE;
+            if (ParamPtr == NULL || ParamInt < 4096)
+                return M64ERR_INPUT_ASSERT;
+            rval = open_rom_buffer((unsigned char *) ParamPtr, ParamInt);
+            if (rval == M64ERR_SUCCESS)
+            {
+                l_ROMOpen = 1;
+                cheat_init();
+            }
+            return rval;
         default:
             return M64ERR_INPUT_INVALID;
     }
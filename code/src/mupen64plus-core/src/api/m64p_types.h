@@ -151,7 +151,8 @@ typedef enum {
    M64CMD_ADVANCE_FRAME,
    M64CMD_DDROM_OPEN,
    M64CMD_DISK_OPEN,
-   M64CMD_DISK_CLOSE
+   M64CMD_DISK_CLOSE,
+   M64CMD_ROM_OPEN_BUFFER
 } m64p_command;
 
 typedef struct
@@ -60,6 +60,8 @@
 #include "../plugin/get_time_using_C_localtime.h"
 #include "../plugin/rumble_via_input_plugin.h"
 #include "../pifbootrom/pifbootrom.h"
+#include "../r4300/block_profiler.h"
+#include "../r4300/cached_interp.h"
 #include "../r4300/r4300.h"
 #include "../r4300/r4300_core.h"
 #include "../r4300/reset.h"
@@ -297,6 +299,10 @@ void new_vi(void)
 
    main_check_inputs();
 
+   block_profiler_vi();
+
+   code_invalidation_end_frame();
+
 #if 0
    timed_sections_refresh();
 
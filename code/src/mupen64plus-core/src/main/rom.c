@@ -72,6 +72,278 @@ static const uint8_t Z64_SIGNATURE[4] = { 0x80, 0x37, 0x12, 0x40 };
 static const uint8_t V64_SIGNATURE[4] = { 0x37, 0x80, 0x40, 0x12 };
 static const uint8_t N64_SIGNATURE[4] = { 0x40, 0x12, 0x37, 0x80 };
 
+/* Per-game settings, one entry per ROM keyed by the two header CRCs.
+ * rom_db.c is generated from rom_luts.c by tools/gen_romhash.py, which
+ * also picks the displacements so that every ROM in it hashes to its own
+ * slot: a lookup is one hash, one probe and one compare.
+ *
+ * The Glide64 sections of Glide64mk2.ini are in the same table, keyed by
+ * a hash of the header name and flagged ROM_DB_NAME. */
+#define ROM_DB_EEPROM_16KB       0x0001
+#define ROM_DB_EEPROM_4KB        0x0002
+#define ROM_DB_FLASH_RAM         0x0004
+#define ROM_DB_AUDIO_SIGNAL      0x0008
+#define ROM_DB_FIXED_AUDIO_POS   0x0010
+#define ROM_DB_ALTERNATE_VI      0x0020
+#define ROM_DB_VI_CLOCK_1500     0x0040
+#define ROM_DB_VI_CLOCK_1600     0x0080
+#define ROM_DB_VI_CLOCK_2200     0x0100
+#define ROM_DB_COUNT_PER_OP      0x0200
+#define ROM_DB_SI_DMA_DURATION   0x0400
+#define ROM_DB_DELAY_SI          0x0800
+#define ROM_DB_NAME              0x1000
+
+#define ROM_DB_SAVE_TYPES (ROM_DB_EEPROM_16KB | ROM_DB_EEPROM_4KB | ROM_DB_FLASH_RAM)
+#define ROM_DB_VI_CLOCKS  (ROM_DB_VI_CLOCK_1500 | ROM_DB_VI_CLOCK_1600 | ROM_DB_VI_CLOCK_2200)
+/* settings that make the ROM a known one rather than "(unknown rom)" */
+#define ROM_DB_PATCHES    (ROM_DB_SAVE_TYPES | ROM_DB_AUDIO_SIGNAL | ROM_DB_FIXED_AUDIO_POS \
+      | ROM_DB_ALTERNATE_VI | ROM_DB_VI_CLOCKS)
+
+/* user overrides, same sections as the CRC= lines of mupen64plus.ini:
+ *
+ * [19C553A7 A70F4B52]
+ * SaveType=Eeprom 4KB
+ * CountPerOp=1
+ * filtering=1
+ *
+ * Keys the core doesn't know are Glide64 settings, see Glide64mk2.ini.
+ */
+#define ROM_DB_OVERRIDE_FILE "romdb.ini"
+
+struct rom_db_entry
+{
+   uint64_t id;
+   uint16_t flags;
+   uint8_t count_per_op;
+   uint8_t delay_si;
+   uint16_t sidmaduration;
+   uint16_t gfx_title; /* index + 1 into rom_db_gfx_titles, 0 if none */
+   uint16_t gfx_hacks; /* index + 1 into rom_db_gfx_hacks, 0 if none */
+};
+
+struct rom_db_gfx
+{
+   const char *patterns; /* "A|B": A or B is in the name, "A+B": both are */
+   const char *settings; /* "key=value" lines */
+};
+
+#include "rom_db.c"
+
+/* must match rom_db_hash() in gen_romhash.py */
+static INLINE uint32_t rom_db_hash(uint64_t id, uint32_t seed)
+{
+   uint64_t h = (id ^ (seed * 0x9E3779B97F4A7C15ULL)) * 0xFF51AFD7ED558CCDULL;
+   return (uint32_t)(h >> 32) ^ (uint32_t)h;
+}
+
+/* kind is ROM_DB_NAME for header names, 0 for CRCs */
+static const struct rom_db_entry *rom_db_find(uint64_t id, uint16_t kind)
+{
+   uint32_t seed = rom_db_disp[rom_db_hash(id, 0) % ROM_DB_BUCKETS];
+   const struct rom_db_entry *entry = &rom_db[rom_db_hash(id, seed) % ROM_DB_SIZE];
+
+   return (entry->id == id && (entry->flags & ROM_DB_NAME) == kind) ? entry : NULL;
+}
+
+/* FNV-1a, must match name_id() in gen_romhash.py */
+static uint64_t rom_db_name_id(const char *name)
+{
+   uint64_t h = 0xCBF29CE484222325ULL;
+
+   while (*name)
+      h = (h ^ (uint8_t)*name++) * 0x100000001B3ULL;
+   return h;
+}
+
+static int rom_db_gfx_matches(const struct rom_db_gfx *gfx, const char *name)
+{
+   const char *p = gfx->patterns;
+   char part[21];
+   size_t len = 0;
+   int all = 1;
+
+   for (;; p++)
+   {
+      if (*p && *p != '+' && *p != '|')
+      {
+         if (len < sizeof(part) - 1)
+            part[len++] = *p;
+         continue;
+      }
+
+      part[len] = '\0';
+      len = 0;
+      all = all && strstr(name, part);
+      if (*p == '+')
+         continue;
+      if (all)
+         return 1;
+      if (!*p)
+         return 0;
+      all = 1;
+   }
+}
+
+static const char *rom_db_gfx_first(const struct rom_db_gfx *gfx, unsigned count, const char *name)
+{
+   unsigned i;
+
+   for (i = 0; i < count; i++)
+      if (rom_db_gfx_matches(&gfx[i], name))
+         return gfx[i].settings;
+   return NULL;
+}
+
+/* The Glide64 sections of a header name. Names that are one of the
+ * patterns have their own entry, other ones are matched against the
+ * sections in order like the strstr() chains they came from. */
+static void rom_db_gfx_find(const char *name, const char **title, const char **hacks)
+{
+   const struct rom_db_entry *db = rom_db_find(rom_db_name_id(name), ROM_DB_NAME);
+
+   if (db)
+   {
+      *title = db->gfx_title ? rom_db_gfx_titles[db->gfx_title - 1].settings : NULL;
+      *hacks = db->gfx_hacks ? rom_db_gfx_hacks[db->gfx_hacks - 1].settings : NULL;
+   }
+   else
+   {
+      *title = rom_db_gfx_first(rom_db_gfx_titles, ROM_DB_GFX_TITLES, name);
+      *hacks = rom_db_gfx_first(rom_db_gfx_hacks, ROM_DB_GFX_HACKS, name);
+   }
+}
+
+/* Returns 1 if the setting was applied, 0 if its value is invalid and -1
+ * if it isn't a core setting. */
+static int rom_db_override(struct rom_db_entry *entry, const char *name, const char *value)
+{
+   static const struct { const char *name; uint16_t flag; } switches[] = {
+      { "AudioSignal",   ROM_DB_AUDIO_SIGNAL    },
+      { "FixedAudioPos", ROM_DB_FIXED_AUDIO_POS },
+      { "AlternateVI",   ROM_DB_ALTERNATE_VI    },
+   };
+   /* the other keys, they all take a number */
+   static const char *numbers[] = {
+      "AudioSignal", "FixedAudioPos", "AlternateVI", "ViRefreshRate",
+      "CountPerOp", "DelaySI", "SiDmaDuration"
+   };
+   int n;
+   unsigned i;
+
+   if (!strcmp(name, "SaveType"))
+   {
+      entry->flags &= ~ROM_DB_SAVE_TYPES;
+      if (!strcmp(value, "Eeprom 16KB"))
+         entry->flags |= ROM_DB_EEPROM_16KB;
+      else if (!strcmp(value, "Eeprom 4KB"))
+         entry->flags |= ROM_DB_EEPROM_4KB;
+      else if (!strcmp(value, "Flash RAM"))
+         entry->flags |= ROM_DB_FLASH_RAM;
+      else if (strcmp(value, "None"))
+         return 0;
+      return 1;
+   }
+
+   for (i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+      if (!strcmp(name, numbers[i]))
+         break;
+   if (i == sizeof(numbers) / sizeof(numbers[0]))
+      return -1;
+
+   if (!string_to_int(value, &n) || n < 0)
+      return 0;
+
+   for (i = 0; i < sizeof(switches) / sizeof(switches[0]); i++)
+   {
+      if (!strcmp(name, switches[i].name))
+      {
+         if (n)
+            entry->flags |= switches[i].flag;
+         else
+            entry->flags &= ~switches[i].flag;
+         return 1;
+      }
+   }
+
+   if (!strcmp(name, "ViRefreshRate"))
+   {
+      entry->flags &= ~ROM_DB_VI_CLOCKS;
+      if (n == 1500)
+         entry->flags |= ROM_DB_VI_CLOCK_1500;
+      else if (n == 1600)
+         entry->flags |= ROM_DB_VI_CLOCK_1600;
+      else if (n == 2200)
+         entry->flags |= ROM_DB_VI_CLOCK_2200;
+      else if (n != DEFAULT_COUNT_PER_SCANLINE)
+         return 0;
+   }
+   else if (!strcmp(name, "CountPerOp") && n <= 0xFF)
+   {
+      entry->flags |= ROM_DB_COUNT_PER_OP;
+      entry->count_per_op = n;
+   }
+   else if (!strcmp(name, "DelaySI") && n <= 0xFF)
+   {
+      entry->flags |= ROM_DB_DELAY_SI;
+      entry->delay_si = n;
+   }
+   else if (!strcmp(name, "SiDmaDuration") && n <= 0xFFFF)
+   {
+      entry->flags |= ROM_DB_SI_DMA_DURATION;
+      entry->sidmaduration = n;
+   }
+   else
+      return 0;
+
+   return 1;
+}
+
+/* Applies the section of the override file that matches entry->id and
+ * appends its Glide64 settings to gfx as "key=value" lines. Returns 1 if
+ * anything was overridden. */
+static int rom_db_read_overrides(const char *path, struct rom_db_entry *entry,
+      char *gfx, size_t gfx_size)
+{
+   char buffer[256];
+   int in_section = 0;
+   int applied = 0;
+   size_t gfx_len = strlen(gfx);
+   FILE *f = fopen(path, "r");
+
+   if (!f)
+      return 0;
+
+   while (fgets(buffer, sizeof(buffer), f))
+   {
+      char *line = buffer;
+      ini_line l = ini_parse_line(&line);
+      unsigned int crc1, crc2;
+
+      if (l.type == INI_SECTION)
+         in_section = sscanf(l.name, "%x %x", &crc1, &crc2) == 2
+            && ((((uint64_t)crc1) << 32) | crc2) == entry->id;
+      else if (l.type == INI_PROPERTY && in_section)
+      {
+         int r = rom_db_override(entry, l.name, l.value);
+         size_t len = strlen(l.name) + strlen(l.value) + 2;
+
+         if (r < 0 && gfx_len + len < gfx_size)
+         {
+            sprintf(gfx + gfx_len, "%s=%s\n", l.name, l.value);
+            gfx_len += len;
+            applied = 1;
+         }
+         else if (r > 0)
+            applied = 1;
+         else
+            DebugMessage(M64MSG_WARNING, "%s: ignoring %s=%s", path, l.name, l.value);
+      }
+   }
+
+   fclose(f);
+   return applied;
+}
+
 // Get the system type associated to a ROM country code.
 static m64p_system_type rom_country_code_to_system_type(char country_code)
 {
@@ -109,54 +381,103 @@ static int is_valid_rom(const unsigned char *buffer)
       return 0;
 }
 
-/* If rom is a .v64 or .n64 image, byteswap or wordswap loadlength amount of
- * rom data to native .z64 before forwarding. Makes sure that data extraction
- * and MD5ing routines always deal with a .z64 image.
- */
-static void swap_rom(unsigned char* localrom, unsigned char* imagetype, int loadlength)
+/* Size of the chunks swapped and hashed together, small enough to stay
+ * in cache between the two passes. */
+#define ROM_CHUNK_SIZE 0x10000
+
+/* Byteswaps (.v64) or wordswaps (.n64) a chunk of rom data to native .z64.
+ * Whole words are swapped 32 bits at a time, which compilers vectorize. */
+static void swap_rom_chunk(unsigned char* chunk, unsigned char imagetype, size_t length)
 {
+   size_t i;
+   size_t words = length / 4;
    unsigned char temp;
-   int i;
 
-   /* Btyeswap if .v64 image. */
-   if(localrom[0]==0x37)
+   if (imagetype == V64IMAGE)
    {
-      *imagetype = V64IMAGE;
-      for (i = 0; i < loadlength; i+=2)
+      uint32_t *pun = (uint32_t*)chunk;
+      for (i = 0; i < words; ++i)
+         pun[i] = ((pun[i] & 0x00ff00ff) << 8) | ((pun[i] >> 8) & 0x00ff00ff);
+      for (i = words * 4; i + 1 < length; i += 2)
       {
-         temp=localrom[i];
-         localrom[i]=localrom[i+1];
-         localrom[i+1]=temp;
+         temp = chunk[i];
+         chunk[i] = chunk[i+1];
+         chunk[i+1] = temp;
       }
    }
-   /* Wordswap if .n64 image. */
-   else if(localrom[0]==0x40)
+   else if (imagetype == N64IMAGE)
    {
-      *imagetype = N64IMAGE;
-      for (i = 0; i < loadlength; i+=4)
-      {
-         temp=localrom[i];
-         localrom[i]=localrom[i+3];
-         localrom[i+3]=temp;
-         temp=localrom[i+1];
-         localrom[i+1]=localrom[i+2];
-         localrom[i+2]=temp;
-      }
+      uint32_t *pun = (uint32_t*)chunk;
+      for (i = 0; i < words; ++i)
+         pun[i] = m64p_swap32(pun[i]);
    }
+}
+
+/* If rom is a .v64 or .n64 image, byteswap or wordswap it in place to
+ * native .z64 and compute its MD5 in the same pass, so that data extraction
+ * and MD5ing routines always deal with a .z64 image.
+ */
+static void swap_and_hash_rom(unsigned char* localrom, unsigned char* imagetype,
+      size_t loadlength, md5_byte_t digest[16])
+{
+   md5_state_t state;
+   size_t offset;
+
+   /* Btyeswap if .v64 image. */
+   if (localrom[0]==0x37)
+      *imagetype = V64IMAGE;
+   /* Wordswap if .n64 image. */
+   else if (localrom[0]==0x40)
+      *imagetype = N64IMAGE;
    else
       *imagetype = Z64IMAGE;
+
+   md5_init(&state);
+   for (offset = 0; offset < loadlength; offset += ROM_CHUNK_SIZE)
+   {
+      size_t length = loadlength - offset;
+      if (length > ROM_CHUNK_SIZE)
+         length = ROM_CHUNK_SIZE;
+
+      swap_rom_chunk(localrom + offset, *imagetype, length);
+      md5_append(&state, (const md5_byte_t*)(localrom + offset), length);
+   }
+   md5_finish(&state, digest);
 }
 
 m64p_error open_rom(const unsigned char* romimage, unsigned int size)
 {
-#include "rom_luts.c"
-   md5_state_t state;
+   unsigned char* image;
+   m64p_error rval;
+
+   if (romimage == NULL || !is_valid_rom(romimage))
+   {
+      DebugMessage(M64MSG_ERROR, "open_rom(): not a valid ROM image");
+      return M64ERR_INPUT_INVALID;
+   }
+
+   /* allocate new buffer for ROM and copy into this buffer */
+   image = (unsigned char *) malloc(size);
+   if (image == NULL)
+      return M64ERR_NO_MEMORY;
+   memcpy(image, romimage, size);
+
+   rval = open_rom_buffer(image, size);
+   if (rval != M64ERR_SUCCESS)
+      free(image);
+
+   return rval;
+}
+
+m64p_error open_rom_buffer(unsigned char* romimage, unsigned int size)
+{
    md5_byte_t digest[16];
    char buffer[256];
    unsigned char imagetype;
    int i;
    uint64_t lut_id;
-   int patch_applied = 0;
+   const struct rom_db_entry *db;
+   struct rom_db_entry entry;
 
    /* check input requirements */
    if (g_rom != NULL)
@@ -172,22 +493,16 @@ m64p_error open_rom(const unsigned char* romimage, unsigned int size)
 
    /* Clear Byte-swapped flag, since ROM is now deleted. */
    g_MemHasBeenBSwapped = 0;
-   /* allocate new buffer for ROM and copy into this buffer */
+   /* adopt the caller's buffer */
    g_rom_size = size;
-   g_rom = (unsigned char *) malloc(size);
+   g_rom = romimage;
    alternate_vi_timing = 0;
    g_vi_refresh_rate = DEFAULT_COUNT_PER_SCANLINE;
-   if (g_rom == NULL)
-      return M64ERR_NO_MEMORY;
-   memcpy(g_rom, romimage, size);
-   swap_rom(g_rom, &imagetype, g_rom_size);
+   swap_and_hash_rom(g_rom, &imagetype, g_rom_size, digest);
 
    memcpy(&ROM_HEADER, g_rom, sizeof(m64p_rom_header));
 
-   /* Calculate MD5 hash  */
-   md5_init(&state);
-   md5_append(&state, (const md5_byte_t*)g_rom, g_rom_size);
-   md5_finish(&state, digest);
+   /* Format MD5 hash  */
    for ( i = 0; i < 16; ++i )
       sprintf(buffer+i*2, "%02X", digest[i]);
    buffer[32] = '\0';
@@ -206,124 +521,49 @@ m64p_error open_rom(const unsigned char* romimage, unsigned int size)
 
    lut_id = (((uint64_t)sl(ROM_HEADER.CRC1)) << 32) | sl(ROM_HEADER.CRC2);
 
-   for (i = 0; i < sizeof(lut_ee16k)/sizeof(lut_ee16k[0]); ++i)
-   {
-      if (lut_ee16k[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         ROM_SETTINGS.savetype = EEPROM_16KB;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
-   }
-
-   for (i = 0; i < sizeof(lut_audiosignal)/sizeof(lut_audiosignal[0]); ++i)
-   {
-      if (lut_audiosignal[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         ROM_PARAMS.audiosignal = 1;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
-   }
-
-   for (i = 0; i < sizeof(lut_fixedaudiopos)/sizeof(lut_fixedaudiopos[0]); ++i)
-   {
-      if (lut_fixedaudiopos[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         ROM_PARAMS.fixedaudiopos = 1;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
-   }
-
-   for (i = 0; i < sizeof(lut_alternate_vi)/sizeof(lut_alternate_vi[0]); ++i)
-   {
-      if (lut_alternate_vi[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         alternate_vi_timing = 1;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
-   }
-
-   for (i = 0; i < sizeof(lut_vi_clock_1500)/sizeof(lut_vi_clock_1500[0]); ++i)
+   db = rom_db_find(lut_id, 0);
+   if (db)
+      entry = *db;
+   else
    {
-      if (lut_vi_clock_1500[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-	 g_vi_refresh_rate = 1500;
-
-         patch_applied = 1;
-         break;
-      }
+      memset(&entry, 0, sizeof(entry));
+      entry.id = lut_id;
    }
 
-   for (i = 0; i < sizeof(lut_vi_clock_1600)/sizeof(lut_vi_clock_1600[0]); ++i)
-   {
-      if (lut_vi_clock_1600[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-	 g_vi_refresh_rate = 1600;
+   rom_db_gfx_find(ROM_PARAMS.headername, &ROM_PARAMS.gfx_title, &ROM_PARAMS.gfx_hacks);
+   ROM_PARAMS.gfx_overrides[0] = '\0';
 
-         patch_applied = 1;
-         break;
-      }
-   }
+   if (rom_db_read_overrides(ROM_DB_OVERRIDE_FILE, &entry,
+            ROM_PARAMS.gfx_overrides, sizeof(ROM_PARAMS.gfx_overrides)))
+      DebugMessage(M64MSG_INFO, "%s settings overridden by %s.",
+            ROM_PARAMS.headername, ROM_DB_OVERRIDE_FILE);
 
-   for (i = 0; i < sizeof(lut_vi_clock_2200)/sizeof(lut_vi_clock_2200[0]); ++i)
+   if (entry.flags & ROM_DB_PATCHES)
    {
-      if (lut_vi_clock_2200[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-	 g_vi_refresh_rate = 2200;
-
-         patch_applied = 1;
-         break;
-      }
-   }
+      strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
 
-   for (i = 0; i < sizeof(lut_ee4k)/sizeof(lut_ee4k[0]); ++i)
-   {
-      if (lut_ee4k[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
+      if (entry.flags & ROM_DB_EEPROM_16KB)
+         ROM_SETTINGS.savetype = EEPROM_16KB;
+      if (entry.flags & ROM_DB_EEPROM_4KB)
          ROM_SETTINGS.savetype = EEPROM_4KB;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
-   }
-
-   for (i = 0; i < sizeof(lut_flashram)/sizeof(lut_flashram[0]); ++i)
-   {
-      if (lut_flashram[i] == lut_id)
-      {
-         strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
+      if (entry.flags & ROM_DB_FLASH_RAM)
          ROM_SETTINGS.savetype = FLASH_RAM;
-         DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
-
-         patch_applied = 1;
-         break;
-      }
+      if (entry.flags & ROM_DB_AUDIO_SIGNAL)
+         ROM_PARAMS.audiosignal = 1;
+      if (entry.flags & ROM_DB_FIXED_AUDIO_POS)
+         ROM_PARAMS.fixedaudiopos = 1;
+      if (entry.flags & ROM_DB_ALTERNATE_VI)
+         alternate_vi_timing = 1;
+      if (entry.flags & ROM_DB_VI_CLOCK_1500)
+         g_vi_refresh_rate = 1500;
+      if (entry.flags & ROM_DB_VI_CLOCK_1600)
+         g_vi_refresh_rate = 1600;
+      if (entry.flags & ROM_DB_VI_CLOCK_2200)
+         g_vi_refresh_rate = 2200;
+
+      DebugMessage(M64MSG_INFO, "%s INI patches applied.", ROM_PARAMS.headername);
    }
-
-   if (!patch_applied)
+   else
    {
       strcpy(ROM_SETTINGS.goodname, ROM_PARAMS.headername);
       strcat(ROM_SETTINGS.goodname, " (unknown rom)");
@@ -334,24 +574,16 @@ m64p_error open_rom(const unsigned char* romimage, unsigned int size)
       ROM_SETTINGS.rumble = 0;
    }
 
-   for (i = 0; i < sizeof(lut_cpop)/sizeof(lut_cpop[0]); ++i)
+   if (entry.flags & ROM_DB_COUNT_PER_OP)
    {
-      if (lut_cpop[i][0] == lut_id)
-      {
-         count_per_op = lut_cpop[i][1];
-         DebugMessage(M64MSG_INFO, "CountPerOp set to %u.", count_per_op);
-         break;
-      }
+      count_per_op = entry.count_per_op;
+      DebugMessage(M64MSG_INFO, "CountPerOp set to %u.", count_per_op);
    }
 
-   for (i = 0; i < sizeof(lut_sidmaduration)/sizeof(lut_sidmaduration[0]); ++i)
+   if (entry.flags & ROM_DB_SI_DMA_DURATION)
    {
-      if (lut_sidmaduration[i][0] == lut_id)
-      {
-         ROM_SETTINGS.sidmaduration = lut_sidmaduration[i][1];
-         DebugMessage(M64MSG_INFO, "SI DMA Duration set to %u.", ROM_SETTINGS.sidmaduration);
-         break;
-      }
+      ROM_SETTINGS.sidmaduration = entry.sidmaduration;
+      DebugMessage(M64MSG_INFO, "SI DMA Duration set to %u.", ROM_SETTINGS.sidmaduration);
    }
 
    if (frame_dupe)
@@ -359,14 +591,10 @@ m64p_error open_rom(const unsigned char* romimage, unsigned int size)
 
    g_delay_si = 1; /* default */
 
-   for (i = 0; i < sizeof(lut_delaysi)/sizeof(lut_delaysi[0]); ++i)
+   if (entry.flags & ROM_DB_DELAY_SI)
    {
-      if (lut_delaysi[i][0] == lut_id)
-      {
-         g_delay_si = lut_delaysi[i][1];
-         DebugMessage(M64MSG_INFO, "DelaySI set to %u.", g_delay_si);
-         break;
-      }
+      g_delay_si = entry.delay_si;
+      DebugMessage(M64MSG_INFO, "DelaySI set to %u.", g_delay_si);
    }
 
    /* print out a bunch of info about the ROM */
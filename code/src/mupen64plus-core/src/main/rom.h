@@ -29,6 +29,9 @@
 /* ROM Loading and Saving functions */
 
 m64p_error open_rom(const unsigned char* romimage, unsigned int size);
+/* Same as open_rom, but takes ownership of a malloc()ed image on success
+ * instead of copying it. The image is byteswapped in place. */
+m64p_error open_rom_buffer(unsigned char* romimage, unsigned int size);
 m64p_error close_rom(void);
 
 extern unsigned char* g_rom;
@@ -43,6 +46,11 @@ typedef struct _rom_params
    int fixedaudiopos;
    int audiosignal;
    int special_rom;
+   /* Glide64 settings as "key=value" lines: the sections of Glide64mk2.ini
+    * the header name matches, NULL if none, and those of romdb.ini */
+   const char *gfx_title;
+   const char *gfx_hacks;
+   char gfx_overrides[256];
 } rom_params;
 
 extern m64p_rom_header   ROM_HEADER;
@@ -0,0 +1,1183 @@
+/* This file was generated by gen_romhash.py from rom_luts.c and Glide64mk2.ini, */
+/* edit those and run it again instead of editing this file */
+
+#define ROM_DB_SIZE 662
+#define ROM_DB_BUCKETS 331
+
+static const uint16_t rom_db_disp[ROM_DB_BUCKETS] = {
+      12,     9,     7,     0,     1,     9,     5,     5,     8,     8,     2,     6,
+       2,     5,     5,     9,     1,     5,     3,     0,     6,     5,     1,     2,
+       1,     1,     1,     8,     5,     3,     3,     1,     4,    10,     9,     3,
+       1,     0,     6,     6,     5,     2,     0,    11,     2,    10,    14,     0,
+       2,     2,    12,     6,     2,     1,     2,     1,     1,     3,     3,     1,
+       3,     5,     7,     2,     4,     7,     1,    22,     1,     3,     0,     2,
+       0,     6,     6,     0,     8,     3,     1,    13,     0,     4,     2,    36,
+       3,    15,     5,     0,     4,     0,     5,     8,     0,     6,     2,     3,
+       4,    13,     9,     0,    18,     8,     4,    25,     7,    32,    14,    64,
+      10,     0,    22,    22,     2,     2,     1,     4,     7,     2,     2,     0,
+       1,     3,     1,     4,     1,    30,     5,     4,     5,     6,     0,     1,
+       3,     8,     3,     0,     0,     0,    24,     5,     4,    61,    12,     9,
+       5,     1,     6,     8,     0,     0,     0,     4,     0,    32,     9,    15,
+       1,    31,    19,     3,     0,     0,     4,     7,     3,     1,    57,    13,
+      11,    10,    30,    14,     7,     2,     9,     0,     2,     0,     1,     1,
+       6,     3,    15,     6,     4,    10,     0,    41,    67,    52,     6,     2,
+       7,    21,     1,     0,     3,    15,    37,     7,     9,     5,     9,    10,
+      37,     0,     0,    13,    32,     0,     1,     3,     8,     5,    19,     5,
+       5,     9,    28,    24,     2,     2,     1,    16,    17,     7,    32,     2,
+      20,     7,    14,     2,    32,     1,     6,     1,    24,    23,     9,    22,
+      18,    14,    26,     3,    44,     4,    44,     0,     2,     6,     8,     9,
+      50,    24,     0,    18,    63,     2,    39,     2,    16,    10,     4,     6,
+      11,    13,     1,     0,     1,     1,    12,     4,     5,    28,    39,    21,
+       1,    23,     0,    32,    26,     7,     2,     2,    12,    32,    29,   146,
+      86,    93,    44,    27,     9,    63,    28,     2,    46,    32,     0,     0,
+      28,     6,    10,     4,   282,     2,     8,     7,    73,   147,     0,    55,
+      31,     6,     3,   189,     0,   239,    40,     0,    27,    12,     0,     0,
+      72,  1262,    24,    45,     1,     1,     3
+};
+
+static const struct rom_db_entry rom_db[ROM_DB_SIZE] = {
+   { 0x2483F22B136E025EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Lylat Wars (A) (M3) [!] */
+   { 0xA794152861F1199DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chou Snobow Kids (J) [!] */
+   { 0x053C89A7A5064302ULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Donkey Kong 64 (J) [!] */
+   { 0x4DD7ED5474F9287DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Shadows of the Empire (U) (V1.2) [!] */
+   { 0x222123514046594BULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Sonic Wings Assault (J) [!] */
+   { 0xC8DC65EB3D8C8904ULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hydro Thunder (U) [!] */
+   { 0x418BDA98248A0F58ULL, ROM_DB_EEPROM_4KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Mischief Makers (E) [!] */
+   { 0x4147B09163251060ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Shadows of the Empire (U) (V1.1) [!] */
+   { 0xF4CBE92CB392ED12ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Lylat Wars (E) (M3) [!] */
+   { 0xFD4358870C79642EULL, ROM_DB_NAME, 0, 0, 0x0, 108, 0 }, /* Glide64: STAR TWINS */
+   { 0xC9C3A9875810344CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mario Kart 64 (J) (V1.1) [!] */
+   { 0x7F9345D3841ECADEULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mystical Ninja 2 Starring Goemon (E) (M3) [!] */
+   { 0x1739EFBAD0B43A68ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Kobe Bryant in NBA Courtside (E) [!] */
+   { 0x2558AC2F3EFD4FC7ULL, ROM_DB_NAME, 0, 0, 0x0, 179, 0 }, /* Glide64: KNIFE EDGE */
+   { 0x867C008334DBD2B5ULL, ROM_DB_NAME, 0, 0, 0x0, 15, 25 }, /* Glide64: BANJO KAZOOIE 2 */
+   { 0x44718729A056EEFAULL, ROM_DB_NAME, 0, 0, 0x0, 187, 0 }, /* Glide64: Snobow Kids 2 */
+   { 0x9E8FCDFA49F5652BULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (U) (V1.1) [!] */
+   { 0x4998DDBBF7B7AEBCULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nuclear Strike 64 (U) [!] */
+   { 0xB6BF3BE575D0E61DULL, ROM_DB_NAME, 0, 0, 0x0, 28, 0 }, /* Glide64: MICKEY USA PAL */
+   { 0x3FFE80F4A7C15F7EULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* NBA Showtime - NBA on NBC (U) [!] */
+   { 0x0F7EAC6EC4CC3AE0ULL, ROM_DB_NAME, 0, 0, 0x0, 12, 0 }, /* Glide64: BAKU-BOMBERMAN */
+   { 0x60460680305F0E72ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Lode Runner 3-D (E) (M5) [!] */
+   { 0xEC58EABFAD7C7169ULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Donkey Kong 64 (U) [!] */
+   { 0x366476E0B5DDE060ULL, ROM_DB_NAME, 0, 0, 0x0, 121, 0 }, /* Glide64: IT&F SUMMERGAMES */
+   { 0xA8275140B9B056E8ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Doraemon 3 - Nobita no Machi SOS! (J) [!] */
+   { 0x8A6009B694ACE150ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Jet Force Gemini (U) [!] */
+   { 0xB54CE881BCCB6126ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* PGA European Tour (U) [!] */
+   { 0x3B7C3AD832AFA4AAULL, ROM_DB_NAME, 0, 0, 0x0, 126, 0 }, /* Glide64: MO WORLD LEAGUE SOCC */
+   { 0x93AE6865C4D10C69ULL, ROM_DB_NAME, 0, 0, 0x0, 160, 0 }, /* Glide64: WAVE RACE 64 */
+   { 0xE2D37CF0F57E4EAEULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* International Superstar Soccer 64 (E) [!] */
+   { 0x2BCCF9C4403D9F6FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Choro Q 64 (J) [!] */
+   { 0x596E145BF7D9879FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (E) (M3) (V1.1) [!] */
+   { 0xD5356BAC97AE69D2ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Magical Tetris Challenge Featuring Mickey (J) [ALECK64] */
+   { 0x5001CF4FF30CB3BDULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Mario Tennis (U) [!] */
+   { 0x163B4E389054345EULL, ROM_DB_NAME, 0, 0, 0x0, 56, 0 }, /* Glide64: custom robo */
+   { 0x5AC383E1D712E387ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Monopoly (U) [!] */
+   { 0x636E6B19E57DDC5FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* V-Rally Edition 99 (E) (M3) [!] */
+   { 0x6D9D1FE484D10BEAULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Eleven Beat - World Tournament (J) [ALECK64] */
+   { 0x3A6C42B51ACADA1BULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Mario Tennis 64 (J) [!] */
+   { 0xDD484E012774CBC8ULL, ROM_DB_NAME, 0, 0, 0x0, 124, 0 }, /* Glide64: KEN GRIFFEY SLUGFEST */
+   { 0x630AA37D896BD7DBULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Destruction Derby 64 (E) (M3) [!] */
+   { 0xD064916EE27734CDULL, ROM_DB_NAME, 0, 0, 0x0, 90, 0 }, /* Glide64: HARVESTMOON64 */
+   { 0xFE271CF2B2201066ULL, ROM_DB_NAME, 0, 0, 0x0, 77, 0 }, /* Glide64: NBA Courtside 2 */
+   { 0x2D21C57B8FE4C58CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Worms - Armageddon (E) (M6) [!] */
+   { 0x82DC04FDCF2D82F4ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bug's Life, A (U) [!] */
+   { 0x6D599446100D2436ULL, ROM_DB_NAME, 0, 0, 0x0, 13, 0 }, /* Glide64: BAKUBOMB2 */
+   { 0xD575691F8608BC6CULL, ROM_DB_NAME, 0, 0, 0x0, 3, 0 }, /* Glide64: Toy Story 2 */
+   { 0x73ABB1FB9CCA6093ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Penny Racers (U) [!] */
+   { 0xD5E5D349E9A1E6FCULL, ROM_DB_NAME, 0, 0, 0x0, 19, 0 }, /* Glide64: Bust A Move 3 DX */
+   { 0xA6E88CE9782AE120ULL, ROM_DB_NAME, 0, 0, 0x0, 55, 0 }, /* Glide64: CruisnExotica */
+   { 0xB21313B54BEB09EDULL, ROM_DB_NAME, 0, 0, 0x0, 6, 5 }, /* Glide64: All-Star Baseball 20 */
+   { 0xA23553A342BF2D39ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (F) [!] */
+   { 0x66CF0FFEAD697F9CULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Fighting Force 64 (E) [!] */
+   { 0x19C553A7A70F4B52ULL, ROM_DB_ALTERNATE_VI | ROM_DB_VI_CLOCK_1500 | ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Puzzle League (U) */
+   { 0x28D5562DE4D5AE50ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Uchhannanchan no Hono no Challenger - Denryu IraIra Bou (J) [!] */
+   { 0x3EB6F5EC426936D0ULL, ROM_DB_NAME, 0, 0, 0x0, 178, 18 }, /* Glide64: KILLER INSTINCT GOLD */
+   { 0xE73A85045A140B4BULL, ROM_DB_NAME, 0, 0, 0x0, 12, 0 }, /* Glide64: BOMBERMAN64U2 */
+   { 0xE0C4F72F769E1506ULL, ROM_DB_FLASH_RAM | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Tigger's Honey Hunt (E) (M7) [!] */
+   { 0xFEE970104E94A9A0ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* RR64 - Ridge Racer 64 (E) [!] */
+   { 0x5DF07184F768601AULL, ROM_DB_NAME, 0, 0, 0x0, 152, 0 }, /* Glide64: CASTLEVANIA2 */
+   { 0x492F4B6104E5146AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Wave Race 64 (U) (V1.1) [!] */
+   { 0xB98169BFAE9F441DULL, ROM_DB_NAME, 0, 0, 0x0, 146, 0 }, /* Glide64: PowerLeague64 */
+   { 0x569AA64A7736EACAULL, ROM_DB_NAME, 0, 0, 0x0, 116, 0 }, /* Glide64: \xD0\xDD\xC5\xC3\xDE\xC0\xCF\xBA\xDE\xAF\xC1\xDC\xB0\xD9\xC4\xDE */
+   { 0xE185E2914E50766DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* All Star Tennis '99 (U) [!] */
+   { 0xF468118CE32EE44EULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* PD Ultraman Battle Collection 64 (J) [!] */
+   { 0x535DF3E2609789F1ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Wave Race 64 - Shindou Edition (J) (V1.2) [!] */
+   { 0x4180944641C4CBA2ULL, ROM_DB_NAME, 0, 0, 0x0, 111, 0 }, /* Glide64: \xB7\xD7\xAF\xC4\xB6\xB2\xB9\xC2 64\xC0\xDD\xC3\xB2\xC0\xDE\xDD */
+   { 0xDA824BBA337049F5ULL, ROM_DB_NAME, 0, 0, 0x0, 49, 11 }, /* Glide64: BioHazard II */
+   { 0xFA8C4571BBE7F9C0ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mickey's Speedway USA (U) [!] */
+   { 0x66A24BEC2EADD94FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Rogue Squadron (U) (M3) [!] */
+   { 0xB15F68114EB50837ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 26 }, /* Glide64: RoadToWorldCup98 */
+   { 0x53D440E77519B011ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (U) (M2) (V1.0) [!] */
+   { 0xB6CF0000C61D72E9ULL, ROM_DB_NAME, 0, 0, 0x0, 180, 19 }, /* Glide64: Knockout Kings 2000 */
+   { 0x75A4E2476008963DULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* BattleTanx - Global Assault (U) [!] */
+   { 0x20095B34343D9E87ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (F) [!] */
+   { 0xDD67511BB9B16BF5ULL, ROM_DB_NAME, 0, 0, 0x0, 128, 0 }, /* Glide64: PACHINKO365NICHI */
+   { 0x409A9A3642C2D764ULL, ROM_DB_NAME, 0, 0, 0x0, 147, 0 }, /* Glide64: Racing Simulation 2 */
+   { 0xBAFBD87D415BBD02ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 21 }, /* Glide64: OgreBattle64 */
+   { 0xE8C54A31123B5606ULL, ROM_DB_NAME, 0, 0, 0x0, 164, 0 }, /* Glide64: Doom64 */
+   { 0x2ADD4E4D7FDE7A3DULL, ROM_DB_NAME, 0, 0, 0x0, 96, 0 }, /* Glide64: NFL BLITZ 2001 */
+   { 0x93053075261E0F43ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Waialae Country Club - True Golf Classics (E) (M4) (V1.0) [!] */
+   { 0x0EE73C47C48120C6ULL, ROM_DB_NAME, 0, 0, 0x0, 119, 7 }, /* Glide64: I S S 64 */
+   { 0xF34DB9DA909A15A5ULL, ROM_DB_NAME, 0, 0, 0x0, 123, 7 }, /* Glide64: J WORLD SOCCER3 */
+   { 0x73D6A2469206CD4EULL, ROM_DB_NAME, 0, 0, 0x0, 138, 31 }, /* Glide64: PUZZLE LEAGUE */
+   { 0xB443EB084DB31193ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Legend of Zelda, The - Majora's Mask (U) (GC) */
+   { 0xE68AA23AC4C3BFEAULL, ROM_DB_NAME, 0, 0, 0x0, 78, 0 }, /* Glide64: NBA JAM 2000 */
+   { 0xEC0F690D32A7438CULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pocket Monsters Snap (J) [!] */
+   { 0xDAC33EB26ADF7517ULL, ROM_DB_NAME, 0, 0, 0x0, 109, 0 }, /* Glide64: \xC4\xDE\xD7\xB4\xD3\xDD \xD0\xAF\xC2\xC9\xBE\xB2\xDA\xB2\xBE\xB7 */
+   { 0x85A772F1D5E7CDCAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Super Mario 64 60fps */
+   { 0x3091FB57DF9C20C4ULL, ROM_DB_NAME, 0, 0, 0x0, 175, 30 }, /* Glide64: Blast Corps */
+   { 0xC56741600F5F453CULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 3 (E) (M4) [!] */
+   { 0xB1CBF5B54BAED450ULL, ROM_DB_NAME, 0, 0, 0x0, 8, 5 }, /* Glide64: All-Star Baseball '0 */
+   { 0x1F14BA0B9E1B0688ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 3 }, /* Glide64: Diddy Kong Racing */
+   { 0x66751A5754A29D6EULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hexen (J) [!] */
+   { 0xC0C8504661051B05ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (I) [!] */
+   { 0xC4C8FE13FCC072DBULL, ROM_DB_NAME, 0, 0, 0x0, 42, 0 }, /* Glide64: TONY HAWK PRO SKATER */
+   { 0x0414CA612E57B8AAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* GoldenEye 007 (E) [!] */
+   { 0xD4CFE3420AAC30B4ULL, ROM_DB_NAME, 0, 0, 0x0, 51, 0 }, /* Glide64: EXCITEBIKE64 */
+   { 0x149A02615287F44BULL, ROM_DB_NAME, 0, 0, 0x0, 188, 0 }, /* Glide64: South Park Chef's Lu */
+   { 0x31063C8CBA71D9FEULL, ROM_DB_NAME, 0, 0, 0x0, 7, 5 }, /* Glide64: All Star Baseball 99 */
+   { 0x5753720D2A8A884DULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (G) [!] */
+   { 0x32EFC7CBC3EA3F20ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Fighting Force 64 (U) [!] */
+   { 0x0074A21FEA15C818ULL, ROM_DB_NAME, 0, 0, 0x0, 18, 6 }, /* Glide64: BEETLE ADVENTURE JP */
+   { 0x442C4B8B1DA7FFABULL, ROM_DB_NAME, 0, 0, 0x0, 0, 1 }, /* Glide64: ZELDA */
+   { 0xD741CD80ACA9B912ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Top Gear Overdrive (U) [!] */
+   { 0x587985A29A2A4BF6ULL, ROM_DB_NAME, 0, 0, 0x0, 67, 0 }, /* Glide64: Donald Duck Quack At */
+   { 0x1BDCB30FA132D876ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Pro Mahjong Tsuwamono 64 - Jansou Battle ni Chousen (J) [!] */
+   { 0xA7D015F82289AA43ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Fox 64 (U) (V1.0) [!] */
+   { 0xCF2FDD15BE9A51AAULL, ROM_DB_NAME, 0, 0, 0x0, 151, 0 }, /* Glide64: DRACULA MOKUSHIROKU2 */
+   { 0xB98BA4565B2B76AFULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* 64 de Hakken!! Tamagotchi Minna de Tamagotchi World (J) [!] */
+   { 0xCC94FAFD1146143BULL, ROM_DB_NAME, 0, 0, 0x0, 12, 0 }, /* Glide64: BOMBERMAN64U */
+   { 0x51D29418D5B46AE3ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* San Francisco Rush 2049 (E) (M6) [!] */
+   { 0x817277FDB0E360CAULL, ROM_DB_NAME, 0, 0, 0x0, 14, 0 }, /* Glide64: BANGAIOH */
+   { 0xB6306E99B63ED2B2ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Doraemon 2 - Nobita to Hikari no Shinden (J) [!] */
+   { 0x2D8A0ED62D114515ULL, ROM_DB_NAME, 0, 0, 0x0, 185, 0 }, /* Glide64: Quest 64 */
+   { 0xEA06F8C307C2DEEDULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Shadow Man (F) [!] */
+   { 0xBCB1F89F060752A2ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Hoshi no Kirby 64 (J) (V1.3) [!] */
+   { 0xFE94E570E4873A9CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Fighter's Destiny (G) [!] */
+   { 0x237E73B4D63B6B37ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman 64 - The Second Attack! (U) [!] */
+   { 0xC16C421BA21580F7ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Disney's Donald Duck - Goin' Quackers (U) [!] */
+   { 0x98F9F2D003D9F09CULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Virtual Pool 64 (E) [!] */
+   { 0xB9A9ECA217AAE48EULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* San Francisco Rush 2049 (U) [!] */
+   { 0x3C572BD31E0C92A9ULL, ROM_DB_NAME, 0, 0, 0x0, 197, 0 }, /* Glide64: SM64 Star Road */
+   { 0xCEB5EA1FAD25B14EULL, ROM_DB_NAME, 0, 0, 0x0, 143, 0 }, /* Glide64: RALLY CHALLENGE */
+   { 0x3BA7CDDC464E52A0ULL, ROM_DB_FLASH_RAM | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Story (J) [!] */
+   { 0x8C138BE095700E46ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* In-Fisherman Bass Hunter 64 (U) [!] */
+   { 0xA24F4CF1A82327BAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* GoldenEye 007 (J) [!] */
+   { 0x20962D1DAC7AF936ULL, ROM_DB_NAME, 0, 0, 0x0, 199, 0 }, /* Glide64: TETRISPHERE */
+   { 0xED99ADF8E999DFA6ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 6 }, /* Glide64: BEETLE */
+   { 0x685410BE78F9FFD6ULL, ROM_DB_NAME, 0, 0, 0x0, 39, 0 }, /* Glide64: TG RALLY 2 */
+   { 0xD666593BD7A25C07ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Rockman Dash (J) [!] */
+   { 0x5306CF45CBC49250ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n USA (U) (V1.1) [!] */
+   { 0xF9D153D3F9D58BB5ULL, ROM_DB_NAME, 0, 0, 0x0, 17, 0 }, /* Glide64: BATTLEZONE */
+   { 0x315C74663A453265ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Star Soldier - Vanishing Earth (J) [!] [ALECK64] */
+   { 0xB7CF2136FA0AA715ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Rush 2 - Extreme Racing USA (E) (M6) [!] */
+   { 0xA1B64A61D014940BULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Beetle Adventure Racing! (E) (M3) [!] */
+   { 0xDFF227D90D4D8169ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bug's Life, A (G) [!] */
+   { 0x65234451EBD3346FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Blast Dozer (J) [!] */
+   { 0xC9176D39EA4779D1ULL, ROM_DB_EEPROM_16KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Banjo-Tooie (E) (M4) [!] */
+   { 0xB9AF8CC6DEC9F19FULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chameleon Twist (E) [!] */
+   { 0x4DE31E0CCC94D40AULL, ROM_DB_NAME, 0, 0, 0x0, 153, 0 }, /* Glide64: Dual heroes USA */
+   { 0xD3D806FCB43AA2A8ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Monster Truck Madness 64 (E) (M5) [!] */
+   { 0xB52FB22B06074CD8ULL, ROM_DB_NAME, 0, 0, 0x0, 5, 0 }, /* Glide64: AIDYN CHRONICLES */
+   { 0x9B500E8EE90550B3ULL, ROM_DB_VI_CLOCK_2200, 0, 0, 0x0, 0, 0 }, /* Resident Evil 2 (E) (M2) [!] */
+   { 0x9C961069F5EA488DULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* 64 Oozumou (J) [!] */
+   { 0xF51F2798BC670F28ULL, ROM_DB_NAME, 0, 0, 0x0, 105, 0 }, /* Glide64: V-RALLY */
+   { 0x0684FBFB5D3EA8A5ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* StarCraft 64 (U) [!] */
+   { 0x971F1C931EBADE08ULL, ROM_DB_NAME, 0, 0, 0x0, 21, 0 }, /* Glide64: CARMAGEDDON64 */
+   { 0x12A3F256C2B21ACDULL, ROM_DB_NAME, 0, 0, 0x0, 134, 0 }, /* Glide64: SCARS */
+   { 0x0C5057AD046E126EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Waialae Country Club - True Golf Classics (E) (M4) (V1.1) [!] */
+   { 0x4EAA3D0E74757C24ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Super Mario 64 (J) [!] */
+   { 0x7F3CEB778981030AULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hercules - The Legendary Journeys (U) [!] */
+   { 0xAA6988BA7DA2B47EULL, ROM_DB_NAME, 0, 0, 0x0, 16, 0 }, /* Glide64: BASS HUNTER 64 */
+   { 0x09CC4801E42EE491ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Pilotwings 64 (J) [!] */
+   { 0x0C64EC5C09128221ULL, ROM_DB_NAME, 0, 0, 0x0, 156, 29 }, /* Glide64: GOLDENEYE */
+   { 0x2C3799B0664BE222ULL, ROM_DB_NAME, 0, 0, 0x0, 52, 0 }, /* Glide64: \xB4\xB8\xBD\xC4\xD8\xB0\xD1G2 */
+   { 0x9F8B96C3A01194DCULL, ROM_DB_COUNT_PER_OP | ROM_DB_DELAY_SI, 1, 0, 0x0, 0, 0 }, /* Yakouchuu II - Satsujin Kouro (J) */
+   { 0x44C876587AE694DCULL, ROM_DB_NAME, 0, 0, 0x0, 99, 0 }, /* Glide64: NEWTETRIS */
+   { 0x775AFA9C0EB52EF6ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hard Coded Demo by Silo and Fractal (PD) [a1] */
+   { 0xF19CF14C662457DEULL, ROM_DB_NAME, 0, 0, 0x0, 75, 0 }, /* Glide64: G.A.S.P!!Fighters'NE */
+   { 0x373ADBCE8B712F9BULL, ROM_DB_NAME, 0, 0, 0x0, 1, 0 }, /* Glide64: 1080 SNOWBOARDING */
+   { 0x2169BFD0971B8D13ULL, ROM_DB_NAME, 0, 0, 0x0, 20, 0 }, /* Glide64: Bust A Move 2 */
+   { 0x35FF8F1A6E79E3BEULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hiryuu no Ken Twin (J) [!] */
+   { 0x514B6900B4B19881ULL, ROM_DB_EEPROM_16KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Banjo to Kazooie no Daibouken 2 (J) [!] */
+   { 0xF110A582ECDA3BC9ULL, ROM_DB_NAME, 0, 0, 0x0, 89, 0 }, /* Glide64: \xCA\xD1\xBD\xC0\xB0\xD3\xC9\xB6\xDE\xC0\xD864 */
+   { 0x4B4519ED26E2C60AULL, ROM_DB_NAME, 0, 0, 0x0, 29, 28 }, /* Glide64: MISCHIEF MAKERS */
+   { 0x94EDA5B88673E903ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Starshot - Space Circus Fever (U) (M3) [!] */
+   { 0x78AB36780702CEF4ULL, ROM_DB_NAME, 0, 0, 0x0, 24, 0 }, /* Glide64: Chameleon Twist2 */
+   { 0xD6019ED572AB2BCDULL, ROM_DB_NAME, 0, 0, 0x0, 64, 0 }, /* Glide64: Command&Conquer */
+   { 0x503EA760E1300E96ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n USA (E) [!] */
+   { 0x21B3125B071F5FCDULL, ROM_DB_NAME, 0, 0, 0x0, 169, 0 }, /* Glide64: RIDGE RACER 64 */
+   { 0x78FC1A0CE4EE8820ULL, ROM_DB_NAME, 0, 0, 0x0, 153, 0 }, /* Glide64: Dual heroes PAL */
+   { 0x47D8658EED5E5911ULL, ROM_DB_NAME, 0, 0, 0x0, 86, 0 }, /* Glide64: GOEMONS GREAT ADV */
+   { 0x740C16E73F50B4CFULL, ROM_DB_NAME, 0, 0, 0x0, 82, 0 }, /* Glide64: NFL QBC 2000 */
+   { 0xA03CF036BCC1C5D2ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Super Mario 64 (E) (M3) [!] */
+   { 0x5326696FFE9A99C3ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Body Harvest (U) [!] */
+   { 0xE2252E0A7F9FB681ULL, ROM_DB_NAME, 0, 0, 0x0, 166, 1 }, /* Glide64: THE MASK OF MUJURA */
+   { 0xDDF460CC3CA634C0ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Perfect Dark (U) (V1.0) [!] */
+   { 0xFD3BCFB6BE114E4CULL, ROM_DB_NAME, 0, 0, 0x0, 152, 0 }, /* Glide64: CASTLEVANIA */
+   { 0x72F703986556A98BULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Star Wars Episode I - Racer (U) [!] */
+   { 0xFB0A954AE386A7DCULL, ROM_DB_NAME, 0, 0, 0x0, 34, 0 }, /* Glide64: SPIDERMAN */
+   { 0x42011E1BE3552DB5ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (G) [!] */
+   { 0xD137A2CA62B65053ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Shigesato Itoi's No. 1 Bass Fishing! Definitive Edition (J) [!] */
+   { 0xA4BF9306BF0CDFD1ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Banjo-Kazooie (U) (V1.0) [!] */
+   { 0xB6E549CEDC8134C0ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (S) [!] */
+   { 0xD7134F8DC11A00B5ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Madden NFL 2002 (U) [!] */
+   { 0xB5025BADD32675FDULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Command & Conquer (G) [!] */
+   { 0x4FF5976FACF559D8ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (E) [!] */
+   { 0x7EE0E8BB49E411AAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Rogue Squadron (E) (M3) (V1.0) [!] */
+   { 0x65EEE53AED7D733CULL, ROM_DB_FLASH_RAM | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Paper Mario (U) [!] */
+   { 0x3844263466B3F060ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* F-1 World Grand Prix (G) [!] */
+   { 0xAC5AA5C7A9B0CDC3ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (F) [!] */
+   { 0xC3B6DE9D65D2DE76ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mario Kart 64 (E) (V1.0) [!] */
+   { 0x797B00283C2D1E54ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 26 }, /* Glide64: FIFA: RTWC 98 */
+   { 0x9E7F0EDA4D0192C4ULL, ROM_DB_NAME, 0, 0, 0x0, 137, 0 }, /* Glide64: Parlor PRO 64 */
+   { 0xD614E5BFA76DBCC1ULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Disney's Tarzan (E) [!] */
+   { 0xD3617633B562252AULL, ROM_DB_NAME, 0, 0, 0x0, 98, 0 }, /* Glide64: \xD3\xD8\xC0\xBC\xAE\xB3\xB7\xDE64 */
+   { 0x0B93051B603D81F9ULL, ROM_DB_EEPROM_4KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Mischief Makers (U) [!] */
+   { 0xDFD784ADAE426603ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* All Star Tennis '99 (E) (M5) [!] */
+   { 0x22E9623FB60E52ADULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Flying Dragon (E) [!] */
+   { 0x5C9191D6B30AC306ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Wave Race 64 (J) [!] */
+   { 0xB088FBB4441E4B1DULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bass Hunter 64 (E) [!] */
+   { 0x14D25D89EC2ECE2CULL, ROM_DB_NAME, 0, 0, 0x0, 113, 23 }, /* Glide64: Supercross */
+   { 0xA9C0A89A65C435EAULL, ROM_DB_NAME, 0, 0, 0x0, 38, 0 }, /* Glide64: TELEFOOT SOCCER 2000 */
+   { 0x817D286AEF417416ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (S) [!] */
+   { 0x4B91C1930D524976ULL, ROM_DB_NAME, 0, 0, 0x0, 118, 17 }, /* Glide64: Top Gear Hyper Bike */
+   { 0xD715CC70271CF5D6ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* War Gods (E) [!] */
+   { 0x964ADD0BB29213DBULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Lode Runner 3-D (J) [!] */
+   { 0xE73C7C4FAF93B838ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Baku Bomberman 2 (J) [!] */
+   { 0x5354631C03A2DEF0ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Legend of Zelda, The - Majora's Mask (U) [!] */
+   { 0x9BA10C4E0408ABD3ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Pro Mahjong Kiwame 64 (J) [!] */
+   { 0xFB3C48D08D28F69FULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Charlie Blast's Territory (E) [!] */
+   { 0x54310E7D6B5430D8ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Wipeout 64 (E) [!] */
+   { 0x9D81BCC52A086E95ULL, ROM_DB_NAME, 0, 0, 0x0, 140, 0 }, /* Glide64: POKEMON STADIUM */
+   { 0xCD12A364AE084DD7ULL, ROM_DB_NAME, 0, 0, 0x0, 189, 0 }, /* Glide64: LAMBORGHINI */
+   { 0x1C2E3B4422C55C47ULL, ROM_DB_NAME, 0, 0, 0x0, 148, 16 }, /* Glide64: TOP GEAR RALLY */
+   { 0x2099AC2B7A1BCC90ULL, ROM_DB_NAME, 0, 0, 0x0, 201, 12 }, /* Glide64: YOSHI STORY */
+   { 0x0C581C7A3D6E20E4ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Hoshi no Kirby 64 (J) (V1.2) [!] */
+   { 0x3F245305FC0B74AAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Pikachu Genki Dechu (J) [!] */
+   { 0xBE012F7109740297ULL, ROM_DB_NAME, 0, 0, 0x0, 122, 0 }, /* Glide64: J_league 1997 */
+   { 0x1B598BF1ECA29B45ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* AeroFighters Assault (U) [!] */
+   { 0xC1000BC5115D4673ULL, ROM_DB_NAME, 0, 0, 0x0, 144, 0 }, /* Glide64: Rayman 2 */
+   { 0x8D0BC418D46C9F44ULL, ROM_DB_NAME, 0, 0, 0x0, 133, 0 }, /* Glide64: RUSH 2049 */
+   { 0x68D7A1DE0079834AULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Jet Force Gemini (E) (M4) [!] */
+   { 0x2E9E38157121A816ULL, ROM_DB_NAME, 0, 0, 0x0, 48, 0 }, /* Glide64: Perfect Dark */
+   { 0xDDD1FB7BDD498BF6ULL, ROM_DB_NAME, 0, 0, 0x0, 92, 14 }, /* Glide64: MARIO STORY */
+   { 0x7435C9BB39763CF4ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (J) */
+   { 0xCA12B54771FA4EE4ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (U) [!] */
+   { 0xF7FE28F6C3F2ACC3ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* War Gods (U) [!] */
+   { 0xAA18B1A507DB6AEBULL, ROM_DB_VI_CLOCK_2200, 0, 0, 0x0, 0, 0 }, /* Resident Evil 2 (U) (V1.1) [!] */
+   { 0x26035CF8802B9135ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (U) [!] */
+   { 0xD4C45A1AF425B25EULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* WCW Nitro (U) [!] */
+   { 0xD89E0E55B17AA99AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Starshot - Space Circus Fever (E) (M3) [!] */
+   { 0xF523730199E3EE93ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Glover (E) (M3) [!] */
+   { 0x9D7573AB17AA0172ULL, ROM_DB_NAME, 0, 0, 0x0, 155, 0 }, /* Glide64: Kirby64 */
+   { 0xEBA949DC39BAECBDULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (I) [!] */
+   { 0xB0836A494B597675ULL, ROM_DB_NAME, 0, 0, 0x0, 43, 15 }, /* Glide64: TOP GEAR RALLY 2 */
+   { 0x0B58B8CDB7B291D2ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Body Harvest (E) (M3) [!] */
+   { 0xB19AD9997E585118ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Monster Truck Madness 64 (U) [!] */
+   { 0x98DF9DFC6606C189ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Harvest Moon 64 (U) [!] */
+   { 0xBDBAFF07E3AE5E91ULL, ROM_DB_NAME, 0, 0, 0x0, 175, 30 }, /* Glide64: Blastdozer */
+   { 0x36281F23009756CFULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Ken Griffey Jr.'s Slugfest (U) [!] */
+   { 0xCB06B744633194DBULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (U) (V1.0) [b1][t1] */
+   { 0x7D680CCE2C4F9771ULL, ROM_DB_NAME, 0, 0, 0x0, 46, 0 }, /* Glide64: TSUMI TO BATSU */
+   { 0x49906619CDD0690EULL, ROM_DB_NAME, 0, 0, 0x0, 0, 6 }, /* Glide64: HSV */
+   { 0x04F7D265398D8267ULL, ROM_DB_NAME, 0, 0, 0x0, 115, 0 }, /* Glide64: \xBD\xBD\xD2!\xC0\xB2\xBE\xDD\xCA\xDF\xBD\xDE\xD9\xC0\xDE\xCF */
+   { 0x963ADBA6F7D5C89BULL, ROM_DB_SI_DMA_DURATION, 0, 0, 0x64, 0, 0 }, /* Tetris 64 (J) */
+   { 0x1A122D43C17DAF0FULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (U) (V1.1) [!] */
+   { 0x7C647C25D9D901E6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Blast Corps (U) (V1.0) [!] */
+   { 0xF2CAD3CD0FDF36E9ULL, ROM_DB_NAME, 0, 0, 0x0, 42, 0 }, /* Glide64: THPS3 */
+   { 0xDDD93C85DAE381E8ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Soldier - Vanishing Earth (U) [!] */
+   { 0x1E08DA785D6A7640ULL, ROM_DB_NAME, 0, 0, 0x0, 66, 0 }, /* Glide64: DARK RIFT */
+   { 0xE4C82C9D18F96012ULL, ROM_DB_NAME, 0, 0, 0x0, 19, 0 }, /* Glide64: Bust A Move '99 */
+   { 0x0A1667C7293346A6ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Xena Warrior Princess - The Talisman of Fate (E) [!] */
+   { 0x0FE684A98BB77AC4ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Tetrisphere (E) [!] */
+   { 0xBA6CE1CC9CF169D5ULL, ROM_DB_NAME, 0, 0, 0x0, 37, 0 }, /* Glide64: STAR WARS EP1 RACER */
+   { 0x147E0EDB36C5B12CULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Neon Genesis Evangelion (J) [!] */
+   { 0xFA6F4ABBB897D9CCULL, ROM_DB_NAME, 0, 0, 0x0, 195, 0 }, /* Glide64: Turok 2 */
+   { 0x0DD4ABABB5A2A91EULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Donkey Kong 64 (U) (Kiosk Demo) [!] */
+   { 0x154C366BF18F9CC4ULL, ROM_DB_NAME, 0, 0, 0x0, 158, 0 }, /* Glide64: Glover */
+   { 0x2B38AEC06350B810ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bug's Life, A (F) [!] */
+   { 0x67FF12CC76BF0212ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman Hero - Mirian Oujo wo Sukue! (J) [!] */
+   { 0xEE4A0E338FD588C9ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* GT 64 - Championship Edition (E) (M3) [!] */
+   { 0x19AB29AFC71BCD28ULL, ROM_DB_FLASH_RAM | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Paper Mario (E) (M4) [!] */
+   { 0x936C9D63047CB81BULL, ROM_DB_NAME, 0, 0, 0x0, 97, 0 }, /* Glide64: Monaco Grand Prix */
+   { 0x7973A82E2F2DC10DULL, ROM_DB_NAME, 0, 0, 0x0, 100, 0 }, /* Glide64: MLB FEATURING K G JR */
+   { 0xED567D0F38B08915ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 2 (J) [!] */
+   { 0x30C7AC507704072DULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Conker's Bad Fur Day (U) [!] */
+   { 0xF908CA4C36464327ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (U) (V1.2) [!] */
+   { 0x916852D873DBEAEFULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* NBA Courtside 2 - Featuring Kobe Bryant (U) [!] */
+   { 0xC49ADCA2F1501B62ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* GT 64 - Championship Edition (U) [!] */
+   { 0x1ECEF1D5AE4370E3ULL, ROM_DB_NAME, 0, 0, 0x0, 36, 0 }, /* Glide64: STAR SOLDIER */
+   { 0x857DD4D41B96C925ULL, ROM_DB_NAME, 0, 0, 0x0, 92, 14 }, /* Glide64: PAPER MARIO */
+   { 0xC33333AED327987DULL, ROM_DB_NAME, 0, 0, 0x0, 35, 24 }, /* Glide64: STARCRAFT 64 */
+   { 0x2857674DCC4337DAULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nightmare Creatures (U) [!] */
+   { 0xE340A49C74318D41ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Baku Bomberman (J) [!] */
+   { 0x03EB2E6F362F9EFEULL, ROM_DB_ALTERNATE_VI | ROM_DB_VI_CLOCK_1500, 0, 0, 0x0, 0, 0 }, /* Pokemon Puzzle League (F) */
+   { 0xBEE4966ABCDEC5C6ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 6 }, /* Glide64: Beetle */
+   { 0xC829D0F935090BE2ULL, ROM_DB_NAME, 0, 0, 0x0, 41, 0 }, /* Glide64: SUPERROBOTSPIRITS */
+   { 0xC9F6D7E8DBFBFAE1ULL, ROM_DB_NAME, 0, 0, 0x0, 174, 0 }, /* Glide64: BIOFREAKS */
+   { 0xB57D4EB4345E09E5ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Guru - Kuru Kuru Fever (J) [ALECK64] */
+   { 0x3D3605926B18DFCBULL, ROM_DB_NAME, 0, 0, 0x0, 176, 0 }, /* Glide64: blitz2k */
+   { 0x1B743DEBC81C3475ULL, ROM_DB_NAME, 0, 0, 0x0, 77, 0 }, /* Glide64: NASCAR 2000 */
+   { 0x7C3829D96E8247CEULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 3 (U) [!] */
+   { 0x3A4760B52D74D410ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Shadow Man (U) [!] */
+   { 0x43BBE835481C2D3AULL, ROM_DB_NAME, 0, 0, 0x0, 59, 0 }, /* Glide64: DeadlyArts */
+   { 0x733FCCB1444892F9ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Banjo-Kazooie (E) (M3) [!] */
+   { 0x255018DF57D6AE3AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Lode Runner 3-D (U) [!] */
+   { 0xCC3CC8B30EC405A4ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* F-1 World Grand Prix (E) [!] */
+   { 0x2E3593393FA5EDA6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chopper Attack (E) [!] */
+   { 0x5F984AAF6D76AD57ULL, ROM_DB_NAME, 0, 0, 0x0, 181, 0 }, /* Glide64: MACE */
+   { 0xF43B45BA2F0E9B6FULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Zelda no Densetsu - Toki no Ocarina GC URA (J) (GC) [!] */
+   { 0x3018A40161C2FBC9ULL, ROM_DB_NAME, 0, 0, 0x0, 83, 0 }, /* Glide64: GANBAKE GOEMON */
+   { 0x0D93BA11683868A6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Kirby 64 - The Crystal Shards (E) [!] */
+   { 0x55B971601085B64AULL, ROM_DB_NAME, 0, 0, 0x0, 68, 0 }, /* Glide64: \xC4\xDE\xD7\xB4\xD3\xDD3 \xC9\xCB\xDE\xC0\xC9\xCF\xC1SOS! */
+   { 0xA3A044B56DB1BF5EULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Spacer by Memir (POM '99) (PD) */
+   { 0xCD8EEB7EC364000DULL, ROM_DB_NAME, 0, 0, 0x0, 0, 10 }, /* Glide64: CHOPPER_ATTACK */
+   { 0x381A5EAF2FAF5FA2ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 2 }, /* Glide64: ROADSTERS TROPHY */
+   { 0xF389A35A17785562ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (J) [f1] (Z64) */
+   { 0xEE4FD7C29CF1D938ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pocket Monsters Stadium Kin Gin (J) [!] */
+   { 0x8CC182A6C2D0CAB0ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* AI Shougi 3 (J) [!] */
+   { 0xC83CEB83FDC56219ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Penny Racers (E) [!] */
+   { 0xFDC1F89AAB4639C4ULL, ROM_DB_NAME, 0, 0, 0x0, 125, 0 }, /* Glide64: MASTERS'98 */
+   { 0x605E31B1F18A5CC7ULL, ROM_DB_NAME, 0, 0, 0x0, 132, 0 }, /* Glide64: Shadow of the Empire */
+   { 0x7C64E6DB55B924DBULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Blast Corps (E) (M2) [!] */
+   { 0x7421143C2BE034F6ULL, ROM_DB_NAME, 0, 0, 0x0, 130, 0 }, /* Glide64: ROCKETROBOTONWHEELS */
+   { 0xCD3C3CDF317793FAULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nintama Rantarou 64 Game Gallery (J) [!] */
+   { 0xEDD6E03168136013ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Rush 2 - Extreme Racing USA (U) [!] */
+   { 0xF75D8E933DD8C724ULL, ROM_DB_NAME, 0, 0, 0x0, 62, 0 }, /* Glide64: CHOPPER ATTACK */
+   { 0x861C3519F6091CE5ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Excitebike 64 (J) [!] */
+   { 0x41F2B98FB458B466ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Perfect Dark (U) (V1.1) [!] */
+   { 0x5168D520CA5FCD0DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Banjo to Kazooie no Daibouken (J) [!] */
+   { 0x39B2CD2AA32FB1B2ULL, ROM_DB_NAME, 0, 0, 0x0, 149, 0 }, /* Glide64: SMASH BROTHERS */
+   { 0x4EBFDD33664C9D84ULL, ROM_DB_FLASH_RAM | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Tigger's Honey Hunt (U) [!] */
+   { 0x2829657EA0621877ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party (U) [!] */
+   { 0xB4129C2F8748B5E8ULL, ROM_DB_NAME, 0, 0, 0x0, 9, 0 }, /* Glide64: ARMYMENAIRCOMBAT */
+   { 0x001A3BD0AFB3DE1AULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Disney's Tarzan (F) [!] */
+   { 0xC2E9AA9A475D70AAULL, ROM_DB_EEPROM_16KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Banjo-Tooie (U) [!] */
+   { 0x0AC40FA3407F2C46ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 13 }, /* Glide64: F-Zero X */
+   { 0x36F22FBF318912F2ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* 64 Hanafuda - Tenshi no Yakusoku (J) [!] */
+   { 0x02D8366A6CABEF9CULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Road Rash 64 (E) [!] */
+   { 0x6B337ECB5E6A6B29ULL, ROM_DB_NAME, 0, 0, 0x0, 54, 0 }, /* Glide64: Cruis'n USA */
+   { 0xE0AF9F0339BECF99ULL, ROM_DB_NAME, 0, 0, 0x0, 77, 0 }, /* Glide64: NASCAR 99 */
+   { 0x3EB20723D1A25C8BULL, ROM_DB_NAME, 0, 0, 0x0, 140, 0 }, /* Glide64: POKEMON STADIUM G&S */
+   { 0x9AB3B50ABC666105ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hexen (G) [!] */
+   { 0x5C1B5FBD7E961634ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hexen (F) [!] */
+   { 0x6420535A50028062ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chameleon Twist (U) [!] */
+   { 0x3B2C904084FF40CBULL, ROM_DB_NAME, 0, 0, 0x0, 61, 0 }, /* Glide64: BRUNSWICKBOWLING */
+   { 0xF478D8B39716DD6DULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* LEGO Racers (E) (M10) [!] */
+   { 0xC368DA505D84C6B0ULL, ROM_DB_NAME, 0, 0, 0x0, 27, 0 }, /* Glide64: Extreme G 2 */
+   { 0xDED0DD9AE78225A7ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mickey's Speedway USA (E) (M5) [!] */
+   { 0xCEA8B54F7F21D503ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Wetrix (E) (M6) [!] */
+   { 0xDEB78BBA52F6BD9DULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Madden NFL 99 (U) [!] */
+   { 0xD0A1FC5B2FB8074BULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (S) [!] */
+   { 0xB70BAEE53A5005A8ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* F-1 World Grand Prix (F) [!] */
+   { 0xCA1BB86F41CCA5C5ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Hoshi no Kirby 64 (J) (V1.1) [!] */
+   { 0x6FEAB8E99CB30AE0ULL, ROM_DB_NAME, 0, 0, 0x0, 203, 0 }, /* Glide64: Mini Racers */
+   { 0x95286EB4B76AD58FULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Command & Conquer (U) [!] */
+   { 0xA2658F56C5081B8BULL, ROM_DB_NAME, 0, 0, 0x0, 60, 0 }, /* Glide64: Bottom of the 9th */
+   { 0x0C5EE085A167DD3EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Rocket - Robot on Wheels (U) [!] */
+   { 0x202A8EE483F88B89ULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Excitebike 64 (E) [!] */
+   { 0x3C1FDABE02A4E0BAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Tetrisphere (U) [!] */
+   { 0x839F3AD5406D15FAULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Mario Tennis (E) [!] */
+   { 0x52F788058B8FCAB7ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Fighter's Destiny (U) [!] */
+   { 0x155B7CDFF0DA7325ULL, ROM_DB_EEPROM_16KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Banjo-Tooie (A) [!] */
+   { 0x979B263EF8470004ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (E) [!] */
+   { 0x7BCACEA8AC5172D3ULL, ROM_DB_NAME, 0, 0, 0x0, 193, 27 }, /* Glide64: Mega Man 64 */
+   { 0xD3F97D496924135BULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Yoshi's Story (E) (M3) [!] */
+   { 0x9E8FE2BA8B270770ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (U) (V1.0) [!] */
+   { 0xBC9B2CC34ED04DA5ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* StarCraft 64 (Beta) */
+   { 0xCA2B762359810100ULL, ROM_DB_NAME, 0, 0, 0x0, 120, 0 }, /* Glide64: I.S.S.2000 */
+   { 0xBFE23884EF48EAAFULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Space Station Silicon Valley (J) [!] */
+   { 0x8D1623729353BC94ULL, ROM_DB_NAME, 0, 0, 0x0, 184, 0 }, /* Glide64: Holy Magic Century */
+   { 0xD845A7C643217E36ULL, ROM_DB_NAME, 0, 0, 0x0, 143, 0 }, /* Glide64: Rally'99 */
+   { 0x616B84948A509210ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Kobe Bryant's NBA Courtside (U) [!] */
+   { 0xA53FA82DDAE2C15DULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (I) [!] */
+   { 0xE0A79F8C32CC97FAULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Jikkyou World Soccer 3 (J) [!] */
+   { 0x62E3F3F1F026D258ULL, ROM_DB_NAME, 0, 0, 0x0, 157, 0 }, /* Glide64: DONKEY KONG 64 */
+   { 0xBBFFE12DA032D8B3ULL, ROM_DB_NAME, 0, 0, 0x0, 161, 10 }, /* Glide64: WILD CHOPPERS */
+   { 0xFE4B6B43081D29A7ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Triple Play 2000 (U) [!] */
+   { 0x8407727557315B9CULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (E) (V1.0) [!] */
+   { 0xBA780BA00F21DB34ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Fox 64 (U) (V1.1) [!] */
+   { 0xB34025547340C004ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n USA (U) (V1.2) [!] */
+   { 0x9FD375F845F32DC8ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Rocket - Robot on Wheels (E) (M3) [!] */
+   { 0xDBBD3299659CA6EBULL, ROM_DB_NAME, 0, 0, 0x0, 187, 0 }, /* Glide64: SNOWBOARD KIDS2 */
+   { 0x8F50B845D729D22FULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nuclear Strike 64 (G) [!] */
+   { 0x383307316C254D26ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 13 }, /* Glide64: F-ZERO X */
+   { 0x239F2A71881FA016ULL, ROM_DB_NAME, 0, 0, 0x0, 58, 0 }, /* Glide64: Eltail */
+   { 0x373F58899A6CA80AULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Conker's Bad Fur Day (E) [!] */
+   { 0x68C1619DC846F8F4ULL, ROM_DB_NAME, 0, 0, 0x0, 85, 0 }, /* Glide64: Getter Love!! */
+   { 0x4789765091A753E0ULL, ROM_DB_NAME, 0, 0, 0x0, 131, 0 }, /* Glide64: SD HIRYU STADIUM */
+   { 0xE48E01F5E6E51F9BULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Carmageddon 64 (E) (M4) (Eng-Spa-Fre-Ita) [!] */
+   { 0xE3FC720DC9071903ULL, ROM_DB_NAME, 0, 0, 0x0, 106, 0 }, /* Glide64: Waialae Country Club */
+   { 0x982FA9D4419E9A70ULL, ROM_DB_NAME, 0, 0, 0x0, 25, 0 }, /* Glide64: extremeg */
+   { 0x3C4DDE982C896F8EULL, ROM_DB_NAME, 0, 0, 0x0, 78, 0 }, /* Glide64: NBA JAM 99 */
+   { 0xBA6C293A9FAFA338ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (F) [!] */
+   { 0x03571182892FD06DULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (U) [!] */
+   { 0x0006B66E7165AFDEULL, ROM_DB_NAME, 0, 0, 0x0, 139, 0 }, /* Glide64: POKEMON SNAP */
+   { 0x580162ECE3108BF1ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Carmageddon 64 (E) (M4) (Eng-Spa-Fre-Ger) [!] */
+   { 0x096A40EA8ABE0A10ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* LEGO Racers (U) (M10) [b1] */
+   { 0x5F213B92FD37E55EULL, ROM_DB_NAME, 0, 0, 0x0, 107, 0 }, /* Glide64: TWISTED EDGE */
+   { 0xE64D6E97C406DE30ULL, ROM_DB_NAME, 0, 0, 0x0, 23, 0 }, /* Glide64: CENTRE COURT TENNIS */
+   { 0x747EDD70D69197D1ULL, ROM_DB_NAME, 0, 0, 0x0, 159, 0 }, /* Glide64: GEX: ENTER THE GECKO */
+   { 0x2EF4D519C64A0C5EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Snow Speeder (J) [!] */
+   { 0xF63B89CE4582D57DULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bug's Life, A (I) [!] */
+   { 0x2577C7D4D18FAAAEULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mario Kart 64 (E) (V1.1) [!] */
+   { 0x46039FB40337822CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Kirby 64 - The Crystal Shards (U) [!] */
+   { 0xA6078F5E4866043EULL, ROM_DB_NAME, 0, 0, 0x0, 47, 0 }, /* Glide64: MortalKombatTrilogy */
+   { 0x2DCFCA608354B147ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Yoshi Story (J) [!] */
+   { 0x650EFA9630DDF9A7ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Wave Race 64 (E) (M2) [!] */
+   { 0xC2751D1AF8C19BFFULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Snowboard Kids 2 (E) [!] */
+   { 0x0578F24F9175BF17ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Top Gear Overdrive (J) [!] */
+   { 0xC6CFEF3CEDC1E9C5ULL, ROM_DB_NAME, 0, 0, 0x0, 114, 0 }, /* Glide64: Top Gear Overdrive */
+   { 0x49EBCCEDF9D763CDULL, ROM_DB_NAME, 0, 0, 0x0, 191, 0 }, /* Glide64: MarioParty */
+   { 0x2500267E2A7EC3CEULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* RR64 - Ridge Racer 64 (U) [!] */
+   { 0x65EFAFEA12EE8827ULL, ROM_DB_NAME, 0, 0, 0x0, 140, 33 }, /* Glide64: POKEMON STADIUM 2 */
+   { 0x9C66306980F24A80ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party (E) (M3) [!] */
+   { 0x0CB816865FD85A81ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Madden NFL 2000 (U) [!] */
+   { 0x64EBD558E0B9C0B2ULL, ROM_DB_NAME, 0, 0, 0x0, 86, 0 }, /* Glide64: GOEMON2 DERODERO */
+   { 0x95A80114E0B72A7FULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hamster Monogatari 64 (J) [!] */
+   { 0xA0ECFB046D13E9C4ULL, ROM_DB_NAME, 0, 0, 0x0, 168, 0 }, /* Glide64: Re-Volt */
+   { 0xFBB9F1FA6BF88689ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Duck Dodgers Starring Daffy Duck (U) (M3) [!] */
+   { 0x2F493DD02E64DFD9ULL, ROM_DB_VI_CLOCK_2200, 0, 0, 0x0, 0, 0 }, /* Resident Evil 2 (U) [!] */
+   { 0x0EC158F5FB3E6896ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Mega Man 64 (U) [!] */
+   { 0x847C7B2B40574D80ULL, ROM_DB_NAME, 0, 0, 0x0, 28, 0 }, /* Glide64: MICKEY USA */
+   { 0x6DB14FE8A7B89433ULL, ROM_DB_NAME, 0, 0, 0x0, 170, 0 }, /* Glide64: ROAD RASH 64 */
+   { 0x3D02989BD4A381E2ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars Episode I - Battle for Naboo (U) [!] */
+   { 0x6AA4DDE7E3E2F4E7ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* BattleTanx (U) [!] */
+   { 0x063FA4A39A31F139ULL, ROM_DB_NAME, 0, 0, 0x0, 69, 0 }, /* Glide64: DR.MARIO 64 */
+   { 0x68E8A8750CE7A486ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* WCW-nWo Revenge (E) [!] */
+   { 0xB80EB98CA8EA5D9EULL, ROM_DB_NAME, 0, 0, 0x0, 190, 0 }, /* Glide64: MAGICAL TETRIS */
+   { 0x492B9DE8C6CCC81CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Earthworm Jim 3D (E) (M6) [!] */
+   { 0x5F6A04E2D4FA070DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (S) [!] */
+   { 0xAE5B9465C54D6576ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Command & Conquer (E) (M2) [!] */
+   { 0x9EA95858AF72B618ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 2 (U) [!] */
+   { 0xCB93DB977F5C63D5ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Toy Story 2 (F) [!] */
+   { 0x08FFA4B701F453B6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Big Mountain 2000 (U) [!] */
+   { 0xE921953313FBAFBDULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Ready 2 Rumble Boxing - Round 2 (U) [!] */
+   { 0x53ED2DC406258002ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Star Wars Episode I - Racer (E) (M3) [!] */
+   { 0x001D1CC963DCA561ULL, ROM_DB_NAME, 0, 0, 0x0, 166, 1 }, /* Glide64: ZELDA MAJORA'S MASK */
+   { 0xA6B6B41315D113CCULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* MRC - Multi Racing Championship (J) [!] */
+   { 0x26123BFABC9A1D58ULL, ROM_DB_NAME, 0, 0, 0x0, 50, 0 }, /* Glide64: World Cup 98 */
+   { 0x166919A49A098C47ULL, ROM_DB_NAME, 0, 0, 0x0, 173, 0 }, /* Glide64: RTL WLS2000 */
+   { 0x9421D9E2642F27D5ULL, ROM_DB_NAME, 0, 0, 0x0, 94, 9 }, /* Glide64: NITRO64 */
+   { 0xE688A5B8B14B3F18ULL, ROM_DB_FIXED_AUDIO_POS | ROM_DB_VI_CLOCK_1600, 0, 0, 0x0, 0, 0 }, /* Twisted Edge Extreme Snowboarding (E) [!] */
+   { 0x36F1C74BF2029939ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Fighter's Destiny (E) [!] */
+   { 0xA4CD91270A690DF6ULL, ROM_DB_NAME, 0, 0, 0x0, 32, 0 }, /* Glide64: TOM AND JERRY */
+   { 0x1E0E96E84E28826BULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Charlie Blast's Territory (U) [!] */
+   { 0x33ABC11AB6871802ULL, ROM_DB_NAME, 0, 0, 0x0, 104, 0 }, /* Glide64: TWINE */
+   { 0xD003FE9C95B545B1ULL, ROM_DB_NAME, 0, 0, 0x0, 83, 0 }, /* Glide64: MYSTICAL NINJA */
+   { 0x4E4B06401B49BCFBULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* WWF No Mercy (U) (V1.0) [!] */
+   { 0xA4F2F521F0EB168EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chameleon Twist (J) [!] */
+   { 0x1AA05AD546F52D80ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Pilotwings 64 (E) (M3) [!] */
+   { 0x5ED5CA26C95C7CC0ULL, ROM_DB_NAME, 0, 0, 0x0, 198, 0 }, /* Glide64: SUPERMAN */
+   { 0xFC70E27208FFE7AAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Space Station Silicon Valley (E) (M7) [!] */
+   { 0xDF5A20F1F9AE976CULL, ROM_DB_NAME, 0, 0, 0x0, 172, 7 }, /* Glide64: RONALDINHO SOCCER */
+   { 0x8EB91503F4BF282CULL, ROM_DB_NAME, 0, 0, 0x0, 193, 27 }, /* Glide64: RockMan Dash */
+   { 0xF163A242F2449B3BULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Star Twins (J) [!] */
+   { 0x2EFFBBAE2CB7ADA8ULL, ROM_DB_NAME, 0, 0, 0x0, 87, 0 }, /* Glide64: GOLDEN NUGGET 64 */
+   { 0xB76EEA93EF177B51ULL, ROM_DB_NAME, 0, 0, 0x0, 153, 0 }, /* Glide64: Dual heroes JAPAN */
+   { 0x61F5B152046122ABULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Star Wars Episode I - Racer (J) [!] */
+   { 0x7F8A046988AAE406ULL, ROM_DB_NAME, 0, 0, 0x0, 108, 0 }, /* Glide64: JET FORCE GEMINI */
+   { 0x82380387DFC744D9ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 2 (E) (M5) [!] */
+   { 0xA93DB672D9A09586ULL, ROM_DB_NAME, 0, 0, 0x0, 129, 7 }, /* Glide64: PERFECT STRIKER */
+   { 0x29A045CEABA9060EULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hydro Thunder (F) [!] */
+   { 0xCBFE69C7F2C0AB2AULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Disney's Tarzan (U) [!] */
+   { 0x62F6BE95F102D6D6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* AeroFighters Assault (E) (M3) [!] */
+   { 0xFF2F2FB4D161149AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n USA (U) (V1.0) [!] */
+   { 0x0A5D8F8398C5371AULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Legend of Zelda, The - Majora's Mask (E) (M4) (V1.1) */
+   { 0xF8009DB06B291823ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* City-Tour GP - Zennihon GT Senshuken (J) [!] */
+   { 0x8F9074962A972EA0ULL, ROM_DB_NAME, 0, 0, 0x0, 18, 6 }, /* Glide64: Beetle Adventure Rac */
+   { 0xF050746C247B820BULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Road Rash 64 (U) [!] */
+   { 0xAF37494CFC9E65E2ULL, ROM_DB_NAME, 0, 0, 0x0, 196, 0 }, /* Glide64: SUPER MARIO 64 */
+   { 0xB58988E9B1FC4BE8ULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hydro Thunder (E) [!] */
+   { 0x3C7BB30FD8D965AEULL, ROM_DB_NAME, 0, 0, 0x0, 138, 31 }, /* Glide64: PUZZLE LEAGUE N64 */
+   { 0x51D9B0A4183EAA58ULL, ROM_DB_NAME, 0, 0, 0x0, 96, 0 }, /* Glide64: NFL BLITZ */
+   { 0xE97955C6BC338D38ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Legend of Zelda, The - Majora's Mask (E) (M4) (V1.0) [!] */
+   { 0xA292524F3D6C2A49ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* NBA In the Zone '99 (U) [!] */
+   { 0x8A97A197272DF6C1ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nuclear Strike 64 (E) (M2) [!] */
+   { 0x1FC9F9C2BA28B171ULL, ROM_DB_NAME, 0, 0, 0x0, 102, 0 }, /* Glide64: MarioGolf64 */
+   { 0xF568D51E7E49BA1EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman 64 (U) [!] */
+   { 0xF7F52DB82195E636ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Zelda no Densetsu - Toki no Ocarina - Zelda Collection Version (J) (GC) [!] */
+   { 0x7A4747AC44EEEC23ULL, ROM_DB_ALTERNATE_VI | ROM_DB_VI_CLOCK_1500 | ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Puzzle League (G) */
+   { 0xA3663FD49F46B3B3ULL, ROM_DB_NAME, 0, 0, 0x0, 72, 0 }, /* Glide64: F1RacingChampionship */
+   { 0x4446FDD6E3788208ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman Hero (U) [!] */
+   { 0xAF9DCC151A723D88ULL, ROM_DB_VI_CLOCK_2200 | ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Indiana Jones and the Infernal Machine (U) [!] */
+   { 0xD76333AC0CB6219DULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bass Rush - ECOGEAR PowerWorm Championship (J) [!] */
+   { 0xFDB061FFF9C38DF9ULL, ROM_DB_NAME, 0, 0, 0x0, 73, 0 }, /* Glide64: F1 WORLD GRAND PRIX2 */
+   { 0xE436467A82DE8F9BULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Indy Racing 2000 (U) [!] */
+   { 0xAE2FBFE8587D39B5ULL, ROM_DB_NAME, 0, 0, 0x0, 30, 0 }, /* Glide64: Sin and Punishment */
+   { 0x60C437E5A2251EE3ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Shadow Man (E) (M3) [!] */
+   { 0x46A3F7AF0F7591D0ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n Exotica (U) [!] */
+   { 0x4B74C3D7176B4FC7ULL, ROM_DB_NAME, 0, 0, 0x0, 63, 0 }, /* Glide64: CITY TOUR GP */
+   { 0x637758865FB80E7BULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pocket Monsters Stadium 2 (J) [!] */
+   { 0xCCEB385826952D97ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Toy Story 2 (E) [!] */
+   { 0xDD55DD9BECE83AEDULL, ROM_DB_NAME, 0, 0, 0x0, 83, 0 }, /* Glide64: MYSTICAL NINJA2 SG */
+   { 0x32CA974BB2C29C50ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Duke Nukem - ZER0 H0UR (F) [!] */
+   { 0x219191C133183C61ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Rogue Squadron (E) (M3) (V1.1) [!] */
+   { 0x4D0E1A4B85A17D49ULL, ROM_DB_NAME, 0, 0, 0x0, 29, 28 }, /* Glide64: TROUBLE MAKERS */
+   { 0x937264D4690DEE54ULL, ROM_DB_NAME, 0, 0, 0x0, 154, 0 }, /* Glide64: JEREMY MCGRATH SUPER */
+   { 0x3925D6258C83C75EULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Madden NFL 99 (E) [!] */
+   { 0x782A9075E552631DULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Toy Story 2 (G) [!] */
+   { 0x635A2BFF8B022326ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Super Mario 64 (U) [!] */
+   { 0x49E46C2D7B1A110CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Fighting Cup (J) [!] */
+   { 0x2F57C9F7F1E29CA6ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Vivid Dolls (J) [ALECK64] */
+   { 0x91C9E05DAD3AAFB9ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (E) (V1.1) [!] */
+   { 0x90F5D9B39D0EDCF0ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium (U) (V1.0) [!] */
+   { 0xFD73F7759724755AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (E) (M3) (V1.0) [!] */
+   { 0x11936D8C6F2C4B43ULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Donkey Kong 64 (E) [!] */
+   { 0x32EC77BA304DB00AULL, ROM_DB_NAME, 0, 0, 0x0, 15, 0 }, /* Glide64: Banjo-Kazooie */
+   { 0xB703EB2328AAE53AULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Soldier - Vanishing Earth (J) [!] */
+   { 0x84D5FD75BBFD3CDFULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Shadow Man (G) [!] */
+   { 0xD6248548AD77F271ULL, ROM_DB_NAME, 0, 0, 0x0, 84, 0 }, /* Glide64: GAUNTLET LEGENDS */
+   { 0x3ECBBA7CC66C0EF8ULL, ROM_DB_NAME, 0, 0, 0x0, 202, 0 }, /* Glide64: STARFOX64 */
+   { 0x84FB249793D38729ULL, ROM_DB_NAME, 0, 0, 0x0, 95, 0 }, /* Glide64: NUCLEARSTRIKE64 */
+   { 0x91323EE7AD4419E8ULL, ROM_DB_NAME, 0, 0, 0x0, 10, 0 }, /* Glide64: BURABURA POYON */
+   { 0x2256ECDA71AB1B9CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (E) [!] */
+   { 0xD85C4E2988E276AFULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman Hero (E) [!] */
+   { 0x6D8DF08ED008C3CFULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* WWF No Mercy (E) (V1.0) [!] */
+   { 0xFE52E87D9D98687CULL, ROM_DB_NAME, 0, 0, 0x0, 88, 0 }, /* Glide64: GT64 */
+   { 0x3E5055B62E92DA52ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mario Kart 64 (U) [!] */
+   { 0xE586F2E0893FE2F0ULL, ROM_DB_NAME, 0, 0, 0x0, 101, 6 }, /* Glide64: HSV ADVENTURE RACING */
+   { 0x0553AE9DEAD8E0C1ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Xena Warrior Princess - The Talisman of Fate (U) [!] */
+   { 0x132D2732C70E9118ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Wipeout 64 (U) [!] */
+   { 0xCB07974FCFB72888ULL, ROM_DB_NAME, 0, 0, 0x0, 117, 0 }, /* Glide64: Taz Express */
+   { 0x13836389265B3C76ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Madden Football 64 (U) [!] */
+   { 0x87B89F2DFBE22D06ULL, ROM_DB_NAME, 0, 0, 0x0, 67, 0 }, /* Glide64: Donald Duck Goin' Qu */
+   { 0xF611F4BAC584135CULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Zelda no Densetsu - Toki no Ocarina GC (J) (GC) [!] */
+   { 0xDEE584A20F161187ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Destruction Derby 64 (U) [!] */
+   { 0xDFE61153D76118E6ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n World (U) [!] */
+   { 0xC78887A70AE09974ULL, ROM_DB_NAME, 0, 0, 0x0, 91, 0 }, /* Glide64: MGAH VOL1 */
+   { 0xE4B08007A602FF33ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Perfect Dark (E) (M5) [!] */
+   { 0xB74240B68BE63D60ULL, ROM_DB_NAME, 0, 0, 0x0, 183, 0 }, /* Glide64: QUAKE II */
+   { 0x4F543719F766E584ULL, ROM_DB_NAME, 0, 0, 0x0, 112, 0 }, /* Glide64: \xBD\xB0\xCA\xDF\xB0\xDB\xCE\xDE\xAF\xC4\xC0\xB2\xBE\xDD64 */
+   { 0x9CB039DE45D7E3B6ULL, ROM_DB_NAME, 0, 0, 0x0, 57, 0 }, /* Glide64: \xB4\xB2\xBA\xB3\xC9\xBE\xDD\xC4\xB1\xDD\xC4\xDE\xD8\xAD\xB0\xBD */
+   { 0x00373152B53D19EFULL, ROM_DB_NAME, 0, 0, 0x0, 22, 0 }, /* Glide64: HYDRO THUNDER */
+   { 0x0A5ED7311CD2CDF5ULL, ROM_DB_NAME, 0, 0, 0x0, 44, 0 }, /* Glide64: TRIPLE PLAY 2000 */
+   { 0xD955F32EAB205798ULL, ROM_DB_NAME, 0, 0, 0x0, 127, 0 }, /* Glide64: \xC7\xBC\xC2\xDE\xD864 */
+   { 0x5F6160AF6D479049ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 1 }, /* Glide64: MASK */
+   { 0x2EDA6D0CB404FAEDULL, ROM_DB_NAME, 0, 0, 0x0, 49, 11 }, /* Glide64: Resident Evil II */
+   { 0x07861842A12EBC9FULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Excitebike 64 (U) [!] */
+   { 0x2952369CB6E4C3A8ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (E) [!] */
+   { 0x5A160336BC7B37B0ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Bomberman 64 (E) [!] */
+   { 0x519EA4E1EB7584E8ULL, ROM_DB_FIXED_AUDIO_POS | ROM_DB_VI_CLOCK_1600, 0, 0, 0x0, 0, 0 }, /* King Hill 64 - Extreme Snowboarding (J) [!] */
+   { 0xA197CB527520DE0EULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Madden Football 64 (E) [!] */
+   { 0x975B7845A2505C18ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* 77a Special Edition by Count0 (PD) */
+   { 0x5D70684615092E9CULL, ROM_DB_NAME, 0, 0, 0x0, 151, 0 }, /* Glide64: DRACULA MOKUSHIROKU */
+   { 0x393010423100CC9CULL, ROM_DB_NAME, 0, 0, 0x0, 79, 0 }, /* Glide64: NBA LIVE 2000 */
+   { 0x6608BFD4691A3EBFULL, ROM_DB_NAME, 0, 0, 0x0, 31, 0 }, /* Glide64: Tigger's Honey Hunt */
+   { 0xA04BC8CB3177E214ULL, ROM_DB_NAME, 0, 0, 0x0, 0, 32 }, /* Glide64: WIN BACK */
+   { 0x5F2763C462412AE5ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* International Superstar Soccer 64 (U) [!] */
+   { 0x873B821E6F330A3FULL, ROM_DB_NAME, 0, 0, 0x0, 53, 0 }, /* Glide64: EARTHWORM JIM 3D */
+   { 0x2AF9B65C85E2A2D7ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* MRC - Multi Racing Championship (U) [!] */
+   { 0x264D7E5C18874622ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Shadows of the Empire (U) (V1.0) [!] */
+   { 0x0577EA9F375E2914ULL, ROM_DB_NAME, 0, 0, 0x0, 80, 0 }, /* Glide64: NBA Live 99 */
+   { 0x467C93DC0261B05CULL, ROM_DB_NAME, 0, 0, 0x0, 74, 0 }, /* Glide64: F3 \xCC\xB3\xD7\xB2\xC9\xBC\xDA\xDD2 */
+   { 0x79DF4218BB441583ULL, ROM_DB_NAME, 0, 0, 0x0, 97, 0 }, /* Glide64: Monaco GP Racing 2 */
+   { 0xE44F6DF80D5203C0ULL, ROM_DB_NAME, 0, 0, 0x0, 96, 0 }, /* Glide64: NFL BLITZ SPECIAL ED */
+   { 0xCC94EAFD1145F90BULL, ROM_DB_NAME, 0, 0, 0x0, 12, 0 }, /* Glide64: BOMBERMAN64E */
+   { 0x4A1CD153D830AEF8ULL, ROM_DB_ALTERNATE_VI | ROM_DB_VI_CLOCK_1500 | ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Puzzle League (E) */
+   { 0x5AF01C5F8A3BE764ULL, ROM_DB_NAME, 0, 0, 0x0, 162, 0 }, /* Glide64: Wipeout 64 */
+   { 0xDEE596ABAF3B7AE7ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* WCW-nWo Revenge (U) [!] */
+   { 0x2337527A10602827ULL, ROM_DB_NAME, 0, 0, 0x0, 110, 0 }, /* Glide64: HEIWA \xCA\xDF\xC1\xDD\xBA \xDC\xB0\xD9\xC4\xDE64 */
+   { 0x90AF8D2CE1AC1B37ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Tower & Shaft (J) [ALECK64] */
+   { 0x2DCD86792AE5C633ULL, ROM_DB_NAME, 0, 0, 0x0, 71, 0 }, /* Glide64: HUMAN GRAND PRIX */
+   { 0xBBC99D32117DAA80ULL, ROM_DB_FIXED_AUDIO_POS | ROM_DB_VI_CLOCK_1600, 0, 0, 0x0, 0, 0 }, /* Twisted Edge Extreme Snowboarding (U) [!] */
+   { 0xCEF24A160C6B14B1ULL, ROM_DB_NAME, 0, 0, 0x0, 15, 25 }, /* Glide64: BANJO TOOIE */
+   { 0x6F85CED2AB35E02FULL, ROM_DB_NAME, 0, 0, 0x0, 150, 22 }, /* Glide64: Pilot Wings64 */
+   { 0x35D5C47C74CE064AULL, ROM_DB_NAME, 0, 0, 0x0, 159, 0 }, /* Glide64: Gex 3 Deep Cover Gec */
+   { 0xDF5741919EB5123DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Earthworm Jim 3D (U) [!] */
+   { 0x7BB18D4083138559ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Snap (A) [!] */
+   { 0x214CAD94BE1A3B24ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Chopper Attack (U) [!] */
+   { 0xBC8E425E46ADBB31ULL, ROM_DB_NAME, 0, 0, 0x0, 11, 0 }, /* Glide64: \xCA\xDE\xB8\xBC\xAE\xB3\xBC\xDE\xDD\xBE\xB264 */
+   { 0x7DE11F5374872F9DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Wave Race 64 (U) (V1.0) [!] */
+   { 0xBD3FC0EC08CD7D4FULL, ROM_DB_NAME, 0, 0, 0x0, 4, 0 }, /* Glide64: AERO FIGHTERS ASSAUL */
+   { 0xADA815BE6028622FULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party (J) [!] */
+   { 0x4B43F63B7B66C49CULL, ROM_DB_NAME, 0, 0, 0x0, 177, 0 }, /* Glide64: Body Harvest */
+   { 0xEAE6ACE2020B4384ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars Episode I - Battle for Naboo (E) [!] */
+   { 0x69FF68284D6A36B6ULL, ROM_DB_NAME, 0, 0, 0x0, 136, 0 }, /* Glide64: Lode Runner 3D */
+   { 0xB8AA75A8993EF674ULL, ROM_DB_NAME, 0, 0, 0x0, 90, 0 }, /* Glide64: \xCE\xDE\xB8\xBC\xDE\xAE\xB3\xD3\xC9\xB6\xDE\xC0\xD82 */
+   { 0xD52FE29D8EA6A759ULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Donchan Puzzle Hanabi de Doon! (J) [ALECK64] */
+   { 0xF00F2D4E340FAAF4ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Carmageddon 64 (U) [!] */
+   { 0x72611D7D9919BDD2ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* HSV Adventure Racing (A) [b1] */
+   { 0x2337D8E86B8E7CECULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Yoshi's Story (U) (M2) [!] */
+   { 0xA37DD275E1C0F8BEULL, ROM_DB_NAME, 0, 0, 0x0, 182, 0 }, /* Glide64: Quake */
+   { 0x0B6B4DDB9671E682ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Roadsters Trophy (U) (M3) [!] */
+   { 0xCE47D7ED3800A297ULL, ROM_DB_NAME, 0, 0, 0x0, 65, 0 }, /* Glide64: CONKER BFD */
+   { 0x68469E58796A868AULL, ROM_DB_NAME, 0, 0, 0x0, 56, 0 }, /* Glide64: CUSTOMROBOV2 */
+   { 0x3DF17480193DED5AULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Donald Duck - Quack Attack (E) (M5) [!] */
+   { 0x04DAF07F0D18E688ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Duke Nukem - ZER0 H0UR (U) [!] */
+   { 0x0C41F9C201717A0DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Fighter's Destiny (F) [!] */
+   { 0x96747EB4104BB243ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Perfect Dark (J) [!] */
+   { 0x9FE6162DE97E4037ULL, ROM_DB_EEPROM_4KB | ROM_DB_DELAY_SI, 0, 0, 0x0, 0, 0 }, /* Yuke Yuke!! Trouble Makers (J) [!] */
+   { 0x0B01B1774BE5CE71ULL, ROM_DB_NAME, 0, 0, 0x0, 142, 0 }, /* Glide64: RAINBOW SIX */
+   { 0xBAE1540A09334504ULL, ROM_DB_NAME, 0, 0, 0x0, 121, 0 }, /* Glide64: ITF 2000 */
+   { 0x37E9BAAB80C5FA6DULL, ROM_DB_NAME, 0, 0, 0x0, 25, 0 }, /* Glide64: extreme_g */
+   { 0x83F3931ECB72223DULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Cruis'n World (E) [!] */
+   { 0xEE08C6026BC2D5A6ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* PGA European Tour (E) (M5) [!] */
+   { 0x0B0AB4CD7B158937ULL, ROM_DB_EEPROM_16KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Mario Party 3 (J) [!] */
+   { 0x2B4F4EFB43C511FEULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Tom and Jerry in Fists of Furry (E) (M6) [!] */
+   { 0xA6FFA8D2F2E62BBDULL, ROM_DB_NAME, 0, 0, 0x0, 186, 0 }, /* Glide64: Silicon Valley */
+   { 0x64BF47C4F4BD22BAULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* F-1 World Grand Prix (J) [!] */
+   { 0x93EB3F7E81675E44ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mission Impossible (G) [!] */
+   { 0xBCFACCAAB814D8EFULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bassmasters 2000 (U) [!] */
+   { 0x8CDB94C2CB46C6F0ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* WWF No Mercy (E) (V1.1) [!] */
+   { 0xE402430DD2FCFC9DULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Diddy Kong Racing (U) (M2) (V1.1) [!] */
+   { 0x2E3843F7EC8F8D1DULL, ROM_DB_NAME, 0, 0, 0x0, 33, 0 }, /* Glide64: SPACE DYNAMITES */
+   { 0xCCD4F8AE19F49452ULL, ROM_DB_NAME, 0, 0, 0x0, 2, 0 }, /* Glide64: A Bug's Life */
+   { 0x1FC215320B6466D4ULL, ROM_DB_AUDIO_SIGNAL, 0, 0, 0x0, 0, 0 }, /* Rugrats in Paris - The Movie */
+   { 0xAF754F7B1DD17381ULL, ROM_DB_EEPROM_16KB, 0, 0, 0x0, 0, 0 }, /* Excitebike 64 (U) (Kiosk Demo) [!] */
+   { 0xDCB6EAFAC6BBCFA3ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Wetrix (J) [!] */
+   { 0xEB38F792190EA246ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Madden NFL 2001 (U) [!] */
+   { 0x409D01082FBCAA59ULL, ROM_DB_NAME, 0, 0, 0x0, 70, 0 }, /* Glide64: F1 POLE POSITION 64 */
+   { 0xA92D52E51D26B655ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Flying Dragon (U) [!] */
+   { 0x4D0224A51BEB5794ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* V-Rally Edition 99 (J) [!] */
+   { 0x7C647E651948D305ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Blast Corps (U) (V1.1) [!] */
+   { 0xDC36626A3F3770CBULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Duke Nukem - ZER0 H0UR (E) [!] */
+   { 0x827E4890958468DCULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Shutsugeki! Rogue Chuutai (J) [!] */
+   { 0x4D486681AB7D9245ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Wars - Shadows of the Empire (E) [!] */
+   { 0x02C7ACC3FD9F2107ULL, ROM_DB_NAME, 0, 0, 0x0, 200, 8 }, /* Glide64: MARIOKART64 */
+   { 0xF2CAD2CD0FDF3536ULL, ROM_DB_NAME, 0, 0, 0x0, 42, 0 }, /* Glide64: THPS2 */
+   { 0xD3F10E5D052EA579ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Hey You, Pikachu! (U) [!] */
+   { 0x3918834A15B50C29ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Razor Freestyle Scooter (U) [!] */
+   { 0x4A72BE94D0C95D6DULL, ROM_DB_NAME, 0, 0, 0x0, 40, 4 }, /* Glide64: Tonic Trouble */
+   { 0xFE48F9C0470B8D7AULL, ROM_DB_NAME, 0, 0, 0x0, 196, 0 }, /* Glide64: SUPERMARIO64 */
+   { 0x326E995137B5AC75ULL, ROM_DB_NAME, 0, 0, 0x0, 163, 0 }, /* Glide64: WONDER PROJECT J2 */
+   { 0x6BFF4758E5FF5D5EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mario Kart 64 (J) (V1.0) [!] */
+   { 0x42CF5EA39A1334DFULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* StarCraft 64 (E) [!] */
+   { 0xB4E45B338935FC6EULL, ROM_DB_NAME, 0, 0, 0x0, 26, 0 }, /* Glide64: Forsaken */
+   { 0x27C425D08C2D99C1ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Airboarder 64 (E) [!] */
+   { 0xB23182B54C04C419ULL, ROM_DB_NAME, 0, 0, 0x0, 7, 5 }, /* Glide64: All-Star Baseball 99 */
+   { 0xB4F7D29ED32EBB8CULL, ROM_DB_NAME, 0, 0, 0x0, 108, 0 }, /* Glide64: J F G DISPLAY */
+   { 0x7311375F88FEEA4DULL, ROM_DB_NAME, 0, 0, 0x0, 191, 0 }, /* Glide64: MarioParty2 */
+   { 0xC1D702BD6D416547ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Hoshi no Kirby 64 (J) (V1.0) [!] */
+   { 0x7EAE24889D40A35AULL, ROM_DB_VI_CLOCK_2200, 0, 0, 0x0, 0, 0 }, /* Biohazard 2 (J) [!] */
+   { 0x3C059038C8BF2182ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* V-Rally Edition 99 (U) [!] */
+   { 0x4C2613234F295E1AULL, ROM_DB_AUDIO_SIGNAL | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Disney's Tarzan (G) [!] */
+   { 0x8E6E01FFCCB4F948ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Glover (U) [!] */
+   { 0xEFCEAF0022094848ULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (I) [!] */
+   { 0xD6FBA4A86326AA2CULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Super Mario 64 - Shindou Edition (J) [!] */
+   { 0xD09BA5381C1A5489ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Top Gear Overdrive (E) [!] */
+   { 0x3ED49008901E4A1AULL, ROM_DB_NAME, 0, 0, 0x0, 135, 20 }, /* Glide64: LEGORacers */
+   { 0x8F12C09645DC17E1ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Bug's Life, A (E) [!] */
+   { 0xAC16400ECF5D071AULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* California Speed (U) [!] */
+   { 0x815445F00A78A7C6ULL, ROM_DB_NAME, 0, 0, 0x0, 188, 0 }, /* Glide64: South Park: Chef's L */
+   { 0xD1A008CC44236DEFULL, ROM_DB_NAME, 0, 0, 0x0, 0, 32 }, /* Glide64: OPERATION WINBACK */
+   { 0x02E04F1B8BED61D8ULL, ROM_DB_NAME, 0, 0, 0x0, 82, 0 }, /* Glide64: NFL Quarterback Club */
+   { 0x0CEBC4C70C9CE932ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Wild Choppers (J) [!] */
+   { 0x4324304D44755EF0ULL, ROM_DB_NAME, 0, 0, 0x0, 178, 18 }, /* Glide64: Killer Instinct Gold */
+   { 0xFFCAA7C168858537ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Star Fox 64 (J) [!] */
+   { 0xD83BB920CC406416ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Nushi Tsuri 64 (J) [!] */
+   { 0x736AE6AF4117E9C7ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Mickey no Racing Challenge USA (J) [!] */
+   { 0x06CB44B73163DB94ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Killer Instinct Gold (U) (V1.0) [b2] */
+   { 0xE6616AC4762B4647ULL, ROM_DB_NAME, 0, 0, 0x0, 145, 0 }, /* Glide64: quarterback_club_98 */
+   { 0xAE90DBEB79B89123ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hercules - The Legendary Journeys (E) (M6) [!] */
+   { 0x7A6081FCFF8F7A78ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* 64 Trump Collection - Alice no Wakuwaku Trump World (J) [!] */
+   { 0x8C7C811B544947EAULL, ROM_DB_NAME, 0, 0, 0x0, 76, 0 }, /* Glide64: MS. PAC-MAN MM */
+   { 0x95B2B30B2B6415C1ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Hexen (E) [!] */
+   { 0xBD9DF2AD3EE8CD97ULL, ROM_DB_NAME, 0, 0, 0x0, 81, 0 }, /* Glide64: NINTAMAGAMEGALLERY64 */
+   { 0x13E959A00E93CAB0ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Worms - Armageddon (U) (M3) [!] */
+   { 0x8066D58AC3DECAC1ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Waialae Country Club - True Golf Classics (U) (V1.0) [!] */
+   { 0xA150743ECF2522CDULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Toy Story 2 (U) [!] */
+   { 0xB8F0BD034479189EULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* MRC - Multi Racing Championship (E) (M3) [!] */
+   { 0x4038D1F276DD2391ULL, ROM_DB_NAME, 0, 0, 0x0, 73, 0 }, /* Glide64: F1 WORLD GRAND PRIX */
+   { 0x3EB2E6F3062F9EFEULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Puzzle League (F) [!] */
+   { 0x439B7E7EC1A1495DULL, ROM_DB_FLASH_RAM, 0, 0, 0x0, 0, 0 }, /* Pokemon Stadium 2 (G) [!] */
+   { 0x3C2BA7DDB9F09FADULL, ROM_DB_NAME, 0, 0, 0x0, 167, 1 }, /* Glide64: ZELDA MASTER QUEST */
+   { 0xE2F9A5C211DB4E10ULL, ROM_DB_NAME, 0, 0, 0x0, 93, 0 }, /* Glide64: Mia Hamm Soccer 64 */
+   { 0x7429065F311946DEULL, ROM_DB_NAME, 0, 0, 0x0, 45, 0 }, /* Glide64: TSUWAMONO64 */
+   { 0x6EDD4766A93E9BA8ULL, ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Jikkyou Powerful Pro Yakyuu - Basic Han 2001 (J) [!] */
+   { 0x3A6F8C6B2897BAEBULL, ROM_DB_VI_CLOCK_2200 | ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Indiana Jones and the Infernal Machine (E) */
+   { 0xF774EAEEF0D8B13EULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Fushigi no Dungeon - Fuurai no Shiren 2 - Oni Shuurai! Shiren Jou! (J) [!] */
+   { 0x01B1BA984E27EC07ULL, ROM_DB_NAME, 0, 0, 0x0, 194, 0 }, /* Glide64: TUROK_DINOSAUR_HUNTE */
+   { 0x6C45B60CDCE50E30ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Airboarder 64 (J) [!] */
+   { 0x728E2B166F45EC9EULL, ROM_DB_NAME, 0, 0, 0x0, 167, 1 }, /* Glide64: THE LEGEND OF ZELDA */
+   { 0x3F49EBAEC4404A54ULL, ROM_DB_NAME, 0, 0, 0x0, 171, 0 }, /* Glide64: Robopon64 */
+   { 0x4E4A7643A37439D7ULL, ROM_DB_COUNT_PER_OP, 1, 0, 0x0, 0, 0 }, /* Virtual Pool 64 (U) [!] */
+   { 0x748E99E7FEDD04E4ULL, ROM_DB_NAME, 0, 0, 0x0, 103, 0 }, /* Glide64: Virtual Pool 64 */
+   { 0x38FBF5B953F927C9ULL, ROM_DB_NAME, 0, 0, 0x0, 165, 0 }, /* Glide64: HEXEN */
+   { 0xC851961C78FCAAFAULL, ROM_DB_EEPROM_4KB | ROM_DB_COUNT_PER_OP, 3, 0, 0x0, 0, 0 }, /* Pilotwings 64 (U) [!] */
+   { 0x63E7391CE6CCEA33ULL, ROM_DB_EEPROM_4KB, 0, 0, 0x0, 0, 0 }, /* Tom and Jerry in Fists of Furry (U) [!] */
+   { 0xE675EDCC37890510ULL, ROM_DB_NAME, 0, 0, 0x0, 42, 0 }  /* Glide64: TONY HAWK SKATEBOARD */
+};
+
+#define ROM_DB_GFX_TITLES 203
+
+static const struct rom_db_gfx rom_db_gfx_titles[ROM_DB_GFX_TITLES] = {
+   { "1080 SNOWBOARDING",
+      "swapmode_retro=1\nswapmode=2\nsmart_read=1\noptimize_texrect=1\nhires=1\n" },
+   { "A Bug's Life",
+      "zmode_compare_less=1\n" },
+   { "Toy Story 2",
+      "zmode_compare_less=1\n" },
+   { "AERO FIGHTERS ASSAUL",
+      "clip_zmin=1\n" },
+   { "AIDYN CHRONICLES",
+      "" },
+   { "All-Star Baseball 20",
+      "" },
+   { "All-Star Baseball 99|All Star Baseball 99",
+      "buff_clear=0\n" },
+   { "All-Star Baseball '0",
+      "smart_read=1\nhires=1\n" },
+   { "ARMYMENAIRCOMBAT",
+      "increase_texrect_edge=1\n" },
+   { "BURABURA POYON",
+      "" },
+   { "\312\336\270\274\256\263\274\336\335\276\26264",
+      "" },
+   { "BAKU-BOMBERMAN|BOMBERMAN64E|BOMBERMAN64U",
+      "smart_read=1\nhires=1\n" },
+   { "BAKUBOMB2|BOMBERMAN64U2",
+      "swapmode_retro=1\nfiltering=1\n" },
+   { "BANGAIOH",
+      "" },
+   { "Banjo-Kazooie|BANJO KAZOOIE 2|BANJO TOOIE",
+      "swapmode_retro=1\nfiltering=1\nsmart_read=1\nhires=1\nread_always_no_hwfbe=1\n" },
+   { "BASS HUNTER 64",
+      "buff_clear=0\nswapmode=2\n" },
+   { "BATTLEZONE",
+      "" },
+   { "BEETLE ADVENTURE JP|Beetle Adventure Rac",
+      "n64_z_scale=1\nfiltering=1\nsmart_read=1\nhires=1\n" },
+   { "Bust A Move 3 DX|Bust A Move '99",
+      "filtering=2\n" },
+   { "Bust A Move 2",
+      "filtering=2\nfog=0\n" },
+   { "CARMAGEDDON64",
+      "filtering=1\n" },
+   { "HYDRO THUNDER",
+      "filtering=1\n" },
+   { "CENTRE COURT TENNIS",
+      "" },
+   { "Chameleon Twist2",
+      "filtering=1\n" },
+   { "extreme_g|extremeg",
+      "swapmode_retro=1\nsmart_read=1\nhires=1\n" },
+   { "Forsaken",
+      "swapmode_retro=1\n" },
+   { "Extreme G 2",
+      "smart_read=1\nhires=1\n" },
+   { "MICKEY USA|MICKEY USA PAL",
+      "swapmode_retro=1\nalt_tex_size=1\nsmart_read=1\nhires=1\n" },
+   { "MISCHIEF MAKERS|TROUBLE MAKERS",
+      "swapmode_retro=1\nfiltering=1\nfog=0\n" },
+   { "Sin and Punishment",
+      "swapmode_retro=1\nfiltering=1\nold_style_adither=1\nsmart_read=1\nhires=1\n" },
+   { "Tigger's Honey Hunt",
+      "zmode_compare_less=1\nbuff_clear=0\n" },
+   { "TOM AND JERRY",
+      "depth_bias=2\nfiltering=1\n" },
+   { "SPACE DYNAMITES",
+      "force_microcheck=1\n" },
+   { "SPIDERMAN",
+      "" },
+   { "STARCRAFT 64",
+      "force_microcheck=1\naspectmode=2\n" },
+   { "STAR SOLDIER",
+      "force_microcheck=1\nfiltering=1\nswapmode=0\n" },
+   { "STAR WARS EP1 RACER",
+      "swapmode=2\n" },
+   { "TELEFOOT SOCCER 2000",
+      "buff_clear=0\n" },
+   { "TG RALLY 2",
+      "filtering=1\nbuff_clear=0\nswapmode=2\n" },
+   { "Tonic Trouble",
+      "cpu_write_hack=1\n" },
+   { "SUPERROBOTSPIRITS",
+      "aspectmode=2\n" },
+   { "THPS2|THPS3|TONY HAWK PRO SKATER|TONY HAWK SKATEBOARD",
+      "filtering=1\n" },
+   { "TOP GEAR RALLY 2",
+      "filtering=1\nbuff_clear=0\nswapmode=2\n" },
+   { "TRIPLE PLAY 2000",
+      "smart_read=1\nhires=1\n" },
+   { "TSUWAMONO64",
+      "force_microcheck=1\n" },
+   { "TSUMI TO BATSU",
+      "swapmode_retro=1\nfiltering=1\nold_style_adither=1\nsmart_read=1\nhires=1\n" },
+   { "MortalKombatTrilogy",
+      "filtering=2\n" },
+   { "Perfect Dark",
+      "swapmode_retro=1\nuseless_is_useless=1\ndecrease_fillrect_edge=1\nfiltering=1\nsmart_read=1\noptimize_texrect=0\nhires=1\n" },
+   { "Resident Evil II|BioHazard II",
+      "cpu_write_hack=1\nadjust_aspect=0\nn64_z_scale=1\nswapmode=2\nsmart_read=1\nhires=1\n" },
+   { "World Cup 98",
+      "swapmode=0\nsmart_read=1\nhires=1\n" },
+   { "EXCITEBIKE64",
+      "smart_read=1\nhires=1\n" },
+   { "\264\270\275\304\330\260\321G2",
+      "smart_read=0\nhires=1\n" },
+   { "EARTHWORM JIM 3D",
+      "filtering=1\nbuff_clear=0\n" },
+   { "Cruis'n USA",
+      "filtering=1\nsmart_read=1\nhires=1\n" },
+   { "CruisnExotica",
+      "filtering=1\nbuff_clear=0\nswapmode=0\n" },
+   { "custom robo|CUSTOMROBOV2",
+      "smart_read=1\nhires=1\n" },
+   { "\264\262\272\263\311\276\335\304\261\335\304\336\330\255\260\275",
+      "correct_viewport=1\n" },
+   { "Eltail",
+      "filtering=2\n" },
+   { "DeadlyArts",
+      "smart_read=1\nhires=1\nclip_zmin=1\n" },
+   { "Bottom of the 9th",
+      "filtering=1\nsmart_read=1\noptimize_texrect=0\nhires=1\n" },
+   { "BRUNSWICKBOWLING",
+      "buff_clear=0\nswapmode=0\n" },
+   { "CHOPPER ATTACK",
+      "filtering=1\n" },
+   { "CITY TOUR GP",
+      "force_microcheck=1\nfiltering=1\n" },
+   { "Command&Conquer",
+      "adjust_aspect=2\nfiltering=1\nfog=0\n" },
+   { "CONKER BFD",
+      "lodmode=1\nfiltering=1\nsmart_read=1\noptimize_texrect=1\nhires=1\n" },
+   { "DARK RIFT",
+      "force_microcheck=1\n" },
+   { "Donald Duck Goin' Qu|Donald Duck Quack At",
+      "cpu_write_hack=1\n" },
+   { "\304\336\327\264\323\3353 \311\313\336\300\311\317\301SOS!",
+      "clip_zmin=1\n" },
+   { "DR.MARIO 64",
+      "read_back_to_screen=1\nsmart_read=1\nhires=0\n" },
+   { "F1 POLE POSITION 64",
+      "clip_zmin=1\nfiltering=2\n" },
+   { "HUMAN GRAND PRIX",
+      "filtering=2\n" },
+   { "F1RacingChampionship",
+      "buff_clear=0\nswapmode=0\n" },
+   { "F1 WORLD GRAND PRIX|F1 WORLD GRAND PRIX2",
+      "buff_clear=0\n" },
+   { "F3 \314\263\327\262\311\274\332\3352",
+      "decrease_fillrect_edge=1\n" },
+   { "G.A.S.P!!Fighters'NE",
+      "smart_read=1\nhires=1\nclip_zmin=1\n" },
+   { "MS. PAC-MAN MM",
+      "cpu_write_hack=1\n" },
+   { "NBA Courtside 2|NASCAR 2000|NASCAR 99",
+      "buff_clear=0\nswapmode=0\n" },
+   { "NBA JAM 2000|NBA JAM 99",
+      "buff_clear=0\n" },
+   { "NBA LIVE 2000",
+      "adjust_aspect=0\n" },
+   { "NBA Live 99",
+      "swapmode=0\nadjust_aspect=0\n" },
+   { "NINTAMAGAMEGALLERY64",
+      "force_microcheck=1\n" },
+   { "NFL QBC 2000|NFL Quarterback Club",
+      "swapmode=0\n" },
+   { "GANBAKE GOEMON|MYSTICAL NINJA|MYSTICAL NINJA2 SG",
+      "optimize_texrect=0\nalt_tex_size=1\nfiltering=1\nsmart_read=1\nhires=1\n" },
+   { "GAUNTLET LEGENDS",
+      "swapmode=2\n" },
+   { "Getter Love!!",
+      "zmode_compare_less=1\nfiltering=2\n" },
+   { "GOEMON2 DERODERO|GOEMONS GREAT ADV",
+      "filtering=1\nsmart_read=1\nhires=1\n" },
+   { "GOLDEN NUGGET 64",
+      "filtering=2\n" },
+   { "GT64",
+      "force_microcheck=1\nfiltering=1\n" },
+   { "\312\321\275\300\260\323\311\266\336\300\33064",
+      "force_microcheck=1\n" },
+   { "HARVESTMOON64|\316\336\270\274\336\256\263\323\311\266\336\300\3302",
+      "zmode_compare_less=1\nfog=0\n" },
+   { "MGAH VOL1",
+      "force_microcheck=1\nzmode_compare_less=1\nsmart_read=1\n" },
+   { "MARIO STORY|PAPER MARIO",
+      "useless_is_useless=1\nhires_buf_clear=0\nfiltering=1\nswapmode=2\nsmart_read=1\noptimize_texrect=0\nhires=1\nread_alpha=1\n" },
+   { "Mia Hamm Soccer 64",
+      "buff_clear=0\n" },
+   { "NITRO64",
+      "smart_read=1\nhires=1\n" },
+   { "NUCLEARSTRIKE64",
+      "buff_clear=0\n" },
+   { "NFL BLITZ|NFL BLITZ 2001|NFL BLITZ SPECIAL ED",
+      "lodmode=1\n" },
+   { "Monaco Grand Prix|Monaco GP Racing 2",
+      "buff_clear=0\n" },
+   { "\323\330\300\274\256\263\267\33664",
+      "correct_viewport=1\n" },
+   { "NEWTETRIS",
+      "pal230=1\nincrease_texrect_edge=1\nfog=0\n" },
+   { "MLB FEATURING K G JR",
+      "read_back_to_screen=2\n" },
+   { "HSV ADVENTURE RACING",
+      "n64_z_scale=1\nfiltering=1\nsmart_read=1\nhires=1\n" },
+   { "MarioGolf64",
+      "ignore_aux_copy=1\nbuff_clear=0\nsmart_read=1\nhires=1\n" },
+   { "Virtual Pool 64",
+      "buff_clear=0\n" },
+   { "TWINE",
+      "filtering=1\n" },
+   { "V-RALLY",
+      "filtering=1\nbuff_clear=0\nswapmode=0\n" },
+   { "Waialae Country Club",
+      "smart_read=1\nhires=1\n" },
+   { "TWISTED EDGE",
+      "smart_read=1\nhires=1\n" },
+   { "STAR TWINS|JET FORCE GEMINI|J F G DISPLAY",
+      "read_back_to_screen=1\ndecrease_fillrect_edge=1\nswapmode=2\nsmart_read=1\nhires=1\n" },
+   { "\304\336\327\264\323\335 \320\257\302\311\276\262\332\262\276\267",
+      "read_back_to_screen=1\nsmart_read=1\nhires=1\n" },
+   { "HEIWA \312\337\301\335\272 \334\260\331\304\33664",
+      "fog=0\nswapmode=2\nsmart_read=1\nhires=1\n" },
+   { "\267\327\257\304\266\262\271\302 64\300\335\303\262\300\336\335",
+      "filtering=1\nbuff_clear=0\n" },
+   { "\275\260\312\337\260\333\316\336\257\304\300\262\276\33564",
+      "smart_read=1\nhires=1\n" },
+   { "Supercross",
+      "buff_clear=0\n" },
+   { "Top Gear Overdrive",
+      "buff_clear=0\n" },
+   { "\275\275\322!\300\262\276\335\312\337\275\336\331\300\336\317",
+      "force_microcheck=1\nfog=0\nswapmode=0\n" },
+   { "\320\335\305\303\336\300\317\272\336\257\301\334\260\331\304\336",
+      "fog=0\n" },
+   { "Taz Express",
+      "filtering=1\nbuff_clear=0\n" },
+   { "Top Gear Hyper Bike",
+      "swapmode=2\nsmart_read=1\nhires=1\n" },
+   { "I S S 64",
+      "swapmode=2\nold_style_adither=1\n" },
+   { "I.S.S.2000",
+      "smart_read=1\nhires=1\n" },
+   { "ITF 2000|IT&F SUMMERGAMES",
+      "filtering=1\nsmart_read=1\nhires=1\n" },
+   { "J_league 1997",
+      "swapmode=0\n" },
+   { "J WORLD SOCCER3",
+      "swapmode=2\n" },
+   { "KEN GRIFFEY SLUGFEST",
+      "read_back_to_screen=2\nswapmode=0\nsmart_read=1\nhires=1\n" },
+   { "MASTERS'98",
+      "smart_read=1\nhires=1\n" },
+   { "MO WORLD LEAGUE SOCC",
+      "buff_clear=0\n" },
+   { "\307\274\302\336\33064",
+      "force_microcheck=1\nbuff_clear=0\n" },
+   { "PACHINKO365NICHI",
+      "correct_viewport=1\n" },
+   { "PERFECT STRIKER",
+      "swapmode=2\n" },
+   { "ROCKETROBOTONWHEELS",
+      "clip_zmin=1\n" },
+   { "SD HIRYU STADIUM",
+      "force_microcheck=1\n" },
+   { "Shadow of the Empire",
+      "swapmode=2\n" },
+   { "RUSH 2049",
+      "filtering=1\n" },
+   { "SCARS",
+      "filtering=1\n" },
+   { "LEGORacers",
+      "cpu_write_hack=1\nbuff_clear=0\nsmart_read=1\nhires=1\nread_alpha=1\n" },
+   { "Lode Runner 3D",
+      "swapmode=0\n" },
+   { "Parlor PRO 64",
+      "force_microcheck=1\nfiltering=1\n" },
+   { "PUZZLE LEAGUE N64|PUZZLE LEAGUE",
+      "force_microcheck=1\nfiltering=2\nfog=0\nbuff_clear=0\nsmart_read=1\nhires=0\nread_alpha=1\n" },
+   { "POKEMON SNAP",
+      "render_skip=0\nhires=0\nread_always_no_hwfbe=1\n" },
+   { "POKEMON STADIUM|POKEMON STADIUM G&S",
+      "buff_clear=0\nsmart_read=1\noptimize_texrect=0\nhires=0\nread_alpha=1\nfb_crc_mode=2\n" },
+   { "POKEMON STADIUM 2",
+      "buff_clear=0\nswapmode=2\nsmart_read=1\noptimize_texrect=0\nhires=1\nread_alpha=1\nfb_crc_mode=2\n" },
+   { "RAINBOW SIX",
+      "increase_texrect_edge=1\n" },
+   { "RALLY CHALLENGE|Rally'99",
+      "filtering=1\nbuff_clear=0\nsmart_read=1\nhires=1\n" },
+   { "Rayman 2",
+      "cpu_write_hack=1\n" },
+   { "quarterback_club_98",
+      "hires_buf_clear=0\nfiltering=1\nswapmode=0\nbuff_clear=0\nsmart_read=1\noptimize_texrect=0\nhires=1\nread_alpha=1\n" },
+   { "PowerLeague64",
+      "force_quad3d=1\n" },
+   { "Racing Simulation 2",
+      "buff_clear=0\n" },
+   { "TOP GEAR RALLY",
+      "depth_bias=64\n" },
+   { "SMASH BROTHERS",
+      "swapmode_retro=1\n" },
+   { "Pilot Wings64",
+      "swapmode_retro=1\ndepth_bias=10\nbuff_clear=0\n" },
+   { "DRACULA MOKUSHIROKU|DRACULA MOKUSHIROKU2",
+      "old_style_adither=1\n" },
+   { "CASTLEVANIA|CASTLEVANIA2",
+      "swapmode_retro=1\nold_style_adither=1\nread_always_no_hwfbe=1\n" },
+   { "Dual heroes JAPAN|Dual heroes PAL|Dual heroes USA",
+      "filtering=1\nswapmode=0\n" },
+   { "JEREMY MCGRATH SUPER",
+      "swapmode=0\n" },
+   { "Kirby64",
+      "filtering=1\nbuff_clear=0\nswapmode=0\n" },
+   { "GOLDENEYE",
+      "swapmode_retro=1\nlodmode=1\ndepth_bias=40\nfiltering=1\nsmart_read=1\nhires=1\n" },
+   { "DONKEY KONG 64",
+      "lodmode=1\ndepth_bias=64\nread_always=1\n" },
+   { "Glover",
+      "filtering=1\n" },
+   { "GEX: ENTER THE GECKO|Gex 3 Deep Cover Gec",
+      "filtering=1\n" },
+   { "WAVE RACE 64",
+      "swapmode_retro=1\nlodmode=1\npal230=1\n" },
+   { "WILD CHOPPERS",
+      "filtering=1\n" },
+   { "Wipeout 64",
+      "filtering=1\nswapmode=0\n" },
+   { "WONDER PROJECT J2",
+      "buff_clear=0\nswapmode=0\n" },
+   { "Doom64",
+      "swapmode_retro=1\n" },
+   { "HEXEN",
+      "cpu_write_hack=1\nfiltering=1\nbuff_clear=0\nswapmode=2\n" },
+   { "ZELDA MAJORA'S MASK|THE MASK OF MUJURA",
+      "swapmode_retro=1\nfiltering=1\nsmart_read=1\nhires=1\nfb_crc_mode=0\n" },
+   { "THE LEGEND OF ZELDA|ZELDA MASTER QUEST",
+      "swapmode_retro=1\nfiltering=1\nlodmode=1\nsmart_read=1\nhires=1\nhack=OOT\n" },
+   { "Re-Volt",
+      "" },
+   { "RIDGE RACER 64",
+      "swapmode_retro=1\nforce_calc_sphere=1\nsmart_read=1\nhires=1\nread_always_no_hwfbe=1\n" },
+   { "ROAD RASH 64",
+      "swapmode=2\n" },
+   { "Robopon64",
+      "smart_read=1\nhires=1\n" },
+   { "RONALDINHO SOCCER",
+      "swapmode=2\nold_style_adither=1\n" },
+   { "RTL WLS2000",
+      "buff_clear=0\n" },
+   { "BIOFREAKS",
+      "buff_clear=0\nsmart_read=1\nhires=1\n" },
+   { "Blast Corps|Blastdozer",
+      "swapmode=0\nsmart_read=1\nhires=1\nread_alpha=1\n" },
+   { "blitz2k",
+      "lodmode=1\n" },
+   { "Body Harvest",
+      "smart_read=1\nhires=1\n" },
+   { "Killer Instinct Gold|KILLER INSTINCT GOLD",
+      "swapmode_retro=1\nfiltering=1\nbuff_clear=0\n" },
+   { "KNIFE EDGE",
+      "filtering=1\n" },
+   { "Knockout Kings 2000",
+      "smart_read=1\nhires=1\nread_alpha=1\n" },
+   { "MACE",
+      "swapmode_retro=1\nincrease_texrect_edge=1\nfiltering=1\n" },
+   { "Quake",
+      "force_microcheck=1\nbuff_clear=0\nswapmode=2\n" },
+   { "QUAKE II",
+      "smart_read=1\nhires=1\n" },
+   { "Holy Magic Century",
+      "filtering=2\n" },
+   { "Quest 64",
+      "" },
+   { "Silicon Valley",
+      "filtering=1\n" },
+   { "SNOWBOARD KIDS2|Snobow Kids 2",
+      "swapmode=0\nfiltering=1\n" },
+   { "South Park Chef's Lu|South Park: Chef's L",
+      "filtering=1\nfog=0\nbuff_clear=0\n" },
+   { "LAMBORGHINI",
+      "" },
+   { "MAGICAL TETRIS",
+      "force_microcheck=1\nfog=0\n" },
+   { "MarioParty",
+      "clip_zmin=1\nswapmode=2\n" },
+   { "MarioParty2",
+      "swapmode=2\n" },
+   { "Mega Man 64|RockMan Dash",
+      "increase_texrect_edge=1\nsmart_read=1\nhires=1\n" },
+   { "TUROK_DINOSAUR_HUNTE",
+      "swapmode_retro=1\ndepth_bias=1\nlodmode=1\n" },
+   { "Turok 2",
+      "swapmode_retro=1\n" },
+   { "SUPER MARIO 64|SUPERMARIO64",
+      "swapmode_retro=1\ndepth_bias=64\nlodmode=1\nfiltering=1\n" },
+   { "SM64 Star Road",
+      "depth_bias=1\nlodmode=1\nfiltering=1\n" },
+   { "SUPERMAN",
+      "cpu_write_hack=1\n" },
+   { "TETRISPHERE",
+      "alt_tex_size=1\nincrease_texrect_edge=1\nsmart_read=1\nhires=1\nfb_crc_mode=2\n" },
+   { "MARIOKART64",
+      "swapmode_retro=1\ndepth_bias=30\nstipple_mode=1\nstipple_pattern=4286595040\nread_always_no_hwfbe=1\n" },
+   { "YOSHI STORY",
+      "swapmode_retro=1\nfiltering=1\nfog=0\n" },
+   { "STARFOX64",
+      "swapmode_retro=1\n" },
+   { "Mini Racers",
+      "force_microcheck=1\nbuff_clear=0\nsmart_read=1\nhires=1\nswapmode=0\n" }
+};
+
+#define ROM_DB_GFX_HACKS 33
+
+static const struct rom_db_gfx rom_db_gfx_hacks[ROM_DB_GFX_HACKS] = {
+   { "ZELDA|MASK",
+      "hack=Zelda\nflame_corona=1\n" },
+   { "ROADSTERS TROPHY",
+      "hack=Zelda\n" },
+   { "Diddy Kong Racing",
+      "swapmode_retro=1\nhack=Diddy\n" },
+   { "Tonic Trouble",
+      "hack=Tonic\n" },
+   { "All+Star+Baseball",
+      "hack=ASB\n" },
+   { "Beetle|BEETLE|HSV",
+      "hack=BAR\n" },
+   { "I S S 64|J WORLD SOCCER3|PERFECT STRIKER|RONALDINHO SOCCER",
+      "hack=ISS64\n" },
+   { "MARIOKART64",
+      "hack=MK64\n" },
+   { "NITRO64",
+      "hack=WCWnitro\n" },
+   { "CHOPPER_ATTACK|WILD CHOPPERS",
+      "hack=Chopper\n" },
+   { "Resident Evil II|BioHazard II",
+      "hack=RE2\n" },
+   { "YOSHI STORY",
+      "hack=Yoshi\n" },
+   { "F-Zero X|F-ZERO X",
+      "hack=Fzero\n" },
+   { "PAPER MARIO|MARIO STORY",
+      "hack=PMario\n" },
+   { "TOP GEAR RALLY 2",
+      "hack=TGR2\n" },
+   { "TOP GEAR RALLY",
+      "hack=TGR\n" },
+   { "Top Gear Hyper Bike",
+      "hack=Hyperbike\n" },
+   { "Killer Instinct Gold|KILLER INSTINCT GOLD",
+      "hack=KI\n" },
+   { "Knockout Kings 2000",
+      "hack=Knockout\n" },
+   { "LEGORacers",
+      "hack=Lego\n" },
+   { "OgreBattle64",
+      "hack=Ogre64\n" },
+   { "Pilot Wings64",
+      "hack=Pilotwings\n" },
+   { "Supercross",
+      "hack=Supercross\n" },
+   { "STARCRAFT 64",
+      "hack=Starcraft\n" },
+   { "BANJO KAZOOIE 2|BANJO TOOIE",
+      "hack=Banjo2\n" },
+   { "FIFA: RTWC 98|RoadToWorldCup98",
+      "hack=Fifa98\n" },
+   { "Mega Man 64|RockMan Dash",
+      "hack=Megaman\n" },
+   { "MISCHIEF MAKERS|TROUBLE MAKERS",
+      "hack=Makers\n" },
+   { "GOLDENEYE",
+      "hack=GoldenEye\n" },
+   { "Blast Corps|Blastdozer",
+      "hack=Blastcorps\n" },
+   { "PUZZLE LEAGUE",
+      "hack=PPL\n" },
+   { "WIN BACK|OPERATION WINBACK",
+      "hack=Winback\n" },
+   { "POKEMON STADIUM 2",
+      "smart_read=0\n" }
+};
@@ -1,4 +1,5 @@
 /* This file was generated by gen_romdb.py */
+/* rom.c reads these through rom_db.c, run tools/gen_romhash.py after editing */
 
 /* Games that need alternate VI timing */
 static const uint64_t lut_alternate_vi[] = {
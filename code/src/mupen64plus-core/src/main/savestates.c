@@ -69,7 +69,32 @@ static const int savestate_latest_version = 0x00010000;  /* 1.0 */
 #define PUTDATA(buff, type, value) \
     do { type x = value; PUTARRAY(&x, buff, type, 1); } while(0)
 
-int savestates_load_m64p(const unsigned char *data, size_t size)
+/* Copies RDRAM from the savestate a 4KB page at a time and only drops the
+ * r4300 code compiled from the pages whose contents change. */
+static unsigned char *savestates_rollback_rdram(unsigned char *curr)
+{
+   uint32_t page;
+
+   for (page = 0; page < RDRAM_MAX_SIZE; page += 0x1000)
+   {
+      uint32_t *dram = g_dev.ri.rdram.dram + page/4;
+
+      to_little_endian_buffer(curr, 4, 0x1000/4);
+      if (memcmp(dram, curr, 0x1000))
+      {
+         memcpy(dram, curr, 0x1000);
+         invalidate_r4300_cached_code(0x80000000 + page, 0x1000);
+         invalidate_r4300_cached_code(0xa0000000 + page, 0x1000);
+      }
+      curr += 0x1000;
+   }
+
+   return curr;
+}
+
+/* with rollback set, the state is one this session saved moments ago:
+ * cached code is kept for every page that did not change since. */
+static int savestates_load(const unsigned char *data, size_t size, int rollback)
 {
    char queue[1024];
    int version;
@@ -215,8 +240,31 @@ int savestates_load_m64p(const unsigned char *data, size_t size)
    g_dev.dp.dps_regs[DPS_BUFTEST_ADDR_REG] = GETDATA(curr, uint32_t);
    g_dev.dp.dps_regs[DPS_BUFTEST_DATA_REG] = GETDATA(curr, uint32_t);
 
-   COPYARRAY(g_dev.ri.rdram.dram, curr, uint32_t, RDRAM_MAX_SIZE/4);
-   COPYARRAY(g_dev.sp.mem, curr, uint32_t, SP_MEM_SIZE/4);
+   /* code in TLB mapped pages is cached by virtual address, leave those
+    * to the full flush in savestates_load_set_pc() */
+   if (rollback)
+   {
+      for (i = 0; i < 32; i++)
+         if (tlb_e[i].v_even || tlb_e[i].v_odd)
+            rollback = 0;
+   }
+
+   if (rollback)
+   {
+      curr = savestates_rollback_rdram(curr);
+      to_little_endian_buffer(curr, 4, SP_MEM_SIZE/4);
+      if (memcmp(g_dev.sp.mem, curr, SP_MEM_SIZE))
+      {
+         memcpy(g_dev.sp.mem, curr, SP_MEM_SIZE);
+         invalidate_r4300_cached_code(0xa4000000, SP_MEM_SIZE);
+      }
+      curr += SP_MEM_SIZE;
+   }
+   else
+   {
+      COPYARRAY(g_dev.ri.rdram.dram, curr, uint32_t, RDRAM_MAX_SIZE/4);
+      COPYARRAY(g_dev.sp.mem, curr, uint32_t, SP_MEM_SIZE/4);
+   }
    COPYARRAY(g_dev.si.pif.ram, curr, uint8_t, PIF_RAM_SIZE);
 
    g_dev.pi.use_flashram = GETDATA(curr, int);
@@ -275,7 +323,18 @@ int savestates_load_m64p(const unsigned char *data, size_t size)
       tlb_e[i].phys_odd   = GETDATA(curr, unsigned int);
    }
 
-   savestates_load_set_pc(GETDATA(curr, uint32_t));
+   if (rollback)
+   {
+      /* same for a state that had TLB mappings of its own */
+      for (i = 0; i < 32; i++)
+         if (tlb_e[i].v_even || tlb_e[i].v_odd)
+            rollback = 0;
+   }
+
+   if (rollback)
+      savestates_rollback_set_pc(GETDATA(curr, uint32_t));
+   else
+      savestates_load_set_pc(GETDATA(curr, uint32_t));
 
    *r4300_next_interrupt() = GETDATA(curr, unsigned int);
    g_dev.vi.next_vi  = GETDATA(curr, unsigned int);
@@ -294,6 +353,16 @@ int savestates_load_m64p(const unsigned char *data, size_t size)
    return 1;
 }
 
+int savestates_load_m64p(const unsigned char *data, size_t size)
+{
+   return savestates_load(data, size, 0);
+}
+
+int savestates_rollback_m64p(const unsigned char *data, size_t size)
+{
+   return savestates_load(data, size, 1);
+}
+
 int savestates_save_m64p(unsigned char *data, size_t size)
 {
    unsigned char outbuf[4];
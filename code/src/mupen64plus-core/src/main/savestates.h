@@ -33,6 +33,9 @@ typedef enum _savestates_job
 } savestates_job;
 
 int savestates_load_m64p(const unsigned char *data, size_t size);
+/* loads a state saved moments ago by this session, keeping the cached
+ * r4300 code of the pages that did not change since */
+int savestates_rollback_m64p(const unsigned char *data, size_t size);
 int savestates_save_m64p(unsigned char *data, size_t size);
 
 
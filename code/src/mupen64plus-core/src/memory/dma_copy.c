@@ -0,0 +1,127 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - dma_copy.c                                              *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "dma_copy.h"
+#include "memory.h"
+
+#include <string.h>
+
+#if defined(DMA_COPY_CHECK)
+#define M64P_CORE_PROTOTYPES 1
+#include "../api/callbacks.h"
+#include "../api/m64p_types.h"
+
+#include <stdlib.h>
+#endif
+
+static void dma_copy_bytes(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length)
+{
+   uint32_t i;
+
+   for (i = 0; i < length; ++i)
+      dst[(dst_addr + i) ^ S8] = src[(src_addr + i) ^ S8];
+}
+
+static void dma_copy_fast(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length)
+{
+   uint32_t head;
+
+   /* Different alignments: every byte lands in a different lane */
+   if (((dst_addr ^ src_addr) & 3) != 0 || length < 8)
+   {
+      dma_copy_bytes(dst, dst_addr, src, src_addr, length);
+      return;
+   }
+
+   head = (4 - (dst_addr & 3)) & 3;
+   dma_copy_bytes(dst, dst_addr, src, src_addr, head);
+   dst_addr += head;
+   src_addr += head;
+   length   -= head;
+
+   /* Whole words have the same in-memory layout on both sides */
+   memcpy(dst + dst_addr, src + src_addr, length & ~3u);
+   dst_addr += length & ~3u;
+   src_addr += length & ~3u;
+
+   dma_copy_bytes(dst, dst_addr, src, src_addr, length & 3);
+}
+
+#if defined(DMA_COPY_CHECK)
+
+static struct
+{
+   uint64_t fast_bytes;
+   uint64_t slow_bytes;
+   uint32_t copies;
+} dma_copy_stats;
+
+void dma_copy(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length)
+{
+   /* Bytes touched by the swizzled loop are within the enclosing words */
+   uint32_t first = dst_addr & ~3u;
+   uint32_t span  = ((dst_addr + length + 3) & ~3u) - first;
+   uint8_t *expected;
+
+   if (length == 0)
+      return;
+
+   expected = (uint8_t*)malloc(span);
+   if (expected == NULL)
+   {
+      dma_copy_fast(dst, dst_addr, src, src_addr, length);
+      return;
+   }
+
+   memcpy(expected, dst + first, span);
+   dma_copy_bytes(expected, dst_addr - first, src, src_addr, length);
+
+   dma_copy_fast(dst, dst_addr, src, src_addr, length);
+
+   if (memcmp(expected, dst + first, span) != 0)
+      DebugMessage(M64MSG_ERROR, "dma_copy mismatch: dst=%08x src=%08x length=%u",
+            dst_addr, src_addr, length);
+
+   if (((dst_addr ^ src_addr) & 3) == 0 && length >= 8)
+      dma_copy_stats.fast_bytes += length;
+   else
+      dma_copy_stats.slow_bytes += length;
+
+   if ((++dma_copy_stats.copies & 0xfff) == 0)
+      DebugMessage(M64MSG_INFO, "dma_copy: %u copies, %llu bytes word path, %llu bytes byte path",
+            dma_copy_stats.copies,
+            (unsigned long long)dma_copy_stats.fast_bytes,
+            (unsigned long long)dma_copy_stats.slow_bytes);
+
+   free(expected);
+}
+
+#else
+
+void dma_copy(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length)
+{
+   dma_copy_fast(dst, dst_addr, src, src_addr, length);
+}
+
+#endif
@@ -0,0 +1,44 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - dma_copy.h                                              *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef M64P_MEMORY_DMA_COPY_H
+#define M64P_MEMORY_DMA_COPY_H
+
+#include <stdint.h>
+
+/* Byte copy between two buffers stored as native 32-bit words
+ * (byte n lives at n ^ S8), as done by the PI, SP and save memory DMAs.
+ *
+ * Equivalent to
+ *    for (i = 0; i < length; ++i)
+ *       dst[(dst_addr + i) ^ S8] = src[(src_addr + i) ^ S8];
+ *
+ * When both addresses have the same alignment, the whole words in the
+ * middle share the same layout on both sides and are copied in bulk; only
+ * the unaligned head and tail go through the swizzled byte loop.
+ *
+ * Built with DMA_COPY_CHECK, every copy is checked against the byte loop
+ * and the number of bytes moved by each path is reported periodically.
+ * tools/dmacopycmp.c checks it against the loops it replaced offline.
+ */
+void dma_copy(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length);
+
+#endif /* M64P_MEMORY_DMA_COPY_H */
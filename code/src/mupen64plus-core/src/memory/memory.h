@@ -33,6 +33,29 @@
 #define AI_STATUS_FIFO_FULL	0x80000000		/* Bit 31: full */
 #define AI_STATUS_DMA_BUSY	   0x40000000		/* Bit 30: busy */
 
+#if defined(LOCKSTEP)
+#include "r4300/lockstep.h"
+
+#define read_word_in_memory() lockstep_read(readmem, 4)
+#define read_byte_in_memory() lockstep_read(readmemb, 1)
+#define read_hword_in_memory() lockstep_read(readmemh, 2)
+#define read_dword_in_memory() lockstep_read(readmemd, 8)
+#define write_word_in_memory() lockstep_write(writemem, 4)
+#define write_byte_in_memory() lockstep_write(writememb, 1)
+#define write_hword_in_memory() lockstep_write(writememh, 2)
+#define write_dword_in_memory() lockstep_write(writememd, 8)
+#elif defined(BLOCK_PROFILER)
+#include "r4300/block_profiler.h"
+
+#define read_word_in_memory() block_profiler_read(readmem)
+#define read_byte_in_memory() block_profiler_read(readmemb)
+#define read_hword_in_memory() block_profiler_read(readmemh)
+#define read_dword_in_memory() block_profiler_read(readmemd)
+#define write_word_in_memory() block_profiler_write(writemem)
+#define write_byte_in_memory() block_profiler_write(writememb)
+#define write_hword_in_memory() block_profiler_write(writememh)
+#define write_dword_in_memory() block_profiler_write(writememd)
+#else
 #define read_word_in_memory() readmem[address>>16]()
 #define read_byte_in_memory() readmemb[address>>16]()
 #define read_hword_in_memory() readmemh[address>>16]()
@@ -41,6 +64,7 @@
 #define write_byte_in_memory() writememb[address >>16]()
 #define write_hword_in_memory() writememh[address >>16]()
 #define write_dword_in_memory() writememd[address >>16]()
+#endif
 
 extern uint32_t address, cpu_word;
 extern uint8_t cpu_byte;
@@ -24,6 +24,7 @@
 
 #include "../api/m64p_types.h"
 #include "../api/callbacks.h"
+#include "../memory/dma_copy.h"
 #include "../memory/memory.h"
 #include "../ri/ri_controller.h"
 
@@ -41,7 +42,6 @@ void init_flashram(struct flashram* flashram,
 
 static void flashram_command(struct pi_controller *pi, uint32_t command)
 {
-   unsigned int i;
    struct flashram *flashram = &pi->flashram;
    uint8_t *dram             = (uint8_t*)pi->ri->rdram.dram;
 
@@ -69,15 +69,15 @@ static void flashram_command(struct pi_controller *pi, uint32_t command)
                break;
             case FLASHRAM_MODE_ERASE:
                {
-                  for (i=flashram->erase_offset; i<(flashram->erase_offset+128); ++i)
-                     flashram->data[i^S8] = 0xff;
+                  /* erase_offset is a multiple of 128, so the swizzle doesn't matter */
+                  memset(flashram->data + flashram->erase_offset, 0xff, 128);
                   flashram_save(flashram);
                }
                break;
             case FLASHRAM_MODE_WRITE:
                {
-                  for(i = 0; i < 128; ++i)
-                     flashram->data[(flashram->erase_offset+i)^S8]= dram[(flashram->write_pointer+i)^S8];
+                  dma_copy(flashram->data, flashram->erase_offset,
+                        dram, flashram->write_pointer, 128);
                   flashram_save(flashram);
                }
                break;
@@ -152,7 +152,7 @@ int write_flashram_command(void* opaque, uint32_t address, uint32_t value, uint3
 void dma_read_flashram(struct pi_controller *pi)
 {
    unsigned int dram_addr, cart_addr;
-   unsigned int i, length;
+   unsigned int length;
    struct flashram* flashram = &pi->flashram;
    uint32_t *dram            = pi->ri->rdram.dram;
    uint8_t *mem              = flashram->data;
@@ -168,8 +168,7 @@ void dma_read_flashram(struct pi_controller *pi)
          dram_addr = pi->regs[PI_DRAM_ADDR_REG];
          cart_addr = ((pi->regs[PI_CART_ADDR_REG]-0x08000000)&0xffff)*2;
 
-         for (i = 0; i < length; ++i)
-            ((uint8_t*)dram)[(dram_addr+i)^S8] = mem[(cart_addr+i)^S8];
+         dma_copy((uint8_t*)dram, dram_addr, mem, cart_addr, length);
          break;
       default:
          DebugMessage(M64MSG_WARNING, "unknown dma_read_flashram: %x", flashram->mode);
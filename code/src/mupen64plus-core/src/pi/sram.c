@@ -22,6 +22,7 @@
 #include "sram.h"
 #include "pi_controller.h"
 
+#include "memory/dma_copy.h"
 #include "memory/memory.h"
 
 #include "ri/ri_controller.h"
@@ -49,7 +50,6 @@ void format_sram(uint8_t* sram)
 
 void dma_write_sram(struct pi_controller* pi)
 {
-   size_t i;
    size_t length = (pi->regs[PI_RD_LEN_REG] & 0xffffff) + 1;
 
    uint8_t* sram = pi->sram.data;
@@ -57,15 +57,13 @@ void dma_write_sram(struct pi_controller* pi)
    uint32_t cart_addr = pi->regs[PI_CART_ADDR_REG] - 0x08000000;
    uint32_t dram_addr = pi->regs[PI_DRAM_ADDR_REG];
 
-   for(i = 0; i < length; ++i)
-      sram[(cart_addr+i)^S8] = dram[(dram_addr+i)^S8];
+   dma_copy(sram, cart_addr, dram, dram_addr, length);
 
    sram_save(&pi->sram);
 }
 
 void dma_read_sram(struct pi_controller* pi)
 {
-   size_t i;
    size_t length = (pi->regs[PI_WR_LEN_REG] & 0xffffff) + 1;
 
    uint8_t* sram = pi->sram.data;
@@ -73,6 +71,5 @@ void dma_read_sram(struct pi_controller* pi)
    uint32_t cart_addr = (pi->regs[PI_CART_ADDR_REG] - 0x08000000) & 0xffff;
    uint32_t dram_addr = pi->regs[PI_DRAM_ADDR_REG];
 
-   for(i = 0; i < length; ++i)
-      dram[(dram_addr+i)^S8] = sram[(cart_addr+i)^S8];
+   dma_copy(dram, dram_addr, sram, cart_addr, length);
 }
@@ -58,6 +58,16 @@ static float *audio_in_buffer_float;
 static float *audio_out_buffer_float;
 static int16_t *audio_out_buffer_s16;
 
+/* set while frames are emulated only to be rolled back (run-ahead) */
+static int audio_muted = 0;
+
+/* fast-forward keeps one stereo frame out of every audio_decimation so the
+ * output stays at the normal rate, audio_decimation_phase carries the
+ * position over to the next buffer */
+static unsigned audio_decimation = 1;
+static unsigned audio_decimation_phase = 0;
+static int16_t audio_decimated[0x40000 / 4];
+
 void (*audio_convert_s16_to_float_arm)(float *out,
       const int16_t *in, size_t samples, float gain);
 void (*audio_convert_float_to_s16_arm)(int16_t *out,
@@ -152,6 +162,25 @@ static void aiLenChanged(void* user_data, const void* buffer, size_t size)
       p[i + 1] ^= p[i + 3];
    }
 
+   /* the swap above changes RDRAM so it still has to happen when muted */
+   if (audio_muted)
+      return;
+
+   if (audio_decimation > 1)
+   {
+      size_t kept = 0;
+
+      for (i = audio_decimation_phase; i < frames; i += audio_decimation, kept++)
+      {
+         audio_decimated[kept * 2 + 0] = raw_data[i * 2 + 0];
+         audio_decimated[kept * 2 + 1] = raw_data[i * 2 + 1];
+      }
+      audio_decimation_phase = i - frames;
+
+      raw_data = audio_decimated;
+      frames   = kept;
+   }
+
 audio_batch:
    out               = NULL;
    ratio             = 44100.0 / GameFreq;
@@ -227,6 +256,20 @@ void push_audio_samples_via_libretro(void* user_data, const void* buffer, size_t
    ai->regs[AI_DRAM_ADDR_REG] = saved_ai_dram;
 }
 
+void audio_libretro_set_muted(int muted)
+{
+   audio_muted = muted;
+}
+
+void audio_libretro_set_decimation(unsigned factor)
+{
+   if (factor < 1)
+      factor = 1;
+
+   /* the phase is kept, fast-forward switches back to 1 after every call */
+   audio_decimation = factor;
+}
+
 int neilGetSoundBufferResampledAddress()
 {
     return (int)&resampled_out_buf;
@@ -27,4 +27,9 @@
 void init_audio_libretro(unsigned max_frames);
 void deinit_audio_libretro(void);
 
+/* Drop the samples of the frames that follow, see retro_run_ahead(). */
+void audio_libretro_set_muted(int muted);
+/* Keep only every factor-th sample, see retro_run_fast_forward(). */
+void audio_libretro_set_decimation(unsigned factor);
+
 #endif
@@ -95,7 +95,9 @@ static m64p_error EmptyGetVersionFunc(m64p_plugin_type *PluginType, int *PluginV
         X##FBGetFrameBufferInfo \
     }
 
-//DEFINE_GFX(angrylion);
+#ifdef HAVE_THR_AL
+DEFINE_GFX(angrylion);
+#endif
 #ifdef HAVE_RICE
 DEFINE_GFX(rice);
 #endif
@@ -269,6 +271,9 @@ static m64p_error plugin_start_rsp(void)
 /* global functions */
 void plugin_connect_all(enum gfx_plugin_type gfx_plugin, enum rsp_plugin_type rsp_plugin)
 {
+   /* point the gDP/gSP entry points at the HLE renderer in use */
+   gfx_hle_connect(gfx_plugin);
+
    switch (gfx_plugin)
    {
       case GFX_ANGRYLION:
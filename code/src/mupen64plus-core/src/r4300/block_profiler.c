@@ -0,0 +1,618 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - block_profiler.c                                        *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#if defined(BLOCK_PROFILER)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api/callbacks.h"
+#include "api/m64p_types.h"
+#include "block_profiler.h"
+#include "memory/memory.h"
+#include "r4300.h"
+
+/* average number of ops between two timed ops */
+#define BLOCK_PROFILER_PERIOD    512
+/* write the profile every ~10 seconds of NTSC emulation */
+#define BLOCK_PROFILER_DUMP_VI   600
+
+#define MAX_HANDLERS   512
+#define MAX_PAGES      8192
+#define MAX_STACKS     32768
+#define TOP_PAGES      64
+
+#if defined(WIN32) && !defined(__MINGW32__)
+  #include <windows.h>
+  static long long int get_time(void)
+  {
+      LARGE_INTEGER counter;
+      QueryPerformanceCounter(&counter);
+      return counter.QuadPart;
+  }
+  static long long int time_to_nsec(long long int time)
+  {
+      static LARGE_INTEGER freq = { 0 };
+      if (freq.QuadPart == 0)
+          QueryPerformanceFrequency(&freq);
+      return time * 1000000000 / freq.QuadPart;
+  }
+#else
+  #include <time.h>
+  static long long int get_time(void)
+  {
+     struct timespec ts;
+     clock_gettime(CLOCK_MONOTONIC, &ts);
+     return (long long int)ts.tv_sec * 1000000000 + ts.tv_nsec;
+  }
+  static long long int time_to_nsec(long long int time)
+  {
+      return time;
+  }
+#endif
+
+enum mem_type
+{
+    MEM_NONE,
+    MEM_TLB,
+    MEM_RDRAM,
+    MEM_RDRAM_REGS,
+    MEM_RSP_MEM,
+    MEM_RSP_REGS,
+    MEM_DP,
+    MEM_MI,
+    MEM_VI,
+    MEM_AI,
+    MEM_PI,
+    MEM_RI,
+    MEM_SI,
+    MEM_DD,
+    MEM_FLASHRAM,
+    MEM_ROM,
+    MEM_PIF,
+    MEM_NOTHING,
+    NUM_MEM_TYPES
+};
+
+static const char* mem_type_names[NUM_MEM_TYPES] =
+{
+    "cpu", "tlb", "rdram", "rdram_regs", "rsp_mem", "rsp_regs", "dp", "mi",
+    "vi", "ai", "pi", "ri", "si", "dd", "flashram", "rom", "pif", "nothing"
+};
+
+struct handler_stats
+{
+    void (*ops)(void);
+    uint32_t first_pc;
+    uint64_t count;
+    long long int time;
+};
+
+struct page_stats
+{
+    uint32_t key;           /* page + 1, 0 means empty */
+    uint64_t count;
+    long long int time;
+};
+
+struct stack_stats
+{
+    uint32_t page;
+    uint16_t handler;
+    uint8_t mem_type;
+    uint8_t used;
+    long long int time;
+};
+
+static struct handler_stats handlers[MAX_HANDLERS];
+static struct page_stats pages[MAX_PAGES];
+static struct stack_stats stacks[MAX_STACKS];
+
+static uint64_t mem_count[NUM_MEM_TYPES];
+static long long int mem_time[NUM_MEM_TYPES];
+
+static uint64_t total_ops;
+static long long int total_time;
+static unsigned int dropped;
+
+/* state of the op being timed */
+static int timing;
+static unsigned int mem_depth;
+static long long int op_mem_time;
+static uint32_t cur_page;
+static unsigned int cur_handler;
+static long long int cur_weight;
+
+static unsigned int ops_until_sample = BLOCK_PROFILER_PERIOD;
+static unsigned int ops_since_sample;
+static uint32_t rng = 0x12345678;
+static unsigned int vi_count;
+
+/* xorshift, used to jitter the sampling period so that it doesn't
+ * alias with emulated loops */
+static unsigned int next_period(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return BLOCK_PROFILER_PERIOD / 2 + rng % BLOCK_PROFILER_PERIOD;
+}
+
+static unsigned int lookup_handler(void (*ops)(void), uint32_t pc)
+{
+    unsigned int i = (unsigned int)(((uintptr_t)ops >> 2) & (MAX_HANDLERS - 1));
+    unsigned int n;
+
+    for (n = 0; n < MAX_HANDLERS; ++n, i = (i + 1) & (MAX_HANDLERS - 1))
+    {
+        if (handlers[i].ops == ops)
+            return i;
+
+        if (handlers[i].ops == NULL)
+        {
+            handlers[i].ops = ops;
+            handlers[i].first_pc = pc;
+            return i;
+        }
+    }
+
+    return MAX_HANDLERS;
+}
+
+static struct page_stats* lookup_page(uint32_t page)
+{
+    unsigned int i = (page * 2654435761u) & (MAX_PAGES - 1);
+    unsigned int n;
+
+    for (n = 0; n < MAX_PAGES; ++n, i = (i + 1) & (MAX_PAGES - 1))
+    {
+        if (pages[i].key == page + 1)
+            return &pages[i];
+
+        if (pages[i].key == 0)
+        {
+            pages[i].key = page + 1;
+            return &pages[i];
+        }
+    }
+
+    return NULL;
+}
+
+static struct stack_stats* lookup_stack(uint32_t page, unsigned int handler, unsigned int mem_type)
+{
+    unsigned int i = ((page * 2654435761u) ^ (handler * 40503u) ^ mem_type) & (MAX_STACKS - 1);
+    unsigned int n;
+
+    for (n = 0; n < MAX_STACKS; ++n, i = (i + 1) & (MAX_STACKS - 1))
+    {
+        if (!stacks[i].used)
+        {
+            stacks[i].used = 1;
+            stacks[i].page = page;
+            stacks[i].handler = (uint16_t)handler;
+            stacks[i].mem_type = (uint8_t)mem_type;
+            return &stacks[i];
+        }
+
+        if (stacks[i].page == page && stacks[i].handler == handler && stacks[i].mem_type == mem_type)
+            return &stacks[i];
+    }
+
+    return NULL;
+}
+
+static void add_stack_time(uint32_t page, unsigned int handler, unsigned int mem_type, long long int time)
+{
+    struct stack_stats* s = lookup_stack(page, handler, mem_type);
+
+    if (s == NULL)
+    {
+        ++dropped;
+        return;
+    }
+
+    s->time += time;
+}
+
+static unsigned int classify_region(uint16_t region)
+{
+    uint16_t phys = region & 0x1fff;
+
+    if ((region & 0xc000) != 0x8000)
+        return MEM_TLB;
+
+    if (phys < 0x80)   return MEM_RDRAM;
+    if (phys < 0x3f0)  return MEM_NOTHING;
+    if (phys == 0x3f0) return MEM_RDRAM_REGS;
+    if (phys == 0x400) return MEM_RSP_MEM;
+    if (phys == 0x404 || phys == 0x408) return MEM_RSP_REGS;
+    if (phys == 0x410 || phys == 0x420) return MEM_DP;
+    if (phys == 0x430) return MEM_MI;
+    if (phys == 0x440) return MEM_VI;
+    if (phys == 0x450) return MEM_AI;
+    if (phys == 0x460) return MEM_PI;
+    if (phys == 0x470) return MEM_RI;
+    if (phys == 0x480) return MEM_SI;
+    if (phys >= 0x500 && phys < 0x640) return MEM_DD;
+    if (phys == 0x800 || phys == 0x801) return MEM_FLASHRAM;
+    if (phys >= 0x1000 && phys < 0x1fc0) return MEM_ROM;
+    if (phys == 0x1fc0) return MEM_PIF;
+
+    return MEM_NOTHING;
+}
+
+static void profile_access(void (**table)(void))
+{
+    uint16_t region = address >> 16;
+    unsigned int type = classify_region(region);
+    long long int start;
+
+    ++mem_count[type];
+
+    /* TLB mapped accesses call the tables again with the physical address,
+     * time is attributed to the innermost handler */
+    if (!timing || type == MEM_TLB)
+    {
+        table[region]();
+        return;
+    }
+
+    ++mem_depth;
+    start = get_time();
+    table[region]();
+    if (--mem_depth == 0)
+    {
+        long long int elapsed = get_time() - start;
+
+        op_mem_time += elapsed;
+        mem_time[type] += elapsed * cur_weight;
+        add_stack_time(cur_page, cur_handler, type, elapsed * cur_weight);
+    }
+}
+
+void block_profiler_read(void (**table)(void))
+{
+    profile_access(table);
+}
+
+void block_profiler_write(void (**table)(void))
+{
+    profile_access(table);
+}
+
+void block_profiler_run_op(void)
+{
+    uint32_t pc = PC->addr;
+    unsigned int handler = lookup_handler(PC->ops, pc);
+    struct page_stats* page = lookup_page(pc >> 12);
+    long long int start, elapsed;
+
+    ++total_ops;
+    ++ops_since_sample;
+    if (handler < MAX_HANDLERS)
+        ++handlers[handler].count;
+    if (page != NULL)
+        ++page->count;
+
+    if (--ops_until_sample != 0)
+    {
+        PC->ops();
+        return;
+    }
+
+    /* unknown handler, sample the next period instead */
+    if (handler == MAX_HANDLERS)
+    {
+        ops_until_sample = next_period();
+        PC->ops();
+        return;
+    }
+
+    timing = 1;
+    op_mem_time = 0;
+    cur_page = pc >> 12;
+    cur_handler = handler;
+    cur_weight = ops_since_sample;
+
+    start = get_time();
+    PC->ops();
+    elapsed = get_time() - start;
+
+    timing = 0;
+    ops_until_sample = next_period();
+    ops_since_sample = 0;
+
+    total_time += elapsed * cur_weight;
+    handlers[handler].time += elapsed * cur_weight;
+    if (page != NULL)
+        page->time += elapsed * cur_weight;
+    add_stack_time(cur_page, handler, MEM_NONE, (elapsed - op_mem_time) * cur_weight);
+}
+
+void block_profiler_vi(void)
+{
+    if (++vi_count % BLOCK_PROFILER_DUMP_VI == 0)
+        block_profiler_dump();
+}
+
+/* Opcode mnemonics, only used to name the handlers in the report */
+static const char* major_names[64] =
+{
+    "SPECIAL", "REGIMM", "J",    "JAL",   "BEQ",  "BNE",  "BLEZ",  "BGTZ",
+    "ADDI",    "ADDIU",  "SLTI", "SLTIU", "ANDI", "ORI",  "XORI",  "LUI",
+    "COP0",    "COP1",   "COP2", "COP3",  "BEQL", "BNEL", "BLEZL", "BGTZL",
+    "DADDI",   "DADDIU", "LDL",  "LDR",   "?",    "?",    "?",     "?",
+    "LB",      "LH",     "LWL",  "LW",    "LBU",  "LHU",  "LWR",   "LWU",
+    "SB",      "SH",     "SWL",  "SW",    "SDL",  "SDR",  "SWR",   "CACHE",
+    "LL",      "LWC1",   "LWC2", "?",     "LLD",  "LDC1", "LDC2",  "LD",
+    "SC",      "SWC1",   "SWC2", "?",     "SCD",  "SDC1", "SDC2",  "SD"
+};
+
+static const char* special_names[64] =
+{
+    "SLL",  "?",     "SRL",  "SRA",  "SLLV",    "?",    "SRLV",   "SRAV",
+    "JR",   "JALR",  "?",    "?",    "SYSCALL", "BREAK", "?",     "SYNC",
+    "MFHI", "MTHI",  "MFLO", "MTLO", "DSLLV",   "?",    "DSRLV",  "DSRAV",
+    "MULT", "MULTU", "DIV",  "DIVU", "DMULT",   "DMULTU", "DDIV", "DDIVU",
+    "ADD",  "ADDU",  "SUB",  "SUBU", "AND",     "OR",   "XOR",    "NOR",
+    "?",    "?",     "SLT",  "SLTU", "DADD",    "DADDU", "DSUB",  "DSUBU",
+    "TGE",  "TGEU",  "TLT",  "TLTU", "TEQ",     "?",    "TNE",    "?",
+    "DSLL", "?",     "DSRL", "DSRA", "DSLL32",  "?",    "DSRL32", "DSRA32"
+};
+
+static const char* regimm_names[32] =
+{
+    "BLTZ",   "BGEZ",   "BLTZL",   "BGEZL",   "?",    "?",     "?",    "?",
+    "TGEI",   "TGEIU",  "TLTI",    "TLTIU",   "TEQI", "?",     "TNEI", "?",
+    "BLTZAL", "BGEZAL", "BLTZALL", "BGEZALL", "?",    "?",     "?",    "?",
+    "?",      "?",      "?",       "?",       "?",    "?",     "?",    "?"
+};
+
+static const char* cop1_names[64] =
+{
+    "ADD",     "SUB",     "MUL",    "DIV",     "SQRT",    "ABS",     "MOV",    "NEG",
+    "ROUND.L", "TRUNC.L", "CEIL.L", "FLOOR.L", "ROUND.W", "TRUNC.W", "CEIL.W", "FLOOR.W",
+    "?",       "?",       "?",      "?",       "?",       "?",       "?",      "?",
+    "?",       "?",       "?",      "?",       "?",       "?",       "?",      "?",
+    "CVT.S",   "CVT.D",   "?",      "?",       "CVT.W",   "CVT.L",   "?",      "?",
+    "?",       "?",       "?",      "?",       "?",       "?",       "?",      "?",
+    "C.F",     "C.UN",    "C.EQ",   "C.UEQ",   "C.OLT",   "C.ULT",   "C.OLE",  "C.ULE",
+    "C.SF",    "C.NGLE",  "C.SEQ",  "C.NGL",   "C.LT",    "C.NGE",   "C.LE",   "C.NGT"
+};
+
+static void handler_name(const struct handler_stats* h, char* name, size_t len)
+{
+    const uint32_t* mem;
+    uint32_t op;
+
+    if (h->ops == current_instruction_table.FIN_BLOCK)
+    {
+        snprintf(name, len, "FIN_BLOCK");
+        return;
+    }
+    if (h->ops == current_instruction_table.NOTCOMPILED
+     || h->ops == current_instruction_table.NOTCOMPILED2)
+    {
+        snprintf(name, len, "NOTCOMPILED");
+        return;
+    }
+
+    mem = fast_mem_access(h->first_pc);
+    if (mem == NULL)
+    {
+        snprintf(name, len, "op_%p", (void*)h->ops);
+        return;
+    }
+
+    op = *mem;
+    if (op == 0)
+    {
+        snprintf(name, len, "NOP");
+        return;
+    }
+
+    switch (op >> 26)
+    {
+    case 0:
+        snprintf(name, len, "%s", special_names[op & 0x3f]);
+        break;
+    case 1:
+        snprintf(name, len, "%s", regimm_names[(op >> 16) & 0x1f]);
+        break;
+    case 16:
+        switch ((op >> 21) & 0x1f)
+        {
+        case 0:  snprintf(name, len, "MFC0"); break;
+        case 4:  snprintf(name, len, "MTC0"); break;
+        case 16:
+            switch (op & 0x3f)
+            {
+            case 1:  snprintf(name, len, "TLBR"); break;
+            case 2:  snprintf(name, len, "TLBWI"); break;
+            case 6:  snprintf(name, len, "TLBWR"); break;
+            case 8:  snprintf(name, len, "TLBP"); break;
+            case 24: snprintf(name, len, "ERET"); break;
+            default: snprintf(name, len, "COP0"); break;
+            }
+            break;
+        default: snprintf(name, len, "COP0"); break;
+        }
+        break;
+    case 17:
+        switch ((op >> 21) & 0x1f)
+        {
+        case 0:  snprintf(name, len, "MFC1"); break;
+        case 1:  snprintf(name, len, "DMFC1"); break;
+        case 2:  snprintf(name, len, "CFC1"); break;
+        case 4:  snprintf(name, len, "MTC1"); break;
+        case 5:  snprintf(name, len, "DMTC1"); break;
+        case 6:  snprintf(name, len, "CTC1"); break;
+        case 8:
+        {
+            static const char* bc1[4] = { "BC1F", "BC1T", "BC1FL", "BC1TL" };
+            snprintf(name, len, "%s", bc1[(op >> 16) & 3]);
+            break;
+        }
+        case 16: snprintf(name, len, "%s.S", cop1_names[op & 0x3f]); break;
+        case 17: snprintf(name, len, "%s.D", cop1_names[op & 0x3f]); break;
+        case 20: snprintf(name, len, "%s.W", cop1_names[op & 0x3f]); break;
+        case 21: snprintf(name, len, "%s.L", cop1_names[op & 0x3f]); break;
+        default: snprintf(name, len, "COP1"); break;
+        }
+        break;
+    default:
+        snprintf(name, len, "%s", major_names[op >> 26]);
+        break;
+    }
+}
+
+static int compare_pages(const void* a, const void* b)
+{
+    const struct page_stats* pa = *(const struct page_stats* const*)a;
+    const struct page_stats* pb = *(const struct page_stats* const*)b;
+
+    if (pa->time != pb->time)
+        return pa->time < pb->time ? 1 : -1;
+    return pa->count < pb->count ? 1 : (pa->count > pb->count ? -1 : 0);
+}
+
+static int compare_handlers(const void* a, const void* b)
+{
+    const struct handler_stats* ha = *(const struct handler_stats* const*)a;
+    const struct handler_stats* hb = *(const struct handler_stats* const*)b;
+
+    if (ha->time != hb->time)
+        return ha->time < hb->time ? 1 : -1;
+    return ha->count < hb->count ? 1 : (ha->count > hb->count ? -1 : 0);
+}
+
+static double percent(long long int part, long long int total)
+{
+    return total != 0 ? 100.0 * (double)part / (double)total : 0.0;
+}
+
+static void dump_flat(FILE* f)
+{
+    static struct page_stats* sorted_pages[MAX_PAGES];
+    static struct handler_stats* sorted_handlers[MAX_HANDLERS];
+    size_t page_count = 0;
+    size_t handler_count = 0;
+    size_t i;
+    char name[32];
+
+    for (i = 0; i < MAX_PAGES; ++i)
+        if (pages[i].key != 0)
+            sorted_pages[page_count++] = &pages[i];
+    for (i = 0; i < MAX_HANDLERS; ++i)
+        if (handlers[i].ops != NULL)
+            sorted_handlers[handler_count++] = &handlers[i];
+
+    qsort(sorted_pages, page_count, sizeof(sorted_pages[0]), compare_pages);
+    qsort(sorted_handlers, handler_count, sizeof(sorted_handlers[0]), compare_handlers);
+
+    fprintf(f, "r4300 profile: %llu ops, %.3f ms sampled host time, %u dropped samples\n\n",
+            (unsigned long long)total_ops, (double)time_to_nsec(total_time) / 1000000.0, dropped);
+
+    fprintf(f, "Hot blocks (top %d)\n", TOP_PAGES);
+    fprintf(f, "%-10s %14s %7s %12s %7s\n", "block", "ops", "ops%", "time(ms)", "time%");
+    for (i = 0; i < page_count && i < TOP_PAGES; ++i)
+    {
+        const struct page_stats* p = sorted_pages[i];
+        fprintf(f, "%08x   %14llu %6.2f%% %12.3f %6.2f%%\n",
+                (p->key - 1) << 12, (unsigned long long)p->count,
+                percent((long long int)p->count, (long long int)total_ops),
+                (double)time_to_nsec(p->time) / 1000000.0, percent(p->time, total_time));
+    }
+
+    fprintf(f, "\nOp handlers\n");
+    fprintf(f, "%-10s %14s %7s %12s %7s\n", "handler", "count", "count%", "time(ms)", "time%");
+    for (i = 0; i < handler_count; ++i)
+    {
+        const struct handler_stats* h = sorted_handlers[i];
+        handler_name(h, name, sizeof(name));
+        fprintf(f, "%-10s %14llu %6.2f%% %12.3f %6.2f%%\n",
+                name, (unsigned long long)h->count,
+                percent((long long int)h->count, (long long int)total_ops),
+                (double)time_to_nsec(h->time) / 1000000.0, percent(h->time, total_time));
+    }
+
+    fprintf(f, "\nMemory handlers\n");
+    fprintf(f, "%-10s %14s %12s %7s\n", "type", "accesses", "time(ms)", "time%");
+    for (i = MEM_TLB; i < NUM_MEM_TYPES; ++i)
+    {
+        if (mem_count[i] == 0)
+            continue;
+        fprintf(f, "%-10s %14llu %12.3f %6.2f%%\n",
+                mem_type_names[i], (unsigned long long)mem_count[i],
+                (double)time_to_nsec(mem_time[i]) / 1000000.0, percent(mem_time[i], total_time));
+    }
+}
+
+static void dump_folded(FILE* f)
+{
+    size_t i;
+    char name[32];
+
+    for (i = 0; i < MAX_STACKS; ++i)
+    {
+        const struct stack_stats* s = &stacks[i];
+        long long int usec;
+
+        if (!s->used)
+            continue;
+
+        usec = time_to_nsec(s->time) / 1000;
+        if (usec <= 0)
+            continue;
+
+        handler_name(&handlers[s->handler], name, sizeof(name));
+        if (s->mem_type == MEM_NONE)
+            fprintf(f, "r4300;%08x;%s %lld\n", s->page << 12, name, usec);
+        else
+            fprintf(f, "r4300;%08x;%s;%s %lld\n", s->page << 12, name, mem_type_names[s->mem_type], usec);
+    }
+}
+
+void block_profiler_dump(void)
+{
+    FILE* f;
+
+    f = fopen("r4300_profile.txt", "w");
+    if (f != NULL)
+    {
+        dump_flat(f);
+        fclose(f);
+    }
+
+    f = fopen("r4300_profile.folded", "w");
+    if (f != NULL)
+    {
+        dump_folded(f);
+        fclose(f);
+    }
+
+    DebugMessage(M64MSG_INFO, "r4300 profile written: %llu ops, %.3f ms sampled",
+            (unsigned long long)total_ops, (double)time_to_nsec(total_time) / 1000000.0);
+}
+
+#endif /* BLOCK_PROFILER */
@@ -0,0 +1,59 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - block_profiler.h                                        *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef M64P_R4300_BLOCK_PROFILER_H
+#define M64P_R4300_BLOCK_PROFILER_H
+
+/* Hot block / hot instruction profiler for the cached interpreter.
+ *
+ * Built with BLOCK_PROFILER, every op executed by the cached interpreter is
+ * counted per precomp_block (4KB page) and per op handler, and every memory
+ * access per handler type. One op out of roughly BLOCK_PROFILER_PERIOD is
+ * timed on the host (including the memory handlers it calls) and weighted
+ * by the number of ops since the previous sample.
+ *
+ * The results are written every BLOCK_PROFILER_DUMP_VI vertical interrupts
+ * to r4300_profile.txt (flat profile) and r4300_profile.folded (collapsed
+ * stacks for flamegraph.pl, in microseconds).
+ *
+ * Without BLOCK_PROFILER all hooks compile to nothing.
+ */
+#if defined(BLOCK_PROFILER) && defined(LOCKSTEP)
+#error "BLOCK_PROFILER and LOCKSTEP both replace the interpreter loop, enable only one"
+#endif
+
+#if defined(BLOCK_PROFILER)
+
+/* Replaces PC->ops() in the cached interpreter loop. */
+void block_profiler_run_op(void);
+
+/* Memory access hooks, see memory/memory.h */
+void block_profiler_read(void (**table)(void));
+void block_profiler_write(void (**table)(void));
+
+void block_profiler_vi(void);
+void block_profiler_dump(void);
+
+#else
+  #define block_profiler_vi()
+  #define block_profiler_dump()
+#endif
+
+#endif /* M64P_R4300_BLOCK_PROFILER_H */
@@ -57,6 +57,9 @@ char invalid_code[0x100000];
 struct precomp_block *blocks[0x100000];
 struct precomp_block *actual           = NULL;
 uint32_t jump_to_address;
+uint32_t code_pages[CODE_PAGES_COUNT / 32];
+struct code_invalidation_stats code_invalidation_frame;
+struct code_invalidation_stats code_invalidation_last_frame;
 
 // -----------------------------------------------------------
 // Cached interpreter functions (and fallback for dynarec).
@@ -150,10 +153,13 @@ uint32_t jump_to_address;
    }
 
 #define CHECK_MEMORY() \
-   if (!invalid_code[address>>12]) \
+   if (is_code_page(address) && !invalid_code[address>>12]) \
       if (blocks[address>>12]->block[(address&0xFFF)/4].ops != \
           current_instruction_table.NOTCOMPILED) \
-         invalid_code[address>>12] = 1;
+      { \
+         invalid_code[address>>12] = 1; \
+         ++code_invalidation_frame.invalidations; \
+      }
 
 // two functions are defined from the macros above but never used
 // these prototype declarations will prevent a warning
@@ -560,6 +566,8 @@ void jump_to_func(void)
          blocks[addr>>12]->jumps_table = NULL;
          blocks[addr>>12]->riprel_table = NULL;
       }
+      else if (blocks[addr>>12]->block)
+         ++code_invalidation_frame.smc_recompiles;
       blocks[addr>>12]->start = addr & ~0xFFF;
       blocks[addr>>12]->end = (addr & ~0xFFF) + 0x1000;
       init_block(blocks[addr>>12]);
@@ -578,6 +586,7 @@ void init_blocks(void)
       invalid_code[i] = 1;
       blocks[i] = NULL;
    }
+   memset(code_pages, 0, sizeof(code_pages));
 }
 
 void free_blocks(void)
@@ -594,44 +603,95 @@ void free_blocks(void)
    }
 }
 
-void invalidate_cached_code_hacktarux(uint32_t address, size_t size)
+static void invalidate_range(uint32_t address, uint32_t addr_max)
 {
    size_t i;
    uint32_t addr;
+
+   for(addr = address; addr < addr_max; addr += 4)
+   {
+      i = (addr >> 12);
+
+      if (invalid_code[i] == 0)
+      {
+         if (blocks[i] == NULL
+               || blocks[i]->block[(addr & 0xfff) / 4].ops != current_instruction_table.NOTCOMPILED)
+         {
+            invalid_code[i] = 1;
+            ++code_invalidation_frame.invalidations;
+            /* go directly to next i */
+            addr &= ~0xfff;
+            addr |= 0xffc;
+         }
+      }
+      else
+      {
+         /* go directly to next i */
+         addr &= ~0xfff;
+         addr |= 0xffc;
+      }
+   }
+}
+
+void invalidate_cached_code_hacktarux(uint32_t address, size_t size)
+{
    uint32_t addr_max;
 
    if (size == 0)
    {
       /* invalidate everthing */
       memset(invalid_code, 1, 0x100000);
+      memset(code_pages, 0, sizeof(code_pages));
+      return;
    }
-   else
+
+   addr_max = address+size;
+
+   if (IS_RDRAM_KSEG_ADDR(address) && IS_RDRAM_KSEG_ADDR(addr_max - 1)
+         && (address & UINT32_C(0xe0000000)) == ((addr_max - 1) & UINT32_C(0xe0000000)))
    {
-      /* invalidate blocks (if necessary) */
-      addr_max = address+size;
+      /* only visit the pages holding compiled code */
+      uint32_t base = address & ~UINT32_C(0x7fffff);
+      uint32_t page;
+      uint32_t last_page = CODE_PAGE(addr_max - 1);
 
-      for(addr = address; addr < addr_max; addr += 4)
+      for (page = CODE_PAGE(address); page <= last_page; ++page)
       {
-         i = (addr >> 12);
+         uint32_t page_start, page_end;
 
-         if (invalid_code[i] == 0)
-         {
-            if (blocks[i] == NULL
-                  || blocks[i]->block[(addr & 0xfff) / 4].ops != current_instruction_table.NOTCOMPILED)
-            {
-               invalid_code[i] = 1;
-               /* go directly to next i */
-               addr &= ~0xfff;
-               addr |= 0xffc;
-            }
-         }
-         else
+         if (code_pages[page >> 5] == 0)
          {
-            /* go directly to next i */
-            addr &= ~0xfff;
-            addr |= 0xffc;
+            page |= 31;
+            continue;
          }
+
+         if (!(code_pages[page >> 5] & (UINT32_C(1) << (page & 31))))
+            continue;
+
+         page_start = base | (page << 12);
+         page_end = page_start + 0x1000;
+
+         invalidate_range(page_start < address ? address : page_start,
+               page_end > addr_max ? addr_max : page_end);
+
+         /* stop watching once neither mapping holds valid code */
+         if (invalid_code[((page << 12) | UINT32_C(0x80000000)) >> 12]
+               && invalid_code[((page << 12) | UINT32_C(0xa0000000)) >> 12])
+            code_pages[page >> 5] &= ~(UINT32_C(1) << (page & 31));
       }
    }
+   else
+      invalidate_range(address, addr_max);
 }
 
+void code_invalidation_end_frame(void)
+{
+   code_invalidation_last_frame = code_invalidation_frame;
+   memset(&code_invalidation_frame, 0, sizeof(code_invalidation_frame));
+
+#ifdef CORE_DBG
+   if (code_invalidation_last_frame.invalidations || code_invalidation_last_frame.smc_recompiles)
+      DebugMessage(M64MSG_VERBOSE, "code invalidation: %u pages invalidated, %u recompiled",
+            code_invalidation_last_frame.invalidations, code_invalidation_last_frame.smc_recompiles);
+#endif
+}
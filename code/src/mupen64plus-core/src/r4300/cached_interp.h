@@ -35,6 +35,41 @@ extern struct precomp_block *actual;
 extern uint32_t jump_to_address;
 extern const cpu_instruction_table cached_interpreter_table;
 
+/* Write-watch bitmap: one bit per 4KB page of RDRAM which may hold
+ * compiled code through its KSEG0 or KSEG1 mapping. Stores and DMA to
+ * pages without their bit set never need to invalidate anything. */
+#define CODE_PAGES_COUNT (0x800000 >> 12)
+extern uint32_t code_pages[CODE_PAGES_COUNT / 32];
+
+#define IS_RDRAM_KSEG_ADDR(a) \
+   (((a) & UINT32_C(0xc0000000)) == UINT32_C(0x80000000) && ((a) & UINT32_C(0x1fffffff)) < 0x800000)
+#define CODE_PAGE(a) (((a) & UINT32_C(0x7fffff)) >> 12)
+
+static INLINE void mark_code_page(uint32_t address)
+{
+   if (IS_RDRAM_KSEG_ADDR(address))
+      code_pages[CODE_PAGE(address) >> 5] |= UINT32_C(1) << (CODE_PAGE(address) & 31);
+}
+
+/* Returns 0 only if address is known not to hold compiled code */
+static INLINE int is_code_page(uint32_t address)
+{
+   if (!IS_RDRAM_KSEG_ADDR(address))
+      return 1;
+   return (code_pages[CODE_PAGE(address) >> 5] >> (CODE_PAGE(address) & 31)) & 1;
+}
+
+struct code_invalidation_stats
+{
+   unsigned int invalidations;   /* pages of compiled code invalidated */
+   unsigned int smc_recompiles;  /* already compiled pages compiled again */
+};
+
+extern struct code_invalidation_stats code_invalidation_frame;
+extern struct code_invalidation_stats code_invalidation_last_frame;
+
+void code_invalidation_end_frame(void);
+
 void init_blocks(void);
 void free_blocks(void);
 void jump_to_func(void);
@@ -0,0 +1,581 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - lockstep.c                                              *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#if defined(LOCKSTEP)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "api/callbacks.h"
+#include "api/m64p_types.h"
+#include "cp0_private.h"
+#include "cp1_private.h"
+#include "interrupt.h"
+#include "lockstep.h"
+#include "main/device.h"
+#include "main/main.h"
+#include "memory/memory.h"
+#include "pure_interp.h"
+#include "r4300.h"
+#include "tlb.h"
+
+/* maximum number of cached interpreter ops checked as a single block */
+#define LOCKSTEP_MAX_OPS       256
+#define LOCKSTEP_MAX_READS     1024
+#define LOCKSTEP_MAX_UNDO      8192
+#define LOCKSTEP_MAX_PAGES     64
+#define LOCKSTEP_QUEUE_SIZE    1024
+/* print a summary every 2^20 blocks */
+#define LOCKSTEP_REPORT_MASK   0xfffff
+
+enum lockstep_mode
+{
+    LOCKSTEP_OFF,
+    LOCKSTEP_RECORD,
+    LOCKSTEP_REPLAY
+};
+
+struct lockstep_cpu_state
+{
+    int64_t reg[32];
+    int64_t hi, lo;
+    uint32_t pc;
+    unsigned int llbit;
+    uint32_t cp0[CP0_REGS_COUNT];
+    int64_t fgr[32];
+    uint32_t fcr0, fcr31;
+    unsigned int delay_slot;
+    uint32_t skip_jump;
+    uint32_t last_addr;
+    uint32_t next_interrupt;
+};
+
+struct lockstep_read_entry
+{
+    uint32_t address;
+    unsigned int size;
+    uint64_t value;
+};
+
+struct lockstep_undo_entry
+{
+    uint32_t index;
+    uint32_t old;
+};
+
+struct lockstep_write_entry
+{
+    uint32_t index;
+    uint32_t value;
+};
+
+static struct
+{
+    enum lockstep_mode mode;
+
+    /* set in RECORD mode when the block cannot be replayed */
+    int unverifiable;
+    /* set in REPLAY mode when the device accesses don't match the recording */
+    int access_mismatch;
+
+    struct lockstep_read_entry reads[LOCKSTEP_MAX_READS];
+    size_t read_count;
+    size_t read_pos;
+
+    struct lockstep_undo_entry undo[LOCKSTEP_MAX_UNDO];
+    size_t undo_count;
+
+    unsigned int blocks_verified;
+    unsigned int blocks_skipped;
+    unsigned int divergences;
+} ls;
+
+/* scratch buffers used while locating a divergence */
+static struct lockstep_write_entry cand_writes[LOCKSTEP_MAX_UNDO];
+static struct lockstep_write_entry ref_writes[LOCKSTEP_MAX_UNDO];
+
+/* physical RDRAM (KSEG0/KSEG1) */
+static int is_rdram_region(uint16_t region)
+{
+    return (region & 0xc000) == 0x8000 && (region & 0x1fff) < 0x80;
+}
+
+/* everything else in KSEG0/KSEG1: registers, PIF, cartridge...
+ * TLB mapped regions go through read_nomem/write_nomem which call
+ * the memory tables again with the physical address. */
+static int is_device_region(uint16_t region)
+{
+    return (region & 0xc000) == 0x8000 && (region & 0x1fff) >= 0x80;
+}
+
+static void push_undo(uint32_t index)
+{
+    if (index >= g_dev.ri.rdram.dram_size / 4)
+        return;
+
+    if (ls.undo_count == LOCKSTEP_MAX_UNDO)
+    {
+        ls.unverifiable = 1;
+        return;
+    }
+
+    ls.undo[ls.undo_count].index = index;
+    ls.undo[ls.undo_count].old = g_dev.ri.rdram.dram[index];
+    ++ls.undo_count;
+}
+
+static void rollback_rdram(size_t mark)
+{
+    while (ls.undo_count > mark)
+    {
+        --ls.undo_count;
+        g_dev.ri.rdram.dram[ls.undo[ls.undo_count].index] = ls.undo[ls.undo_count].old;
+    }
+}
+
+static size_t collect_writes(size_t mark, struct lockstep_write_entry* writes)
+{
+    size_t i;
+
+    for (i = mark; i < ls.undo_count; ++i)
+    {
+        writes[i - mark].index = ls.undo[i].index;
+        writes[i - mark].value = g_dev.ri.rdram.dram[ls.undo[i].index];
+    }
+
+    return ls.undo_count - mark;
+}
+
+static uint32_t hash_page(uint32_t page)
+{
+    const uint32_t* words = g_dev.ri.rdram.dram + (page << 10);
+    uint32_t h = UINT32_C(2166136261) ^ page;
+    size_t i;
+
+    for (i = 0; i < 1024; ++i)
+        h = (h ^ words[i]) * UINT32_C(16777619);
+
+    return h;
+}
+
+/* Order independent hash of the RDRAM pages written since mark. */
+static uint32_t hash_written_pages(size_t mark)
+{
+    uint32_t pages[LOCKSTEP_MAX_PAGES];
+    size_t page_count = 0;
+    uint32_t h = 0;
+    size_t i, j;
+
+    for (i = mark; i < ls.undo_count; ++i)
+    {
+        uint32_t page = ls.undo[i].index >> 10;
+
+        for (j = 0; j < page_count && pages[j] != page; ++j);
+
+        if (j == page_count && page_count < LOCKSTEP_MAX_PAGES)
+            pages[page_count++] = page;
+    }
+
+    for (j = 0; j < page_count; ++j)
+        h += hash_page(pages[j]);
+
+    return h;
+}
+
+static void save_cpu_state(struct lockstep_cpu_state* s)
+{
+    memcpy(s->reg, reg, sizeof(s->reg));
+    s->hi = hi;
+    s->lo = lo;
+    s->pc = PC->addr;
+    s->llbit = llbit;
+    memcpy(s->cp0, g_cp0_regs, sizeof(s->cp0));
+    memcpy(s->fgr, reg_cop1_fgr_64, sizeof(s->fgr));
+    s->fcr0 = FCR0;
+    s->fcr31 = FCR31;
+    s->delay_slot = g_dev.r4300.delay_slot;
+    s->skip_jump = skip_jump;
+    s->last_addr = last_addr;
+    s->next_interrupt = next_interrupt;
+}
+
+/* Restores everything but the PC, which is core specific. */
+static void load_cpu_state(const struct lockstep_cpu_state* s)
+{
+    memcpy(reg, s->reg, sizeof(s->reg));
+    hi = s->hi;
+    lo = s->lo;
+    llbit = s->llbit;
+    memcpy(g_cp0_regs, s->cp0, sizeof(s->cp0));
+    memcpy(reg_cop1_fgr_64, s->fgr, sizeof(s->fgr));
+    FCR0 = s->fcr0;
+    FCR31 = s->fcr31;
+    g_dev.r4300.delay_slot = s->delay_slot;
+    skip_jump = s->skip_jump;
+    last_addr = s->last_addr;
+    next_interrupt = s->next_interrupt;
+
+    set_fpr_pointers(g_cp0_regs[CP0_STATUS_REG]);
+    update_x86_rounding_mode(FCR31);
+}
+
+/* Returns 0 if both states match, otherwise describes the first mismatch. */
+static int diff_cpu_state(const struct lockstep_cpu_state* a,
+        const struct lockstep_cpu_state* b, char* what, size_t len)
+{
+    unsigned int i;
+
+#define LOCKSTEP_DIFF(name, x, y) \
+    if ((x) != (y)) \
+    { \
+        snprintf(what, len, "%s: cached=%016llx pure=%016llx", name, \
+                (unsigned long long)(x), (unsigned long long)(y)); \
+        return 1; \
+    }
+
+    LOCKSTEP_DIFF("pc", a->pc, b->pc);
+    for (i = 0; i < 32; ++i)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "r%u", i);
+        LOCKSTEP_DIFF(name, a->reg[i], b->reg[i]);
+    }
+    LOCKSTEP_DIFF("hi", a->hi, b->hi);
+    LOCKSTEP_DIFF("lo", a->lo, b->lo);
+    LOCKSTEP_DIFF("llbit", a->llbit, b->llbit);
+    for (i = 0; i < CP0_REGS_COUNT; ++i)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "cp0[%u]", i);
+        LOCKSTEP_DIFF(name, a->cp0[i], b->cp0[i]);
+    }
+    for (i = 0; i < 32; ++i)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), "fgr%u", i);
+        LOCKSTEP_DIFF(name, a->fgr[i], b->fgr[i]);
+    }
+    LOCKSTEP_DIFF("fcr31", a->fcr31, b->fcr31);
+    LOCKSTEP_DIFF("delay_slot", a->delay_slot, b->delay_slot);
+    LOCKSTEP_DIFF("skip_jump", a->skip_jump, b->skip_jump);
+    LOCKSTEP_DIFF("last_addr", a->last_addr, b->last_addr);
+
+#undef LOCKSTEP_DIFF
+
+    return 0;
+}
+
+static int diff_writes(const struct lockstep_write_entry* a, size_t a_count,
+        const struct lockstep_write_entry* b, size_t b_count, char* what, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < a_count && i < b_count; ++i)
+    {
+        if (a[i].index != b[i].index || a[i].value != b[i].value)
+        {
+            snprintf(what, len, "rdram write %u: cached=[%08x]=%08x pure=[%08x]=%08x",
+                    (unsigned int)i, a[i].index << 2, a[i].value, b[i].index << 2, b[i].value);
+            return 1;
+        }
+    }
+
+    if (a_count != b_count)
+    {
+        snprintf(what, len, "rdram write count: cached=%u pure=%u",
+                (unsigned int)a_count, (unsigned int)b_count);
+        return 1;
+    }
+
+    return 0;
+}
+
+static void run_pure_op(const struct lockstep_cpu_state* s)
+{
+    load_cpu_state(s);
+    r4300emu = CORE_PURE_INTERPRETER;
+    PC = pure_interpreter_pc();
+    PC->addr = s->pc;
+    pure_interpreter_step();
+    r4300emu = CORE_INTERPRETER;
+}
+
+static void report_divergence(uint32_t block_addr, unsigned int op_index,
+        uint32_t pc, const char* what)
+{
+    uint32_t* op = fast_mem_access(pc);
+
+    DebugMessage(M64MSG_ERROR,
+            "lockstep: divergence in block %08x op %u at %08x (opcode %08x): %s",
+            block_addr, op_index, pc, op != NULL ? *op : 0, what);
+}
+
+/* Re-runs the block one op at a time on both cores (replaying device reads)
+ * and reports the first op whose results differ. Leaves the machine in the
+ * state the cached interpreter produced so that execution carries on as it
+ * would without LOCKSTEP. */
+static void locate_divergence(const struct lockstep_cpu_state* start,
+        struct precomp_instr* start_pc, unsigned int op_count)
+{
+    struct lockstep_cpu_state current = *start;
+    struct lockstep_cpu_state cand, ref;
+    struct precomp_instr* cand_pc = start_pc;
+    size_t cand_read_pos = 0;
+    size_t ref_read_pos = 0;
+    int found = 0;
+    unsigned int i;
+    char what[128];
+
+    rollback_rdram(0);
+    ls.mode = LOCKSTEP_REPLAY;
+
+    for (i = 0; i < op_count; ++i)
+    {
+        size_t mark = ls.undo_count;
+        size_t cand_count, ref_count;
+
+        load_cpu_state(&current);
+        PC = cand_pc;
+        ls.read_pos = cand_read_pos;
+        ls.access_mismatch = 0;
+        PC->ops();
+        save_cpu_state(&cand);
+        cand_pc = PC;
+        cand_read_pos = ls.read_pos;
+
+        if (!found)
+        {
+            cand_count = collect_writes(mark, cand_writes);
+            rollback_rdram(mark);
+
+            ls.read_pos = ref_read_pos;
+            run_pure_op(&current);
+            save_cpu_state(&ref);
+            ref_read_pos = ls.read_pos;
+            ref_count = collect_writes(mark, ref_writes);
+
+            if (ls.access_mismatch)
+            {
+                snprintf(what, sizeof(what), "device access sequence");
+                found = 1;
+            }
+            else if (diff_cpu_state(&cand, &ref, what, sizeof(what))
+                  || diff_writes(cand_writes, cand_count, ref_writes, ref_count, what, sizeof(what)))
+                found = 1;
+
+            if (found)
+            {
+                size_t j;
+
+                report_divergence(start->pc, i, current.pc, what);
+
+                /* put back the cached interpreter writes */
+                rollback_rdram(mark);
+                for (j = 0; j < cand_count; ++j)
+                {
+                    push_undo(cand_writes[j].index);
+                    g_dev.ri.rdram.dram[cand_writes[j].index] = cand_writes[j].value;
+                }
+            }
+        }
+
+        current = cand;
+    }
+
+    if (!found)
+        report_divergence(start->pc, op_count, current.pc,
+                "block results differ but no single op diverged");
+
+    ls.mode = LOCKSTEP_OFF;
+    load_cpu_state(&current);
+    PC = cand_pc;
+}
+
+void lockstep_read(void (**table)(void), unsigned int size)
+{
+    uint16_t region = address >> 16;
+
+    if (ls.mode == LOCKSTEP_OFF || !is_device_region(region))
+    {
+        table[region]();
+        return;
+    }
+
+    if (ls.mode == LOCKSTEP_RECORD)
+    {
+        uint32_t addr = address;
+
+        table[region]();
+
+        if (ls.read_count == LOCKSTEP_MAX_READS)
+        {
+            ls.unverifiable = 1;
+            return;
+        }
+
+        ls.reads[ls.read_count].address = addr;
+        ls.reads[ls.read_count].size = size;
+        ls.reads[ls.read_count].value = *rdword;
+        ++ls.read_count;
+    }
+    else if (ls.read_pos < ls.read_count
+          && ls.reads[ls.read_pos].address == address
+          && ls.reads[ls.read_pos].size == size)
+    {
+        *rdword = ls.reads[ls.read_pos].value;
+        ++ls.read_pos;
+    }
+    else
+    {
+        ls.access_mismatch = 1;
+        *rdword = 0;
+    }
+}
+
+void lockstep_write(void (**table)(void), unsigned int size)
+{
+    uint16_t region = address >> 16;
+
+    if (ls.mode != LOCKSTEP_OFF)
+    {
+        if (is_rdram_region(region))
+        {
+            uint32_t index = (address & 0xffffff) >> 2;
+
+            push_undo(index);
+            if (size == 8)
+                push_undo(index + 1);
+        }
+        else if (is_device_region(region))
+        {
+            /* device writes have side effects we cannot roll back */
+            if (ls.mode == LOCKSTEP_RECORD)
+                ls.unverifiable = 1;
+            else
+            {
+                ls.access_mismatch = 1;
+                return;
+            }
+        }
+    }
+
+    table[region]();
+}
+
+void lockstep_run_block(void)
+{
+    static char queue_before[LOCKSTEP_QUEUE_SIZE];
+    static char queue_after[LOCKSTEP_QUEUE_SIZE];
+    static tlb tlb_before[32];
+    struct lockstep_cpu_state start, cand, ref;
+    struct precomp_instr* start_pc = PC;
+    struct precomp_instr* cand_pc;
+    uint32_t block_last_addr = last_addr;
+    unsigned int op_count = 0;
+    unsigned int i;
+    int queue_len;
+    uint32_t cand_hash, ref_hash;
+    char what[128];
+
+    if (r4300emu != CORE_INTERPRETER)
+    {
+        PC->ops();
+        return;
+    }
+
+    save_cpu_state(&start);
+    queue_len = save_eventqueue_infos(queue_before);
+    memcpy(tlb_before, tlb_e, sizeof(tlb_before));
+
+    ls.mode = LOCKSTEP_RECORD;
+    ls.unverifiable = 0;
+    ls.read_count = 0;
+    ls.undo_count = 0;
+
+    /* run the cached interpreter up to the next jump */
+    do
+    {
+        PC->ops();
+        ++op_count;
+
+        /* an interrupt was serviced or scheduled */
+        if (save_eventqueue_infos(queue_after) != queue_len
+         || memcmp(queue_before, queue_after, queue_len) != 0)
+            ls.unverifiable = 1;
+    } while (!ls.unverifiable && !stop
+          && last_addr == block_last_addr
+          && op_count < LOCKSTEP_MAX_OPS);
+
+    ls.mode = LOCKSTEP_OFF;
+
+    if (ls.unverifiable || memcmp(tlb_before, tlb_e, sizeof(tlb_before)) != 0)
+    {
+        ++ls.blocks_skipped;
+        return;
+    }
+
+    save_cpu_state(&cand);
+    cand_pc = PC;
+    cand_hash = hash_written_pages(0);
+
+    /* rerun it on the pure interpreter from the same state */
+    rollback_rdram(0);
+    ls.mode = LOCKSTEP_REPLAY;
+    ls.read_pos = 0;
+    ls.access_mismatch = 0;
+
+    load_cpu_state(&start);
+    r4300emu = CORE_PURE_INTERPRETER;
+    PC = pure_interpreter_pc();
+    PC->addr = start.pc;
+    for (i = 0; i < op_count && !ls.access_mismatch; ++i)
+        pure_interpreter_step();
+    r4300emu = CORE_INTERPRETER;
+
+    ls.mode = LOCKSTEP_OFF;
+    save_cpu_state(&ref);
+    ref_hash = hash_written_pages(0);
+
+    if (!ls.access_mismatch
+     && ls.read_pos == ls.read_count
+     && cand_hash == ref_hash
+     && !diff_cpu_state(&cand, &ref, what, sizeof(what)))
+    {
+        ++ls.blocks_verified;
+        if ((ls.blocks_verified & LOCKSTEP_REPORT_MASK) == 0)
+            lockstep_print_stats();
+
+        load_cpu_state(&cand);
+        PC = cand_pc;
+        return;
+    }
+
+    ++ls.divergences;
+    locate_divergence(&start, start_pc, op_count);
+}
+
+void lockstep_print_stats(void)
+{
+    DebugMessage(M64MSG_INFO, "lockstep: %u blocks verified, %u skipped, %u divergences",
+            ls.blocks_verified, ls.blocks_skipped, ls.divergences);
+}
+
+#endif /* LOCKSTEP */
@@ -0,0 +1,50 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ *   Mupen64plus - lockstep.h                                              *
+ *   Mupen64Plus homepage: http://code.google.com/p/mupen64plus/           *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.          *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef M64P_R4300_LOCKSTEP_H
+#define M64P_R4300_LOCKSTEP_H
+
+/* Differential checker between the cached interpreter and the pure
+ * interpreter.
+ *
+ * When built with LOCKSTEP, every block executed by the cached interpreter
+ * is recorded (device reads, RDRAM undo log), rolled back and executed again
+ * by the pure interpreter with device reads replayed from the recording.
+ * GPRs, HI/LO, CP0, CP1 and a hash of the written RDRAM pages are compared
+ * at the block boundary; on mismatch the block is re-run one instruction at
+ * a time to report the first divergent instruction.
+ *
+ * Blocks which write to devices, change the TLB or service an interrupt
+ * cannot be replayed safely and are only counted as skipped.
+ */
+#if defined(LOCKSTEP)
+
+/* Replaces PC->ops() in the cached interpreter loop. */
+void lockstep_run_block(void);
+
+/* Memory access hooks, see memory/memory.h */
+void lockstep_read(void (**table)(void), unsigned int size);
+void lockstep_write(void (**table)(void), unsigned int size);
+
+void lockstep_print_stats(void);
+
+#endif /* LOCKSTEP */
+
+#endif /* M64P_R4300_LOCKSTEP_H */
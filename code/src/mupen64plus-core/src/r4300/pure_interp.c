@@ -746,3 +746,13 @@ void pure_interpreter(void)
      InterpretOpcode();
    }
 }
+
+struct precomp_instr *pure_interpreter_pc(void)
+{
+   return &interp_PC;
+}
+
+void pure_interpreter_step(void)
+{
+   InterpretOpcode();
+}
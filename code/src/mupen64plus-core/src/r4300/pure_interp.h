@@ -22,7 +22,14 @@
 #ifndef M64P_R4300_PURE_INTERP_H
 #define M64P_R4300_PURE_INTERP_H
 
+struct precomp_instr;
+
 void pure_interpreter_init(void);
 void pure_interpreter(void);
 
+/* Single stepping, used by the lockstep checker to run this core
+ * as the reference implementation. */
+struct precomp_instr *pure_interpreter_pc(void);
+void pure_interpreter_step(void);
+
 #endif /* M64P_R4300_PURE_INTERP_H */
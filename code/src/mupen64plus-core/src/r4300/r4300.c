@@ -26,10 +26,12 @@
 #include "api/callbacks.h"
 #include "api/debugger.h"
 #include "api/m64p_types.h"
+#include "block_profiler.h"
 #include "cached_interp.h"
 #include "cp0_private.h"
 #include "cp1_private.h"
 #include "interrupt.h"
+#include "lockstep.h"
 #include "main/main.h"
 #include "main/device.h"
 #include "main/rom.h"
@@ -180,7 +182,13 @@ void r4300_step(void)
    
    while (keepgoing == 1)
    {
+#if defined(LOCKSTEP)
+      lockstep_run_block();
+#elif defined(BLOCK_PROFILER)
+      block_profiler_run_op();
+#else
       PC->ops();
+#endif
 
       if (firstCheckPassed == 0 && retro_stop_stepping())
           firstCheckPassed = 1;
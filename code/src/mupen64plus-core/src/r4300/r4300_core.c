@@ -140,3 +140,16 @@ void savestates_load_set_pc(uint32_t pc)
         invalidate_r4300_cached_code(0,0);
     }
 }
+
+void savestates_rollback_set_pc(uint32_t pc)
+{
+#ifdef NEW_DYNAREC
+    if (r4300emu == CORE_DYNAREC)
+    {
+        pcaddr = pc;
+        pending_exception = 1;
+    }
+    else
+#endif
+        generic_jump_to(pc);
+}
@@ -90,5 +90,8 @@ void invalidate_r4300_cached_code(uint32_t address, size_t size);
 void generic_jump_to(uint32_t address);
 
 void savestates_load_set_pc(uint32_t pc);
+/* Same as savestates_load_set_pc() without flushing the cached code,
+ * the caller invalidated what the state changed. */
+void savestates_rollback_set_pc(uint32_t pc);
 
 #endif
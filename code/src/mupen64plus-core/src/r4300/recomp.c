@@ -2276,10 +2276,12 @@ void init_block(struct precomp_block *block)
     * yet as the game should have already set up the code correctly.
     */
    invalid_code[block->start>>12] = 0;
+   mark_code_page(block->start);
    if (block->end < UINT32_C(0x80000000) || block->start >= UINT32_C(0xc0000000))
    { 
       uint32_t paddr = virtual_to_physical_address(&g_dev.r4300, block->start, 2);
       invalid_code[paddr>>12] = 0;
+      mark_code_page(paddr);
       if (!blocks[paddr>>12])
       {
          blocks[paddr>>12] = (struct precomp_block *) malloc(sizeof(struct precomp_block));
@@ -2294,6 +2296,7 @@ void init_block(struct precomp_block *block)
 
       paddr += block->end - block->start - 4;
       invalid_code[paddr>>12] = 0;
+      mark_code_page(paddr);
       if (!blocks[paddr>>12])
       {
          blocks[paddr>>12] = (struct precomp_block *) malloc(sizeof(struct precomp_block));
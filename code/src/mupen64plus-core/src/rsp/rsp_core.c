@@ -24,6 +24,7 @@
 #include "main/main.h"
 #include "main/profile.h"
 #include "main/rom.h"
+#include "memory/dma_copy.h"
 #include "memory/memory.h"
 #include "plugin/plugin.h"
 #include "r4300/r4300_core.h"
@@ -35,7 +36,7 @@
 
 static void dma_sp_write(struct rsp_core* sp, unsigned length, unsigned count, unsigned skip)
 {
-    unsigned int i,j;
+    unsigned int j;
     unsigned int memaddr  = sp->regs[SP_MEM_ADDR_REG] & 0xfff;
     unsigned int dramaddr = sp->regs[SP_DRAM_ADDR_REG] & 0xffffff;
 
@@ -44,19 +45,15 @@ static void dma_sp_write(struct rsp_core* sp, unsigned length, unsigned count, u
 
     for(j = 0; j < count; j++)
     {
-        for(i = 0; i < length; i++)
-        {
-            spmem[memaddr^S8] = dram[dramaddr^S8];
-            memaddr++;
-            dramaddr++;
-        }
-        dramaddr+=skip;
+        dma_copy(spmem, memaddr, dram, dramaddr, length);
+        memaddr+=length;
+        dramaddr+=length+skip;
     }
 }
 
 static void dma_sp_read(struct rsp_core* sp, unsigned length, unsigned count, unsigned skip)
 {
-    unsigned int i,j;
+    unsigned int j;
     unsigned int memaddr  = sp->regs[SP_MEM_ADDR_REG] & 0xfff;
     unsigned int dramaddr = sp->regs[SP_DRAM_ADDR_REG] & 0xffffff;
 
@@ -65,13 +62,9 @@ static void dma_sp_read(struct rsp_core* sp, unsigned length, unsigned count, un
 
     for(j = 0; j < count; j++)
     {
-        for(i = 0; i < length; i++)
-        {
-            dram[dramaddr^S8] = spmem[memaddr^S8];
-            memaddr++;
-            dramaddr++;
-        }
-        dramaddr+=skip;
+        dma_copy(dram, dramaddr, spmem, memaddr, length);
+        memaddr+=length;
+        dramaddr+=length+skip;
     }
 }
 
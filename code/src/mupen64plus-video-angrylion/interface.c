@@ -16,6 +16,9 @@ extern void DebugMessage(int level, const char *message, ...);
 #include "m64p_types.h"
 #include "m64p_config.h"
 #include "vdac.h"
+#include "parallel_al.h"
+
+#include <features/features_cpu.h>
 
 int retro_return(bool just_flipping);
 
@@ -32,6 +35,50 @@ extern uint32_t screen_pitch;
 
 struct n64video_config config;
 
+/* last frame written by the VI, presented by the frontend */
+struct rgba* angrylion_frame = NULL;
+
+#ifdef PERF_STATS
+/* host time spent in the RDP and VI, reported per worker count */
+#define FRAME_STATS_PERIOD 300
+
+static struct
+{
+    retro_time_t usec;
+    unsigned frames;
+} frame_stats;
+
+static void frame_stats_update(void)
+{
+    uint32_t pixels[4];
+    uint64_t vi_filter_usec, vi_latency_usec;
+    uint32_t vi_frames;
+
+    if (++frame_stats.frames < FRAME_STATS_PERIOD)
+        return;
+
+    n64video_pixel_stats(pixels);
+    n64video_vi_stats(&vi_filter_usec, &vi_latency_usec, &vi_frames);
+    if (vi_frames == 0)
+        vi_frames = 1;
+
+    DebugMessage(M64MSG_INFO, "angrylion: %u worker(s), %.2f ms/frame, %.1f Mpixel/s",
+          parallel_num_workers(),
+          frame_stats.usec / 1000.0 / frame_stats.frames,
+          (pixels[0] + pixels[1] + pixels[2] + pixels[3]) / (double)(frame_stats.usec ? frame_stats.usec : 1));
+    DebugMessage(M64MSG_INFO, "angrylion: pixels/frame 1-cycle %u, 2-cycle %u, copy %u, fill %u",
+          pixels[0] / frame_stats.frames, pixels[1] / frame_stats.frames,
+          pixels[2] / frame_stats.frames, pixels[3] / frame_stats.frames);
+    DebugMessage(M64MSG_INFO, "angrylion: VI filters %.2f ms/frame, %.2f ms from VI update to screen%s",
+          vi_filter_usec / 1000.0 / vi_frames,
+          vi_latency_usec / 1000.0 / vi_frames,
+          n64video_vi_pipelined() ? " (pipelined)" : "");
+
+    frame_stats.usec    = 0;
+    frame_stats.frames  = 0;
+}
+#endif
+
 void plugin_init(void)
 {
 }
@@ -137,6 +184,7 @@ void vdac_init(struct n64video_config* config) { }
 void vdac_read(struct frame_buffer* fb, bool alpha) { }
 void vdac_write(struct frame_buffer* fb)
 {
+   angrylion_frame = fb->pixels;
    screen_width = fb->width;
    screen_height = fb->height;
    screen_pitch = fb->pitch * 4;
@@ -190,6 +238,19 @@ void angrylion_set_overscan(unsigned value)
     
 }
 
+void angrylion_set_vi_pipelined(unsigned value)
+{
+   if(config.vi.pipelined != (bool)value)
+   {
+      config.vi.pipelined = (bool)value;
+      if (angrylion_init)
+      {
+         n64video_close();
+         n64video_init(&config);
+      }
+   }
+}
+
 void angrylion_set_vi_dedither(unsigned value)
 {
    if(config.vi.vi_dedither != (bool)value)
@@ -310,7 +371,13 @@ void angrylionProcessDList(void)
 
 void angrylionProcessRDPList(void)
 {
+#ifdef PERF_STATS
+  retro_time_t start = cpu_features_get_time_usec();
+  n64video_process_list();
+  frame_stats.usec += cpu_features_get_time_usec() - start;
+#else
   n64video_process_list();
+#endif
 }
 
 void angrylionRomClosed (void)
@@ -349,6 +416,12 @@ int angrylionRomOpen(void)
   config.gfx.vi_reg      = plugin_get_vi_registers();
   config.gfx.dp_reg      = plugin_get_dp_registers();
 
+   angrylion_frame       = NULL;
+#ifdef PERF_STATS
+   frame_stats.usec      = 0;
+   frame_stats.frames    = 0;
+#endif
+
    n64video_init(&config);
    angrylion_init        = true;
    return 1;
@@ -356,14 +429,23 @@ int angrylionRomOpen(void)
 
 void angrylionUpdateScreen(void)
 {
+#ifdef PERF_STATS
+    retro_time_t start;
+#endif
 #ifdef HAVE_FRAMESKIP
     static int counter;
     if (counter++ < skip)
         return;
     counter = 0;
 #endif
+#ifdef PERF_STATS
+    start = cpu_features_get_time_usec();
     n64video_update_screen();
-    
+    frame_stats.usec += cpu_features_get_time_usec() - start;
+    frame_stats_update();
+#else
+    n64video_update_screen();
+#endif
 }
 
 void angrylionShowCFB (void)
@@ -126,18 +126,137 @@ static uint32_t rdp_cmd_len;
 // multithreaded mode
 static bool rdp_cmd_sync[64];
 
+// in multithreaded mode the scanlines touched by the buffered primitives
+// are split into RDP_BANDS_PER_WORKER bands per worker, cut so that each
+// holds about the same number of primitive lines, so busy areas end up in
+// thin bands. The bands are dealt out to the workers in turn. Each worker
+// has a bin of the primitives that touch its bands and runs only those,
+// along with all state commands. More bands per worker spread the load
+// more evenly, but a primitive is edge walked again by every worker whose
+// band it touches, and one band per worker came out fastest
+#define RDP_BANDS_PER_WORKER 1
+#define RDP_MAX_BANDS 256
+
+static uint16_t rdp_worker_bin[PARALLEL_MAX_WORKERS][CMD_BUFFER_SIZE];
+static uint32_t rdp_worker_bin_len[PARALLEL_MAX_WORKERS];
+static bool rdp_cmd_is_prim[CMD_BUFFER_SIZE];
+
+// gets the scanlines a primitive can draw to from its command, false for
+// commands that don't draw
+static bool cmd_prim_lines(const uint32_t* cmd, int32_t* first, int32_t* last)
+{
+    int32_t yl, yh;
+
+    switch (CMD_ID(cmd)) {
+        case CMD_ID_FILL_TRIANGLE:
+        case CMD_ID_FILL_ZBUFFER_TRIANGLE:
+        case CMD_ID_TEXTURE_TRIANGLE:
+        case CMD_ID_TEXTURE_ZBUFFER_TRIANGLE:
+        case CMD_ID_SHADE_TRIANGLE:
+        case CMD_ID_SHADE_ZBUFFER_TRIANGLE:
+        case CMD_ID_SHADE_TEXTURE_TRIANGLE:
+        case CMD_ID_SHADE_TEXTURE_Z_BUFFER_TRIANGLE:
+            yl = SIGN(cmd[0], 14);
+            yh = SIGN(cmd[1], 14);
+            break;
+        case CMD_ID_TEXTURE_RECTANGLE:
+        case CMD_ID_TEXTURE_RECTANGLE_FLIP:
+        case CMD_ID_FILL_RECTANGLE:
+            // yl gets rounded up in fill and copy mode
+            yl = (cmd[0] & 0xfff) | 3;
+            yh = cmd[1] & 0xfff;
+            break;
+        default:
+            return false;
+    }
+
+    // the same limits edgewalker_for_prims() applies before clipping
+    *first = yh < 0 ? 0 : yh >> 2;
+    *last = MIN(yl >> 2, 1023);
+    return true;
+}
+
+static void cmd_bin_buffered(void)
+{
+    static int32_t line_prims[1025];
+    static int32_t prim_lines[CMD_BUFFER_SIZE][2];
+    uint32_t num_workers = parallel_num_workers();
+    uint32_t num_bands = MIN(num_workers * RDP_BANDS_PER_WORKER, RDP_MAX_BANDS);
+    uint32_t pos, band = 0, worker;
+    int32_t line, total = 0, count = 0, lines_first = 1023, lines_last = 0;
+
+    memset(line_prims, 0, sizeof(line_prims));
+    memset(rdp_worker_bin_len, 0, sizeof(rdp_worker_bin_len));
+
+    // count the primitives on each line, as differences first
+    for (pos = 0; pos < rdp_cmd_buf_pos; pos++) {
+        int32_t* lines = prim_lines[pos];
+
+        rdp_cmd_is_prim[pos] = cmd_prim_lines(rdp_cmd_buf[pos], &lines[0], &lines[1]);
+        if (!rdp_cmd_is_prim[pos] || lines[0] > lines[1])
+            continue;
+
+        line_prims[lines[0]]++;
+        line_prims[lines[1] + 1]--;
+        total += lines[1] - lines[0] + 1;
+        lines_first = MIN(lines_first, lines[0]);
+        lines_last = MAX(lines_last, lines[1]);
+    }
+
+    // start a new band whenever the lines so far hold the next share of
+    // the primitive lines
+    for (line = 0; line < 1024; line++) {
+        if (line)
+            line_prims[line] += line_prims[line - 1];
+        count += line_prims[line];
+        line_worker[line] = band % num_workers;
+
+        if (line >= lines_first && line < lines_last && band + 1 < num_bands &&
+            (int64_t)count * num_bands >= (int64_t)total * (band + 1))
+            band++;
+    }
+
+    for (pos = 0; pos < rdp_cmd_buf_pos; pos++) {
+        const int32_t* lines = prim_lines[pos];
+        uint64_t workers = 0;
+
+        if (!rdp_cmd_is_prim[pos] || lines[0] > lines[1])
+            continue;
+
+        for (line = lines[0]; line <= lines[1]; line++)
+            workers |= 1ULL << line_worker[line];
+
+        for (worker = 0; worker < num_workers; worker++)
+            if (workers & (1ULL << worker))
+                rdp_worker_bin[worker][rdp_worker_bin_len[worker]++] = pos;
+    }
+}
+
+// runs the state commands of the buffer and the primitives in the bin of
+// this worker
 static void cmd_run_buffered(uint32_t worker_id)
 {
-    uint32_t pos;
-    for (pos = 0; pos < rdp_cmd_buf_pos; pos++)
-        rdp_cmd(worker_id, rdp_cmd_buf[pos]);
+    const uint16_t* bin = rdp_worker_bin[worker_id];
+    uint32_t bin_len = rdp_worker_bin_len[worker_id];
+    uint32_t pos, i = 0;
+
+    for (pos = 0; pos < rdp_cmd_buf_pos; pos++) {
+        if (!rdp_cmd_is_prim[pos])
+            rdp_cmd(worker_id, rdp_cmd_buf[pos]);
+        else if (i < bin_len && pos == bin[i]) {
+            rdp_cmd(worker_id, rdp_cmd_buf[pos]);
+            i++;
+        }
+    }
 }
 
 static void cmd_flush(void)
 {
     // only run if there's something buffered
     if (rdp_cmd_buf_pos) {
-        // let workers run all buffered commands in parallel
+        // sort the primitives into bands, then let workers run them in
+        // parallel
+        cmd_bin_buffered();
         parallel_run(cmd_run_buffered);
         // reset buffer by starting from the beginning
         rdp_cmd_buf_pos = 0;
@@ -163,7 +282,7 @@ void n64video_config_init(struct n64video_config* config)
 
 void rdp_init_worker(uint32_t worker_id)
 {
-    rdp_init(worker_id, parallel_num_workers());
+    rdp_init(worker_id);
 }
 
 #ifdef HAVE_RDP_DUMP
@@ -222,6 +341,7 @@ void n64video_init(struct n64video_config* _config)
     cmd_init();
 
     rdp_pipeline_crashed = 0;
+    memset(line_worker, 0, sizeof(line_worker));
     memset(&onetimewarnings, 0, sizeof(onetimewarnings));
 
     if (config.parallel)
@@ -238,7 +358,7 @@ void n64video_init(struct n64video_config* _config)
        parallel_run(rdp_init_worker);
     }
     else
-        rdp_init(0, 1);
+        rdp_init(0);
 }
 
 void n64video_process_list(void)
@@ -343,6 +463,39 @@ void n64video_process_list(void)
     *dp_reg[DP_START] = *dp_reg[DP_CURRENT] = *dp_reg[DP_END];
 }
 
+// returns the pixels rasterized per cycle type (1-cycle, 2-cycle, copy,
+// fill) since the last call
+void n64video_pixel_stats(uint32_t pixels[4])
+{
+    uint32_t i, c;
+
+    for (c = 0; c < 4; c++)
+        pixels[c] = 0;
+
+    for (i = 0; i < PARALLEL_MAX_WORKERS; i++) {
+        for (c = 0; c < 4; c++) {
+            pixels[c] += state[i].span_pixels[c];
+            state[i].span_pixels[c] = 0;
+        }
+    }
+}
+
+// returns the time spent in the VI filters and the time from reading a frame
+// to sending it to the screen, summed over the frames shown since the last call
+void n64video_vi_stats(uint64_t* filter_usec, uint64_t* latency_usec, uint32_t* frames)
+{
+    *filter_usec = vi_stats.filter_usec;
+    *latency_usec = vi_stats.latency_usec;
+    *frames = vi_stats.frames;
+    memset(&vi_stats, 0, sizeof(vi_stats));
+}
+
+// true if the VI filters run on their own thread, one frame behind the RDP
+bool n64video_vi_pipelined(void)
+{
+    return vi_pipelined;
+}
+
 void n64video_close(void)
 {
 #ifdef HAVE_RDP_DUMP
@@ -83,6 +83,7 @@ struct n64video_config
         bool exclusive;             // run in exclusive mode when in fullscreen if true
         bool vi_dedither;           // enable dedithering if true
         bool vi_blur;               // enable bilateral blur if true
+        bool pipelined;             // filter on a separate thread, one frame late, if true
     } vi;
     struct {
         enum dp_compat_profile compat;  // multithreading compatibility mode
@@ -96,4 +97,7 @@ void n64video_config_init(struct n64video_config* config);
 void n64video_init(struct n64video_config* config);
 void n64video_update_screen(void);
 void n64video_process_list(void);
+void n64video_pixel_stats(uint32_t pixels[4]);
+void n64video_vi_stats(uint64_t* filter_usec, uint64_t* latency_usec, uint32_t* frames);
+bool n64video_vi_pipelined(void);
 void n64video_close(void);
@@ -187,8 +187,7 @@ struct combiner_inputs
 
 struct rdp_state
 {
-    uint32_t stride;
-    uint32_t offset;
+    uint32_t span_pixels[4];        // pixels rasterized per cycle type
 
     int blshifta;
     int blshiftb;
@@ -340,10 +339,14 @@ struct rdp_state
 
 struct rdp_state state[PARALLEL_MAX_WORKERS];
 
+// worker that draws each scanline, set for every parallel flush by
+// cmd_bin_buffered(); all zeros, so worker 0, otherwise
+static uint8_t line_worker[1024];
+
 static int32_t one_color = 0x100;
 static int32_t zero_color = 0x00;
 
-void rdp_init(uint32_t wid, uint32_t num_workers);
+void rdp_init(uint32_t wid);
 void rdp_invalid(uint32_t wid, const uint32_t* args);
 void rdp_noop(uint32_t wid, const uint32_t* args);
 void rdp_tri_noshade(uint32_t wid, const uint32_t* args);
@@ -468,6 +471,7 @@ static void deduce_derivatives(uint32_t wid);
 #include "rdp/tmem.c"
 #include "rdp/tcoord.c"
 #include "rdp/tex.c"
+#include "rdp/lanes.c"
 #include "rdp/rasterizer.c"
 
 static void deduce_derivatives(uint32_t wid)
@@ -559,10 +563,8 @@ static void deduce_derivatives(uint32_t wid)
     state[wid].other_modes.f.dolod = state[wid].other_modes.tex_lod_en || lodfracused;
 }
 
-void rdp_init(uint32_t wid, uint32_t num_workers)
+void rdp_init(uint32_t wid)
 {
-    state[wid].stride = num_workers;
-    state[wid].offset = wid;
     state[wid].rseed = 3 + wid * 13;
 
     uint32_t tmp[2] = { 0 };
@@ -0,0 +1,82 @@
+// the span renderers evaluate shade color, z and coverage for SPAN_LANES
+// pixels at a time; the arithmetic loop has no branches or table lookups so
+// it can be vectorized, the results are identical to rgba_correct and the
+// z_correct it replaced, which tools/spanlanescmp.c checks
+#define SPAN_LANES 8
+
+struct span_lanes
+{
+    int32_t r[SPAN_LANES];
+    int32_t g[SPAN_LANES];
+    int32_t b[SPAN_LANES];
+    int32_t a[SPAN_LANES];
+    int32_t z[SPAN_LANES];
+    int32_t offx[SPAN_LANES];
+    int32_t offy[SPAN_LANES];
+    uint32_t cvg[SPAN_LANES];
+    uint32_t cvbit[SPAN_LANES];
+};
+
+static STRICTINLINE void span_lanes_shade(uint32_t wid, struct span_lanes* ln, int x, int xinc, int count,
+                                          int r, int g, int b, int a, int z,
+                                          int drinc, int dginc, int dbinc, int dainc, int dzinc)
+{
+    int k;
+    int32_t cdr = state[wid].spans_cdr, drdy = state[wid].spans_drdy;
+    int32_t cdg = state[wid].spans_cdg, dgdy = state[wid].spans_dgdy;
+    int32_t cdb = state[wid].spans_cdb, dbdy = state[wid].spans_dbdy;
+    int32_t cda = state[wid].spans_cda, dady = state[wid].spans_dady;
+    int32_t cdz = state[wid].spans_cdz, dzdy = state[wid].spans_dzdy;
+
+    if (count > SPAN_LANES)
+        count = SPAN_LANES;
+
+    for (k = 0; k < count; k++)
+    {
+        uint8_t mask = state[wid].cvgbuf[x + k * xinc];
+        ln->cvg[k] = cvarray[mask].cvg;
+        ln->cvbit[k] = cvarray[mask].cvbit;
+        ln->offx[k] = cvarray[mask].xoff;
+        ln->offy[k] = cvarray[mask].yoff;
+    }
+
+    for (k = 0; k < count; k++)
+    {
+        int32_t full = ln->cvg[k] == 8;
+        int32_t offx = ln->offx[k], offy = ln->offy[k];
+        int32_t sr = (int32_t)((uint32_t)r + (uint32_t)k * (uint32_t)drinc) >> 14;
+        int32_t sg = (int32_t)((uint32_t)g + (uint32_t)k * (uint32_t)dginc) >> 14;
+        int32_t sb = (int32_t)((uint32_t)b + (uint32_t)k * (uint32_t)dbinc) >> 14;
+        int32_t sa = (int32_t)((uint32_t)a + (uint32_t)k * (uint32_t)dainc) >> 14;
+        int32_t sz = ((int32_t)((uint32_t)z + (uint32_t)k * (uint32_t)dzinc) >> 10) & 0x3fffff;
+        int32_t zanded;
+
+        sr = full ? sr >> 2 : ((sr << 2) + offx * cdr + offy * drdy) >> 4;
+        sg = full ? sg >> 2 : ((sg << 2) + offx * cdg + offy * dgdy) >> 4;
+        sb = full ? sb >> 2 : ((sb << 2) + offx * cdb + offy * dbdy) >> 4;
+        sa = full ? sa >> 2 : ((sa << 2) + offx * cda + offy * dady) >> 4;
+        sz = full ? sz >> 3 : ((sz << 2) + offx * cdz + offy * dzdy) >> 5;
+
+        zanded = (sz & 0x60000) >> 17;
+
+        ln->r[k] = sr & 0x1ff;
+        ln->g[k] = sg & 0x1ff;
+        ln->b[k] = sb & 0x1ff;
+        ln->a[k] = sa & 0x1ff;
+        ln->z[k] = zanded == 3 ? 0 : zanded == 2 ? 0x3ffff : sz & 0x3ffff;
+    }
+}
+
+static STRICTINLINE void span_lanes_color(uint32_t wid, struct span_lanes* ln, int k)
+{
+    state[wid].shade_color.r = special_9bit_clamptable[ln->r[k]];
+    state[wid].shade_color.g = special_9bit_clamptable[ln->g[k]];
+    state[wid].shade_color.b = special_9bit_clamptable[ln->b[k]];
+    state[wid].shade_color.a = special_9bit_clamptable[ln->a[k]];
+}
+
+static STRICTINLINE void span_lanes_load(uint32_t wid, struct span_lanes* ln, int k, int* z)
+{
+    span_lanes_color(wid, ln, k);
+    *z = ln->z[k];
+}
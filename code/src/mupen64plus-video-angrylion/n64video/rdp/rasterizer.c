@@ -153,42 +153,11 @@ static STRICTINLINE void rgba_correct(uint32_t wid, int offx, int offy, int r, i
     state[wid].shade_color.a = special_9bit_clamptable[a & 0x1ff];
 }
 
-static STRICTINLINE void z_correct(uint32_t wid, int offx, int offy, int* z, uint32_t cvg)
-{
-    int summand_z;
-    int sz = *z;
-    int zanded;
-
-
-
-    if (cvg == 8)
-        sz = sz >> 3;
-    else
-    {
-        summand_z = offx * state[wid].spans_cdz + offy * state[wid].spans_dzdy;
-
-        sz = ((sz << 2) + summand_z) >> 5;
-    }
-
-
-
-    zanded = (sz & 0x60000) >> 17;
-
-
-    switch (zanded)
-    {
-        case 0: *z = sz & 0x3ffff;                      break;
-        case 1: *z = sz & 0x3ffff;                      break;
-        case 2: *z = 0x3ffff;                           break;
-        case 3: *z = 0;                                 break;
-    }
-}
-
 static void render_spans_1cycle_complete(uint32_t wid, int start, int end, int tilenum, int flip)
 {
     int zb = state[wid].zb_address >> 1;
     int zbcur;
-    uint8_t offx, offy;
+    struct span_lanes lanes;
     struct spansigs sigs;
     uint32_t blend_en;
     uint32_t prewrap;
@@ -199,7 +168,7 @@ static void render_spans_1cycle_complete(uint32_t wid, int start, int end, int t
     int newtile = tilenum;
     int news, newt;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc, dsinc, dtinc, dwinc;
     int xinc;
@@ -241,7 +210,7 @@ static void render_spans_1cycle_complete(uint32_t wid, int start, int end, int t
 
     int cdith = 7, adith = 0;
     int r, g, b, a, z, s, t, w;
-    int sr, sg, sb, sa, sz, ss, st, sw;
+    int sz, ss, st, sw;
     int xstart, xend, xendsc;
     int sss = 0, sst = 0;
     int32_t prelodfrac;
@@ -308,20 +277,20 @@ static void render_spans_1cycle_complete(uint32_t wid, int start, int end, int t
 
         for (j = 0; j <= length; j++)
         {
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
             ss = s >> 16;
             st = t >> 16;
             sw = w >> 16;
-            sz = (z >> 10) & 0x3fffff;
 
 
             sigs.endspan = (j == length);
             sigs.preendspan = (j == (length - 1));
 
-            lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+            k = j & (SPAN_LANES - 1);
+            if (!k)
+                span_lanes_shade(wid, &lanes, x, xinc, length - j + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
+
+            curpixel_cvg = lanes.cvg[k];
+            curpixel_cvbit = lanes.cvbit[k];
 
 
             get_texel1_1cycle(wid, &news, &newt, s, t, w, dsinc, dtinc, dwinc, i, &sigs);
@@ -358,8 +327,7 @@ static void render_spans_1cycle_complete(uint32_t wid, int start, int end, int t
 
             texture_pipeline_cycle(wid, &state[wid].texel1_color, &state[wid].texel1_color, news, newt, newtile, 0);
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            span_lanes_load(wid, &lanes, k, &sz);
 
             if (state[wid].other_modes.f.getditherlevel < 2)
                 get_dither_noise(wid, x, i, &cdith, &adith);
@@ -399,7 +367,7 @@ static void render_spans_1cycle_notexel1(uint32_t wid, int start, int end, int t
 {
     int zb = state[wid].zb_address >> 1;
     int zbcur;
-    uint8_t offx, offy;
+    struct span_lanes lanes;
     struct spansigs sigs;
     uint32_t blend_en;
     uint32_t prewrap;
@@ -408,7 +376,7 @@ static void render_spans_1cycle_notexel1(uint32_t wid, int start, int end, int t
     int prim_tile = tilenum;
     int tile1 = tilenum;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc, dsinc, dtinc, dwinc;
     int xinc;
@@ -449,7 +417,7 @@ static void render_spans_1cycle_notexel1(uint32_t wid, int start, int end, int t
 
     int cdith = 7, adith = 0;
     int r, g, b, a, z, s, t, w;
-    int sr, sg, sb, sa, sz, ss, st, sw;
+    int sz, ss, st, sw;
     int xstart, xend, xendsc;
     int sss = 0, sst = 0;
     int curpixel = 0;
@@ -510,21 +478,21 @@ static void render_spans_1cycle_notexel1(uint32_t wid, int start, int end, int t
 
         for (j = 0; j <= length; j++)
         {
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
             ss = s >> 16;
             st = t >> 16;
             sw = w >> 16;
-            sz = (z >> 10) & 0x3fffff;
 
 
 
             sigs.endspan = (j == length);
             sigs.preendspan = (j == (length - 1));
 
-            lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+            k = j & (SPAN_LANES - 1);
+            if (!k)
+                span_lanes_shade(wid, &lanes, x, xinc, length - j + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
+
+            curpixel_cvg = lanes.cvg[k];
+            curpixel_cvbit = lanes.cvbit[k];
 
             state[wid].tcdiv_ptr(ss, st, sw, &sss, &sst);
 
@@ -532,8 +500,7 @@ static void render_spans_1cycle_notexel1(uint32_t wid, int start, int end, int t
 
             texture_pipeline_cycle(wid, &state[wid].texel0_color, &state[wid].texel0_color, sss, sst, tile1, 0);
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            span_lanes_load(wid, &lanes, k, &sz);
 
             if (state[wid].other_modes.f.getditherlevel < 2)
                 get_dither_noise(wid, x, i, &cdith, &adith);
@@ -573,12 +540,12 @@ static void render_spans_1cycle_notex(uint32_t wid, int start, int end, int tile
 {
     int zb = state[wid].zb_address >> 1;
     int zbcur;
-    uint8_t offx, offy;
+    struct span_lanes lanes;
     uint32_t blend_en;
     uint32_t prewrap;
     uint32_t curpixel_cvg, curpixel_cvbit, curpixel_memcvg;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc;
     int xinc;
@@ -614,7 +581,7 @@ static void render_spans_1cycle_notex(uint32_t wid, int start, int end, int tile
 
     int cdith = 7, adith = 0;
     int r, g, b, a, z;
-    int sr, sg, sb, sa, sz;
+    int sz;
     int xstart, xend, xendsc;
     int curpixel = 0;
     int x, length, scdiff;
@@ -663,16 +630,15 @@ static void render_spans_1cycle_notex(uint32_t wid, int start, int end, int tile
 
         for (j = 0; j <= length; j++)
         {
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
-            sz = (z >> 10) & 0x3fffff;
 
-            lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+            k = j & (SPAN_LANES - 1);
+            if (!k)
+                span_lanes_shade(wid, &lanes, x, xinc, length - j + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
+
+            curpixel_cvg = lanes.cvg[k];
+            curpixel_cvbit = lanes.cvbit[k];
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            span_lanes_load(wid, &lanes, k, &sz);
 
             if (state[wid].other_modes.f.getditherlevel < 2)
                 get_dither_noise(wid, x, i, &cdith, &adith);
@@ -708,6 +674,7 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
     int zb = state[wid].zb_address >> 1;
     int zbcur;
     uint8_t offx, offy;
+    struct span_lanes lanes;
     int32_t prelodfrac;
     struct color nexttexel1_color;
     uint32_t blend_en;
@@ -723,7 +690,7 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
     int prim_tile = tilenum;
     int tile3 = tilenum;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc, dsinc, dtinc, dwinc;
     int xinc;
@@ -765,7 +732,7 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
     int cdith = 7, adith = 0;
 
     int r, g, b, a, z, s, t, w;
-    int sr, sg, sb, sa, sz, ss, st, sw;
+    int sz, ss, st, sw;
     int xstart, xend, xendsc;
     int sss = 0, sst = 0;
     int curpixel = 0;
@@ -832,14 +799,8 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
 
         for (j = 0; j <= length; j++)
         {
-            sz = (z >> 10) & 0x3fffff;
-
             if (!j)
             {
-                sr = r >> 14;
-                sg = g >> 14;
-                sb = b >> 14;
-                sa = a >> 14;
                 ss = s >> 16;
                 st = t >> 16;
                 sw = w >> 16;
@@ -851,9 +812,12 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
                 texture_pipeline_cycle(wid, &state[wid].texel0_color, &state[wid].texel0_color, sss, sst, tile1, 0);
                 texture_pipeline_cycle(wid, &state[wid].texel1_color, &state[wid].texel0_color, sss, sst, tile2, 1);
 
-                lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+                span_lanes_shade(wid, &lanes, x, xinc, length + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
 
-                rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
+                curpixel_cvg = lanes.cvg[0];
+                curpixel_cvbit = lanes.cvbit[0];
+
+                span_lanes_color(wid, &lanes, 0);
 
                 if (state[wid].other_modes.f.getditherlevel < 2)
                     get_dither_noise(wid, x, i, &cdith, &adith);
@@ -895,7 +859,7 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
                 texture_pipeline_cycle(wid, &nexttexel1_color, &state[wid].nexttexel_color, sss2, sst2, tile3, 0);
             }
 
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            sz = lanes.z[j & (SPAN_LANES - 1)];
 
             combiner_2cycle_cycle1(wid, adith, &curpixel_cvg);
 
@@ -921,17 +885,28 @@ static void render_spans_2cycle_complete(uint32_t wid, int start, int end, int t
             b += dbinc;
             a += dainc;
 
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
 
 
 
 
-            lookup_cvmask_derivatives(j < length ? state[wid].cvgbuf[x] : 0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+            k = (j + 1) & (SPAN_LANES - 1);
+            if (j < length)
+            {
+                if (!k)
+                    span_lanes_shade(wid, &lanes, x, xinc, length - j, r, g, b, a, z + dzinc, drinc, dginc, dbinc, dainc, dzinc);
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, nextpixel_cvg);
+                nextpixel_cvg = lanes.cvg[k];
+                curpixel_cvbit = lanes.cvbit[k];
+
+                span_lanes_color(wid, &lanes, k);
+            }
+            else
+            {
+                // the pipeline still shades the pixel past the span end, with no coverage
+                lookup_cvmask_derivatives(0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+
+                rgba_correct(wid, offx, offy, r >> 14, g >> 14, b >> 14, a >> 14, nextpixel_cvg);
+            }
 
             state[wid].lod_frac = prelodfrac;
             state[wid].texel0_color = state[wid].nexttexel_color;
@@ -982,6 +957,7 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
     int zb = state[wid].zb_address >> 1;
     int zbcur;
     uint8_t offx, offy;
+    struct span_lanes lanes;
     uint32_t blend_en;
     uint32_t prewrap;
     uint32_t curpixel_cvg, curpixel_cvbit, curpixel_memcvg;
@@ -992,7 +968,7 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
     int tile1 = tilenum;
     int prim_tile = tilenum;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc, dsinc, dtinc, dwinc;
     int xinc;
@@ -1034,7 +1010,7 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
     int cdith = 7, adith = 0;
 
     int r, g, b, a, z, s, t, w;
-    int sr, sg, sb, sa, sz, ss, st, sw;
+    int sz, ss, st, sw;
     int xstart, xend, xendsc;
     int sss = 0, sst = 0;
     int curpixel = 0;
@@ -1092,14 +1068,8 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
 
         for (j = 0; j <= length; j++)
         {
-            sz = (z >> 10) & 0x3fffff;
-
             if (!j)
             {
-                sr = r >> 14;
-                sg = g >> 14;
-                sb = b >> 14;
-                sa = a >> 14;
                 ss = s >> 16;
                 st = t >> 16;
                 sw = w >> 16;
@@ -1111,9 +1081,12 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
                 texture_pipeline_cycle(wid, &state[wid].texel0_color, &state[wid].texel0_color, sss, sst, tile1, 0);
                 texture_pipeline_cycle(wid, &state[wid].texel1_color, &state[wid].texel0_color, sss, sst, tile2, 1);
 
-                lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+                span_lanes_shade(wid, &lanes, x, xinc, length + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
 
-                rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
+                curpixel_cvg = lanes.cvg[0];
+                curpixel_cvbit = lanes.cvbit[0];
+
+                span_lanes_color(wid, &lanes, 0);
 
                 if (state[wid].other_modes.f.getditherlevel < 2)
                     get_dither_noise(wid, x, i, &cdith, &adith);
@@ -1121,7 +1094,7 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
                 combiner_2cycle_cycle0(wid, adith, curpixel_cvg, &acalpha);
             }
 
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            sz = lanes.z[j & (SPAN_LANES - 1)];
 
             combiner_2cycle_cycle1(wid, adith, &curpixel_cvg);
 
@@ -1144,17 +1117,28 @@ static void render_spans_2cycle_notexelnext(uint32_t wid, int start, int end, in
             t += dtinc;
             w += dwinc;
 
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
             ss = s >> 16;
             st = t >> 16;
             sw = w >> 16;
 
-            lookup_cvmask_derivatives(j < length ? state[wid].cvgbuf[x] : 0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+            k = (j + 1) & (SPAN_LANES - 1);
+            if (j < length)
+            {
+                if (!k)
+                    span_lanes_shade(wid, &lanes, x, xinc, length - j, r, g, b, a, z + dzinc, drinc, dginc, dbinc, dainc, dzinc);
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, nextpixel_cvg);
+                nextpixel_cvg = lanes.cvg[k];
+                curpixel_cvbit = lanes.cvbit[k];
+
+                span_lanes_color(wid, &lanes, k);
+            }
+            else
+            {
+                // the pipeline still shades the pixel past the span end, with no coverage
+                lookup_cvmask_derivatives(0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+
+                rgba_correct(wid, offx, offy, r >> 14, g >> 14, b >> 14, a >> 14, nextpixel_cvg);
+            }
 
             state[wid].tcdiv_ptr(ss, st, sw, &sss, &sst);
 
@@ -1198,6 +1182,7 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
     int zb = state[wid].zb_address >> 1;
     int zbcur;
     uint8_t offx, offy;
+    struct span_lanes lanes;
     uint32_t blend_en;
     uint32_t prewrap;
     uint32_t curpixel_cvg, curpixel_cvbit, curpixel_memcvg;
@@ -1207,7 +1192,7 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
     int tile1 = tilenum;
     int prim_tile = tilenum;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc, dsinc, dtinc, dwinc;
     int xinc;
@@ -1249,7 +1234,7 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
     int cdith = 7, adith = 0;
 
     int r, g, b, a, z, s, t, w;
-    int sr, sg, sb, sa, sz, ss, st, sw;
+    int sz, ss, st, sw;
     int xstart, xend, xendsc;
     int sss = 0, sst = 0;
     int curpixel = 0;
@@ -1307,14 +1292,8 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
 
         for (j = 0; j <= length; j++)
         {
-            sz = (z >> 10) & 0x3fffff;
-
             if (!j)
             {
-                sr = r >> 14;
-                sg = g >> 14;
-                sb = b >> 14;
-                sa = a >> 14;
                 ss = s >> 16;
                 st = t >> 16;
                 sw = w >> 16;
@@ -1325,9 +1304,12 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
 
                 texture_pipeline_cycle(wid, &state[wid].texel0_color, &state[wid].texel0_color, sss, sst, tile1, 0);
 
-                lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+                span_lanes_shade(wid, &lanes, x, xinc, length + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
+
+                curpixel_cvg = lanes.cvg[0];
+                curpixel_cvbit = lanes.cvbit[0];
 
-                rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
+                span_lanes_color(wid, &lanes, 0);
 
                 if (state[wid].other_modes.f.getditherlevel < 2)
                     get_dither_noise(wid, x, i, &cdith, &adith);
@@ -1335,7 +1317,7 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
                 combiner_2cycle_cycle0(wid, adith, curpixel_cvg, &acalpha);
             }
 
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            sz = lanes.z[j & (SPAN_LANES - 1)];
 
             combiner_2cycle_cycle1(wid, adith, &curpixel_cvg);
 
@@ -1358,17 +1340,28 @@ static void render_spans_2cycle_notexel1(uint32_t wid, int start, int end, int t
             t += dtinc;
             w += dwinc;
 
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
             ss = s >> 16;
             st = t >> 16;
             sw = w >> 16;
 
-            lookup_cvmask_derivatives(j < length ? state[wid].cvgbuf[x] : 0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+            k = (j + 1) & (SPAN_LANES - 1);
+            if (j < length)
+            {
+                if (!k)
+                    span_lanes_shade(wid, &lanes, x, xinc, length - j, r, g, b, a, z + dzinc, drinc, dginc, dbinc, dainc, dzinc);
+
+                nextpixel_cvg = lanes.cvg[k];
+                curpixel_cvbit = lanes.cvbit[k];
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, nextpixel_cvg);
+                span_lanes_color(wid, &lanes, k);
+            }
+            else
+            {
+                // the pipeline still shades the pixel past the span end, with no coverage
+                lookup_cvmask_derivatives(0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+
+                rgba_correct(wid, offx, offy, r >> 14, g >> 14, b >> 14, a >> 14, nextpixel_cvg);
+            }
 
             state[wid].tcdiv_ptr(ss, st, sw, &sss, &sst);
 
@@ -1411,13 +1404,14 @@ static void render_spans_2cycle_notex(uint32_t wid, int start, int end, int tile
     int zb = state[wid].zb_address >> 1;
     int zbcur;
     uint8_t offx, offy;
+    struct span_lanes lanes;
     uint32_t blend_en;
     uint32_t prewrap;
     uint32_t curpixel_cvg, curpixel_cvbit, curpixel_memcvg;
     uint32_t nextpixel_cvg;
     uint32_t acalpha;
 
-    int i, j;
+    int i, j, k;
 
     int drinc, dginc, dbinc, dainc, dzinc;
     int xinc;
@@ -1453,7 +1447,7 @@ static void render_spans_2cycle_notex(uint32_t wid, int start, int end, int tile
     int cdith = 7, adith = 0;
 
     int r, g, b, a, z;
-    int sr, sg, sb, sa, sz;
+    int sz;
     int xstart, xend, xendsc;
     int curpixel = 0;
     int wen;
@@ -1504,18 +1498,15 @@ static void render_spans_2cycle_notex(uint32_t wid, int start, int end, int tile
 
         for (j = 0; j <= length; j++)
         {
-            sz = (z >> 10) & 0x3fffff;
-
             if (!j)
             {
-                sr = r >> 14;
-                sg = g >> 14;
-                sb = b >> 14;
-                sa = a >> 14;
 
-                lookup_cvmask_derivatives(state[wid].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+                span_lanes_shade(wid, &lanes, x, xinc, length + 1, r, g, b, a, z, drinc, dginc, dbinc, dainc, dzinc);
 
-                rgba_correct(wid, offx, offy, sr, sg, sb, sa, curpixel_cvg);
+                curpixel_cvg = lanes.cvg[0];
+                curpixel_cvbit = lanes.cvbit[0];
+
+                span_lanes_color(wid, &lanes, 0);
 
                 if (state[wid].other_modes.f.getditherlevel < 2)
                     get_dither_noise(wid, x, i, &cdith, &adith);
@@ -1523,7 +1514,7 @@ static void render_spans_2cycle_notex(uint32_t wid, int start, int end, int tile
                 combiner_2cycle_cycle0(wid, adith, curpixel_cvg, &acalpha);
             }
 
-            z_correct(wid, offx, offy, &sz, curpixel_cvg);
+            sz = lanes.z[j & (SPAN_LANES - 1)];
 
             combiner_2cycle_cycle1(wid, adith, &curpixel_cvg);
 
@@ -1543,14 +1534,25 @@ static void render_spans_2cycle_notex(uint32_t wid, int start, int end, int tile
             b += dbinc;
             a += dainc;
 
-            sr = r >> 14;
-            sg = g >> 14;
-            sb = b >> 14;
-            sa = a >> 14;
 
-            lookup_cvmask_derivatives(j < length ? state[wid].cvgbuf[x] : 0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+            k = (j + 1) & (SPAN_LANES - 1);
+            if (j < length)
+            {
+                if (!k)
+                    span_lanes_shade(wid, &lanes, x, xinc, length - j, r, g, b, a, z + dzinc, drinc, dginc, dbinc, dainc, dzinc);
 
-            rgba_correct(wid, offx, offy, sr, sg, sb, sa, nextpixel_cvg);
+                nextpixel_cvg = lanes.cvg[k];
+                curpixel_cvbit = lanes.cvbit[k];
+
+                span_lanes_color(wid, &lanes, k);
+            }
+            else
+            {
+                // the pipeline still shades the pixel past the span end, with no coverage
+                lookup_cvmask_derivatives(0, &offx, &offy, &nextpixel_cvg, &curpixel_cvbit);
+
+                rgba_correct(wid, offx, offy, r >> 14, g >> 14, b >> 14, a >> 14, nextpixel_cvg);
+            }
 
             combiner_2cycle_cycle0(wid, adith, nextpixel_cvg, &acalpha);
 
@@ -2174,7 +2176,7 @@ static void edgewalker_for_prims(uint32_t wid, int32_t* ewdata)
             {
                 state[wid].span[j].lx = maxxmx;
                 state[wid].span[j].rx = minxhx;
-                state[wid].span[j].validline  = !allinval && !allover && !allunder && (!state[wid].scfield || (state[wid].scfield && !(state[wid].sckeepodd ^ (j & 1)))) && (!state[wid].stride || j % state[wid].stride == state[wid].offset);
+                state[wid].span[j].validline  = !allinval && !allover && !allunder && (!state[wid].scfield || (state[wid].scfield && !(state[wid].sckeepodd ^ (j & 1)))) && line_worker[j] == wid;
 
             }
 
@@ -2261,7 +2263,7 @@ static void edgewalker_for_prims(uint32_t wid, int32_t* ewdata)
             {
                 state[wid].span[j].lx = minxmx;
                 state[wid].span[j].rx = maxxhx;
-                state[wid].span[j].validline  = !allinval && !allover && !allunder && (!state[wid].scfield || (state[wid].scfield && !(state[wid].sckeepodd ^ (j & 1)))) && (!state[wid].stride || j % state[wid].stride == state[wid].offset);
+                state[wid].span[j].validline  = !allinval && !allover && !allunder && (!state[wid].scfield || (state[wid].scfield && !(state[wid].sckeepodd ^ (j & 1)))) && line_worker[j] == wid;
             }
 
         }
@@ -2280,6 +2282,13 @@ static void edgewalker_for_prims(uint32_t wid, int32_t* ewdata)
 
 
 
+    for (j = yhlimit >> 2; j <= (yllimit >> 2); j++)
+    {
+        length = flip ? state[wid].span[j].lx - state[wid].span[j].rx : state[wid].span[j].rx - state[wid].span[j].lx;
+        if (state[wid].span[j].validline && length >= 0)
+            state[wid].span_pixels[state[wid].other_modes.cycle_type & 3] += length + 1;
+    }
+
     switch(state[wid].other_modes.cycle_type)
     {
         case CYCLE_TYPE_1:
@@ -52,6 +52,45 @@ struct vi_reg_ctrl
 
 typedef void(*vi_fetch_filter_func)(struct rgba*, uint32_t, uint32_t, struct vi_reg_ctrl, uint32_t, uint32_t);
 
+// RDRAM as seen by the VI filters: the live RDRAM, or a snapshot of the
+// frame buffer when the filters run pipelined on their own thread
+static uint32_t* vi_rdram32;
+static uint16_t* vi_rdram16;
+static uint8_t* vi_rdram_hidden;
+
+static STRICTINLINE uint16_t vi_read_idx16(uint32_t in)
+{
+    in &= RDRAM_MASK >> 1;
+    return rdram_valid_idx16(in) ? vi_rdram16[in ^ WORD_ADDR_XOR] : 0;
+}
+
+static STRICTINLINE uint16_t vi_read_idx16_fast(uint32_t in)
+{
+    return vi_rdram16[in ^ WORD_ADDR_XOR];
+}
+
+static STRICTINLINE uint32_t vi_read_idx32(uint32_t in)
+{
+    in &= RDRAM_MASK >> 2;
+    return rdram_valid_idx32(in) ? vi_rdram32[in] : 0;
+}
+
+static STRICTINLINE uint32_t vi_read_idx32_fast(uint32_t in)
+{
+    return vi_rdram32[in];
+}
+
+static STRICTINLINE void vi_read_pair16(uint16_t* rdst, uint8_t* hdst, uint32_t in)
+{
+    in &= RDRAM_MASK >> 1;
+    if (rdram_valid_idx16(in)) {
+        *rdst = vi_rdram16[in ^ WORD_ADDR_XOR];
+        *hdst = vi_rdram_hidden[in];
+    } else {
+        *rdst = *hdst = 0;
+    }
+}
+
 #include "vi/gamma.c"
 #include "vi/lerp.c"
 #include "vi/divot.c"
@@ -89,6 +128,27 @@ struct rgba prescale[PRESCALE_WIDTH * PRESCALE_HEIGHT];
 static uint32_t prescale_ptr;
 static int32_t linecount;
 
+// pipelined mode: the filters of frame N run on the async thread while the
+// RDP renders frame N + 1, and frame N is sent to the screen on the next
+// update, one frame late
+static bool vi_pipelined;
+static bool vi_pipeline_pending;
+static bool vi_pipeline_valid;
+static struct frame_buffer vi_pipeline_fb;
+static struct rgba prescale_out[PRESCALE_WIDTH * PRESCALE_HEIGHT];
+static uint8_t* vi_snapshot;
+static uint8_t* vi_snapshot_hidden;
+
+// time spent in the filters and from the start of the update that read a
+// frame to the update that sent it to the screen, see n64video_vi_stats()
+static struct {
+    uint64_t filter_usec;
+    uint64_t latency_usec;
+    uint32_t frames;
+} vi_stats;
+static uint64_t vi_pipeline_task_usec;    // written by the async thread
+static uint64_t vi_pipeline_start_usec;
+
 // parsed VI registers
 static uint32_t** vi_reg_ptr;
 static struct vi_reg_ctrl ctrl;
@@ -115,6 +175,30 @@ static void vi_init(void)
     zb_address = 0;
 
     memset(rseed, 3, sizeof(rseed));
+
+    vi_pipelined = config.vi.pipelined && config.vi.mode == VI_MODE_NORMAL && parallel_async_available();
+    vi_pipeline_pending = false;
+
+    if (vi_pipelined) {
+        vi_snapshot = calloc(1, config.gfx.rdram_size);
+        vi_snapshot_hidden = calloc(1, sizeof(rdram_hidden));
+        if (!vi_snapshot || !vi_snapshot_hidden) {
+            free(vi_snapshot);
+            free(vi_snapshot_hidden);
+            vi_snapshot = vi_snapshot_hidden = NULL;
+            vi_pipelined = false;
+        }
+    }
+
+    if (vi_pipelined) {
+        vi_rdram32 = (uint32_t*)vi_snapshot;
+        vi_rdram16 = (uint16_t*)vi_snapshot;
+        vi_rdram_hidden = vi_snapshot_hidden;
+    } else {
+        vi_rdram32 = (uint32_t*)config.gfx.rdram;
+        vi_rdram16 = (uint16_t*)config.gfx.rdram;
+        vi_rdram_hidden = rdram_hidden;
+    }
 }
 
 static void vi_process_full_parallel(uint32_t worker_id)
@@ -150,7 +234,7 @@ static void vi_process_full_parallel(uint32_t worker_id)
     int32_t y_end = vres;
     int32_t y_inc = 1;
 
-    if (config.parallel) {
+    if (config.parallel && !vi_pipelined) {
         y_begin = worker_id;
         y_inc = parallel_num_workers();
     }
@@ -313,6 +397,92 @@ static void vi_process_full_parallel(uint32_t worker_id)
     }
 }
 
+static void vi_full_frame_buffer(struct frame_buffer* fb, struct rgba* pixels)
+{
+    fb->pixels = pixels;
+    fb->pitch = PRESCALE_WIDTH;
+
+    if (config.vi.hide_overscan) {
+        // crop away overscan area from prescale
+        fb->width = maxhpass - minhpass;
+        fb->height = vres << ctrl.serrate;
+        fb->height_out = (vres << 1) * V_SYNC_NTSC / v_sync;
+        int32_t x = h_start + minhpass;
+        int32_t y = (v_start + (emucontrolsvicurrent ? lowerfield : 0)) << ctrl.serrate;
+        fb->pixels += x + y * fb->pitch;
+    } else {
+        // use entire prescale buffer
+        fb->width = PRESCALE_WIDTH;
+        fb->height = (ispal ? V_RES_PAL : V_RES_NTSC) >> !ctrl.serrate;
+        fb->height_out = V_RES_NTSC;
+    }
+
+    // convert to 16:9 if enabled
+    if (config.vi.widescreen) {
+        fb->height_out = fb->height_out * 3 / 4;
+    }
+}
+
+static void vi_pipeline_task(void)
+{
+    uint64_t start = parallel_time_usec();
+    vi_process_full_parallel(0);
+    vi_pipeline_task_usec = parallel_time_usec() - start;
+}
+
+static bool vi_pipeline_start(void)
+{
+    vi_pipeline_start_usec = parallel_time_usec();
+
+    // copy the RDRAM range the filters can read, with a few lines and
+    // pixels of margin for the restore and AA filters
+    uint32_t bpp = (ctrl.type & 1) ? 4 : 2;
+    int64_t line_size = (int64_t)vi_width_low * bpp;
+    int64_t first_line = (int64_t)(y_start >> 10) - 2;
+    int64_t last_line = (int64_t)((y_start + vres * y_add) >> 10) + 3;
+    int64_t last_x = (int64_t)((x_start + hres * x_add) >> 10) + 4;
+    int64_t begin = frame_buffer + first_line * line_size - 16;
+    int64_t end = frame_buffer + last_line * line_size + last_x * bpp + 16;
+
+    begin = MAX(begin, 0) & ~7;
+    end = MIN((end + 7) & ~7, (int64_t)config.gfx.rdram_size);
+
+    if (begin < end) {
+        memcpy(vi_snapshot + begin, config.gfx.rdram + begin, end - begin);
+        memcpy(vi_snapshot_hidden + begin / 2, rdram_hidden + begin / 2, (end - begin) / 2);
+    }
+
+    vi_full_frame_buffer(&vi_pipeline_fb, prescale_out);
+    vi_pipeline_valid = vi_pipeline_fb.width > 0 && vi_pipeline_fb.height > 0;
+    vi_pipeline_pending = true;
+
+    parallel_async_run(vi_pipeline_task);
+
+    return vi_pipeline_valid;
+}
+
+// waits for the frame filtered on the previous update and sends it to the
+// screen, returns true if there was a valid frame
+static bool vi_pipeline_finish(void)
+{
+    if (!vi_pipeline_pending) {
+        return false;
+    }
+
+    parallel_async_wait();
+    vi_pipeline_pending = false;
+
+    // the frontend keeps reading the output while the next frame is filtered
+    memcpy(prescale_out, prescale, sizeof(prescale));
+    vdac_write(&vi_pipeline_fb);
+
+    vi_stats.filter_usec += vi_pipeline_task_usec;
+    vi_stats.latency_usec += parallel_time_usec() - vi_pipeline_start_usec;
+    vi_stats.frames++;
+
+    return vi_pipeline_valid;
+}
+
 static bool vi_process_full(void)
 {
     bool isblank = (ctrl.type & 2) == 0;
@@ -445,6 +615,12 @@ static bool vi_process_full(void)
         return false;
     }
 
+    if (vi_pipelined) {
+        return vi_pipeline_start();
+    }
+
+    uint64_t start = parallel_time_usec();
+
     // run filter update in parallel if enabled
     if (config.parallel) {
         parallel_run(vi_process_full_parallel);
@@ -452,33 +628,16 @@ static bool vi_process_full(void)
         vi_process_full_parallel(0);
     }
 
+    vi_stats.filter_usec += parallel_time_usec() - start;
+
     // finish and send buffer to screen
     struct frame_buffer fb;
-    fb.pixels = prescale;
-    fb.pitch = PRESCALE_WIDTH;
-
-    if (config.vi.hide_overscan) {
-        // crop away overscan area from prescale
-        fb.width = maxhpass - minhpass;
-        fb.height = vres << ctrl.serrate;
-        fb.height_out = (vres << 1) * V_SYNC_NTSC / v_sync;
-        int32_t x = h_start + minhpass;
-        int32_t y = (v_start + (emucontrolsvicurrent ? lowerfield : 0)) << ctrl.serrate;
-        fb.pixels += x + y * fb.pitch;
-    } else {
-        // use entire prescale buffer
-        fb.width = PRESCALE_WIDTH;
-        fb.height = (ispal ? V_RES_PAL : V_RES_NTSC) >> !ctrl.serrate;
-        fb.height_out = V_RES_NTSC;
-    }
-
-    // convert to 16:9 if enabled
-    if (config.vi.widescreen) {
-        fb.height_out = fb.height_out * 3 / 4;
-    }
-
+    vi_full_frame_buffer(&fb, prescale);
     vdac_write(&fb);
 
+    vi_stats.latency_usec += parallel_time_usec() - start;
+    vi_stats.frames++;
+
     return fb.width > 0 && fb.height > 0;
 }
 
@@ -515,7 +674,7 @@ static void vi_process_fast_parallel(uint32_t worker_id)
                 case VI_MODE_COLOR:
                     switch (ctrl.type) {
                         case VI_TYPE_RGBA5551: {
-                            uint16_t pix = rdram_read_idx16((frame_buffer >> 1) + line + x);
+                            uint16_t pix = vi_read_idx16((frame_buffer >> 1) + line + x);
                             pixel->r = RGBA16_R(pix);
                             pixel->g = RGBA16_G(pix);
                             pixel->b = RGBA16_B(pix);
@@ -523,7 +682,7 @@ static void vi_process_fast_parallel(uint32_t worker_id)
                         }
 
                         case VI_TYPE_RGBA8888: {
-                            uint32_t pix = rdram_read_idx32((frame_buffer >> 2) + line + x);
+                            uint32_t pix = vi_read_idx32((frame_buffer >> 2) + line + x);
                             pixel->r = RGBA32_R(pix);
                             pixel->g = RGBA32_G(pix);
                             pixel->b = RGBA32_B(pix);
@@ -539,7 +698,7 @@ static void vi_process_fast_parallel(uint32_t worker_id)
 
                 case VI_MODE_DEPTH: {
                     if (zb_address) {
-                        pixel->r = pixel->g = pixel->b = rdram_read_idx16((zb_address >> 1) + line + x) >> 8;
+                        pixel->r = pixel->g = pixel->b = vi_read_idx16((zb_address >> 1) + line + x) >> 8;
                     }
                     break;
                 }
@@ -548,7 +707,7 @@ static void vi_process_fast_parallel(uint32_t worker_id)
                     // TODO: incorrect for RGBA8888?
                     uint8_t hval;
                     uint16_t pix;
-                    rdram_read_pair16(&pix, &hval, (frame_buffer >> 1) + line + x);
+                    vi_read_pair16(&pix, &hval, (frame_buffer >> 1) + line + x);
                     pixel->r = pixel->g = pixel->b = (((pix & 1) << 2) | hval) << 5;
                     break;
                 }
@@ -627,6 +786,9 @@ void n64video_update_screen(void)
         msg_error("Invalid VI mode: %d", config.vi.mode);
     }
 
+    // in pipelined mode, show the frame filtered during the last update
+    bool shown = vi_pipelined && vi_pipeline_finish();
+
     // parse and check some common registers
     vi_reg_ptr = config.gfx.vi_reg;
 
@@ -661,7 +823,7 @@ void n64video_update_screen(void)
 
     // cancel if the frame buffer contains no valid address
     if (!frame_buffer) {
-        vdac_sync(true);
+        vdac_sync(!shown);
         return;
     }
 
@@ -762,11 +924,23 @@ void n64video_update_screen(void)
         }
     }
 
+    if (vi_pipelined) {
+        valid = shown;
+    }
+
     // render frame to screen or blank screen if the frame is invalid
     vdac_sync(!valid);
 }
 
 static void vi_close(void)
 {
+    // send the last filtered frame, so it is not lost on a reinit
+    vi_pipeline_finish();
+
+    free(vi_snapshot);
+    free(vi_snapshot_hidden);
+    vi_snapshot = vi_snapshot_hidden = NULL;
+    vi_pipelined = false;
+
     vdac_close();
 }
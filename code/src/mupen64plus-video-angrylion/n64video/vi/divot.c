@@ -1,5 +1,14 @@
+// 0xff in each lane where a >= b: the 0x100 bias survives the subtraction
+// only there
+static STRICTINLINE uint64_t vi_lanes_ge(uint64_t a, uint64_t b)
+{
+    return ((((a | VI_LANES_MASK(0x100)) - b) >> 8) & VI_LANES_MASK(1)) * 0xff;
+}
+
 static STRICTINLINE void divot_filter(struct rgba* final, struct rgba center, struct rgba left, struct rgba right)
 {
+    uint64_t c, l, r, m, lo, hi;
+
     *final = center;
 
     if ((center.a & left.a & right.a) == 7)
@@ -7,18 +16,22 @@ static STRICTINLINE void divot_filter(struct rgba* final, struct rgba center, st
         return;
     }
 
-    if ((left.r >= center.r && right.r >= left.r) || (left.r >= right.r && center.r >= left.r))
-        final->r = left.r;
-    else if ((right.r >= center.r && left.r >= right.r) || (right.r >= left.r && center.r >= right.r))
-        final->r = right.r;
+    // each of r, g and b becomes the median of the three pixels
+    c = VI_LANES(center);
+    l = VI_LANES(left);
+    r = VI_LANES(right);
+
+    m = vi_lanes_ge(l, r);
+    hi = (l & m) | (r & ~m);
+    lo = (r & m) | (l & ~m);
+
+    m = vi_lanes_ge(hi, c);
+    hi = (c & m) | (hi & ~m);
 
-    if ((left.g >= center.g && right.g >= left.g) || (left.g >= right.g && center.g >= left.g))
-        final->g = left.g;
-    else if ((right.g >= center.g && left.g >= right.g) || (right.g >= left.g && center.g >= right.g))
-        final->g = right.g;
+    m = vi_lanes_ge(lo, hi);
+    c = (lo & m) | (hi & ~m);
 
-    if ((left.b >= center.b && right.b >= left.b) || (left.b >= right.b && center.b >= left.b))
-        final->b = left.b;
-    else if ((right.b >= center.b && left.b >= right.b) || (right.b >= left.b && center.b >= right.b))
-        final->b = right.b;
+    final->r = (uint8_t)c;
+    final->g = (uint8_t)(c >> 16);
+    final->b = (uint8_t)(c >> 32);
 }
@@ -21,6 +21,8 @@ static uint32_t vi_integer_sqrt(uint32_t a)
     return res;
 }
 
+// stays per channel: the curve is a table lookup and the dither noise is a
+// random number drawn in sequence for every pixel
 static STRICTINLINE void gamma_filters(struct rgba* pixel, bool gamma_enable, bool gamma_dither_enable, uint32_t* rstate)
 {
     int cdith, dith;
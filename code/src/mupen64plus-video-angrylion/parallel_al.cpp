@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
@@ -133,8 +134,79 @@ private:
     Parallel(const Parallel&) = delete;
 };
 
+class Async
+{
+public:
+    Async() :
+        m_task(nullptr),
+        m_exit(false),
+        m_thread(&Async::do_work, this)
+    {
+    }
+
+    ~Async() {
+        wait();
+
+        {
+            std::unique_lock<std::mutex> ul(m_mutex);
+            m_exit = true;
+            m_signal_work.notify_one();
+        }
+
+        m_thread.join();
+    }
+
+    void run(void (*task)(void)) {
+        wait();
+
+        std::unique_lock<std::mutex> ul(m_mutex);
+        m_task = task;
+        m_signal_work.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> ul(m_mutex);
+        m_signal_done.wait(ul, [this] {
+            return m_task == nullptr;
+        });
+    }
+
+private:
+    void (*m_task)(void);
+    bool m_exit;
+    std::mutex m_mutex;
+    std::condition_variable m_signal_work;
+    std::condition_variable m_signal_done;
+    std::thread m_thread;
+
+    void do_work() {
+        std::unique_lock<std::mutex> ul(m_mutex);
+
+        while (true) {
+            m_signal_work.wait(ul, [this] {
+                return m_task != nullptr || m_exit;
+            });
+
+            if (m_exit)
+                break;
+
+            // run the task without holding the lock
+            ul.unlock();
+            m_task();
+            ul.lock();
+
+            m_task = nullptr;
+            m_signal_done.notify_all();
+        }
+    }
+
+    void operator=(const Async&) = delete;
+    Async(const Async&) = delete;
+};
+
 // C interface for the Parallel class
 static std::unique_ptr<Parallel> parallel;
+static std::unique_ptr<Async> async;
 
 template<typename T, typename... Args>
 std::unique_ptr<T> make_unique(Args&&... args) {
@@ -146,12 +218,25 @@ void parallel_alinit(uint32_t num)
     // auto-select number of workers based on the number of cores
     if (num == 0) {
         const char *env = getenv("ANGRYLION_NUM_THREADS");
-        if (env)
-            num = atoi(env);
-        else
+        if (env) {
+            // ignore values that aren't a positive number
+            char *end;
+            long n = strtol(env, &end, 10);
+            if (end != env && *end == '\0' && n > 0)
+                num = (uint32_t)std::min(n, (long)PARALLEL_MAX_WORKERS);
+        }
+        if (num == 0)
             num = std::thread::hardware_concurrency();
+        // hardware_concurrency() may return 0 if it can't tell
+        if (num == 0)
+            num = 1;
     }
 
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    // no threads without pthreads support, worker 0 runs on the main thread
+    num = 1;
+#endif
+
     parallel = make_unique<Parallel>(num);
 }
 
@@ -165,7 +250,42 @@ uint32_t parallel_num_workers(void)
     return parallel->num_workers();
 }
 
+uint64_t parallel_time_usec(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int parallel_async_available(void)
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 0;
+#else
+    return 1;
+#endif
+}
+
+void parallel_async_run(void task(void))
+{
+    if (!parallel_async_available()) {
+        task();
+        return;
+    }
+
+    if (!async)
+        async = make_unique<Async>();
+
+    async->run(task);
+}
+
+void parallel_async_wait(void)
+{
+    if (async)
+        async->wait();
+}
+
 void parallel_close(void)
 {
+    async.reset();
     parallel.reset();
 }
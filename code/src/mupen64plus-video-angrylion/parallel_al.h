@@ -14,6 +14,15 @@ void parallel_run(void task(uint32_t));
 
 uint32_t parallel_num_workers(void);
 
+// monotonic clock in microseconds, usable from any thread
+uint64_t parallel_time_usec(void);
+
+// runs a task on a separate thread next to the workers, so it can overlap
+// with parallel_run; only one async task can be in flight
+int parallel_async_available(void);
+void parallel_async_run(void task(void));
+void parallel_async_wait(void);
+
 void parallel_close(void);
 
 #ifdef __cplusplus
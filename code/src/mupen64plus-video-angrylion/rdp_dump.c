@@ -7,21 +7,6 @@ static FILE *rdp_file;
 static uint8_t *rdp_dram_cache;
 static uint8_t *rdp_hidden_dram_cache;
 
-enum rdp_dump_cmd
-{
-	RDP_DUMP_CMD_INVALID = 0,
-	RDP_DUMP_CMD_UPDATE_DRAM = 1,
-	RDP_DUMP_CMD_RDP_COMMAND = 2,
-	RDP_DUMP_CMD_SET_VI_REGISTER = 3,
-	RDP_DUMP_CMD_END_FRAME = 4,
-	RDP_DUMP_CMD_SIGNAL_COMPLETE = 5,
-	RDP_DUMP_CMD_EOF = 6,
-	RDP_DUMP_CMD_UPDATE_DRAM_FLUSH = 7,
-	RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM = 8,
-	RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM_FLUSH = 9,
-	RDP_DUMP_CMD_INT_MAX = 0x7fffffff
-};
-
 bool rdp_dump_init(const char *path, uint32_t dram_size, uint32_t hidden_dram_size)
 {
 	if (rdp_file)
@@ -4,6 +4,24 @@
 #include <stdint.h>
 #include <boolean.h>
 
+/* File layout: "RDPDUMP2", uint32 dram size, uint32 hidden dram size,
+ * then a stream of commands, each a uint32 enum rdp_dump_cmd followed by
+ * its payload. Replayed by src/tools/rdpreplay.c. */
+enum rdp_dump_cmd
+{
+	RDP_DUMP_CMD_INVALID = 0,
+	RDP_DUMP_CMD_UPDATE_DRAM = 1,
+	RDP_DUMP_CMD_RDP_COMMAND = 2,
+	RDP_DUMP_CMD_SET_VI_REGISTER = 3,
+	RDP_DUMP_CMD_END_FRAME = 4,
+	RDP_DUMP_CMD_SIGNAL_COMPLETE = 5,
+	RDP_DUMP_CMD_EOF = 6,
+	RDP_DUMP_CMD_UPDATE_DRAM_FLUSH = 7,
+	RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM = 8,
+	RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM_FLUSH = 9,
+	RDP_DUMP_CMD_INT_MAX = 0x7fffffff
+};
+
 bool rdp_dump_init(const char *path, uint32_t dram_size, uint32_t hidden_dram_size);
 void rdp_dump_end(void);
 void rdp_dump_flush_dram(const void *dram, uint32_t size);
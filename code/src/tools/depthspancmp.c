@@ -0,0 +1,128 @@
+/* depthspancmp
+ * Checks the depth buffer span writer of Glide64
+ * (glide2gl/src/Glide64/DepthBufferSpan.h) against the per pixel loop it
+ * replaced, kept below as it was. Every case runs both on the same random
+ * depth buffer and zLUT and compares the whole buffer byte for byte.
+ * z and dzdx are drawn from the whole int range, so spans that wrap z
+ * are covered too.
+ *
+ * Usage: depthspancmp [-n cases] [-s seed]
+ *     -n  number of random spans, 100000 by default
+ *     -s  seed of the case generator
+ *
+ * Exits with 1 and prints the first differing span if any doesn't match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <retro_inline.h>
+
+#include "../glide2gl/src/Glide64/DepthBufferSpan.h"
+
+#define ZLUT_SIZE    0x40000
+#define MAX_WIDTH    640
+#define MAX_SHIFT    (640 * 8)
+#define BUF_PIXELS   (MAX_SHIFT + MAX_WIDTH + 2)
+
+static uint16_t zLUT[ZLUT_SIZE];
+static uint16_t buf_old[BUF_PIXELS];
+static uint16_t buf_new[BUF_PIXELS];
+
+/* the span loop of DepthBufferRasterize() before DepthBufferSpan.h */
+static void old_span(uint16_t *ptr_dst, int shift, int z, int dzdx, int width)
+{
+         unsigned x;
+
+         /* draw to depth buffer */
+         for (x = 0; x < width; x++)
+         {
+            int idx;
+            uint16_t encodedZ;
+            int trueZ = z / 8192;
+            if (trueZ < 0)
+               trueZ = 0;
+            else if (trueZ > 0x3FFFF)
+               trueZ = 0x3FFFF;
+            encodedZ = zLUT[trueZ];
+            idx = (shift+x)^1;
+            if(encodedZ < ptr_dst[idx])
+               ptr_dst[idx] = encodedZ;
+            z += dzdx;
+         }
+}
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static void fill(uint16_t *buf, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		buf[i] = (uint16_t)rng();
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t cases = 100000, seed = 1, i, mismatches = 0;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			cases = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			seed = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n cases] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rng_state = seed ? seed : 1;
+	fill(zLUT, ZLUT_SIZE);
+
+	for (i = 0; i < cases; i++)
+	{
+		int width = rng() % (MAX_WIDTH + 1);
+		int shift = rng() % (MAX_SHIFT + 1);
+		int z     = (int)rng();
+		int dzdx  = (int)rng();
+		size_t j;
+
+		/* mostly the slopes of real triangles, sometimes any slope */
+		if (rng() & 3)
+			dzdx >>= 8 + rng() % 16;
+
+		fill(buf_old, BUF_PIXELS);
+		memcpy(buf_new, buf_old, sizeof(buf_new));
+
+		old_span(buf_old, shift, z, dzdx, width);
+		DepthBufferSpan(buf_new, shift, z, dzdx, width, zLUT);
+
+		if (!memcmp(buf_old, buf_new, sizeof(buf_new)))
+			continue;
+
+		if (!mismatches++)
+		{
+			for (j = 0; j < BUF_PIXELS && buf_old[j] == buf_new[j]; j++)
+				;
+			printf("shift %d, z %d, dzdx %d, width %d differs at pixel %u: %04x, was %04x\n",
+					shift, z, dzdx, width, (unsigned)j, buf_new[j], buf_old[j]);
+		}
+	}
+
+	printf("DepthBufferSpan %u cases, %u differ\n", cases, mismatches);
+	return mismatches != 0;
+}
@@ -0,0 +1,212 @@
+/* dmacopycmp
+ * Checks dma_copy() of mupen64plus-core (src/memory/dma_copy.c) against the
+ * per byte loops it replaced in the PI, SP and save memory DMAs, kept below
+ * as they were. Every case runs both on the same random source and
+ * destination and compares the whole destination byte for byte, so bytes
+ * written outside the transfer are caught too.
+ *
+ * First every alignment of both addresses is run with every length up to
+ * 64, which covers the odd lengths, the ones under the word path threshold
+ * and heads and tails that straddle a word. Then random PI style copies of
+ * up to a few KB, SP style transfers of several rows with a skip between
+ * them, and flashram erases.
+ *
+ * Usage: dmacopycmp [-n cases] [-s seed]
+ *     -n  number of random cases per kind, 100000 by default
+ *     -s  seed of the case generator
+ *
+ * Exits with 1 and prints the first differing case of every kind that
+ * doesn't match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../mupen64plus-core/src/memory/dma_copy.c"
+
+#define BUF_SIZE      0x4000
+#define MAX_SMALL     64
+#define MAX_PI        0x2000
+#define SP_MEM_SIZE   0x1000
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dst_old[BUF_SIZE];
+static uint8_t dst_new[BUF_SIZE];
+
+/* dma_pi_write(), dma_write_sram() and friends before dma_copy() */
+static void old_copy(uint8_t *dst, uint32_t dst_addr,
+      const uint8_t *src, uint32_t src_addr, uint32_t length)
+{
+   uint32_t i;
+
+   for (i = 0; i < length; ++i)
+      dst[(dst_addr + i) ^ S8] = src[(src_addr + i) ^ S8];
+}
+
+/* dma_sp_write() and dma_sp_read() before dma_copy() */
+static void old_sp(uint8_t *spmem, uint8_t *dram, unsigned memaddr, unsigned dramaddr,
+      unsigned length, unsigned count, unsigned skip)
+{
+    unsigned int i,j;
+
+    for(j = 0; j < count; j++)
+    {
+        for(i = 0; i < length; i++)
+        {
+            spmem[memaddr^S8] = dram[dramaddr^S8];
+            memaddr++;
+            dramaddr++;
+        }
+        dramaddr+=skip;
+    }
+}
+
+static void new_sp(uint8_t *spmem, uint8_t *dram, unsigned memaddr, unsigned dramaddr,
+      unsigned length, unsigned count, unsigned skip)
+{
+    unsigned int j;
+
+    for(j = 0; j < count; j++)
+    {
+        dma_copy(spmem, memaddr, dram, dramaddr, length);
+        memaddr+=length;
+        dramaddr+=length+skip;
+    }
+}
+
+/* the FLASHRAM_MODE_ERASE loop before the memset */
+static void old_erase(uint8_t *data, unsigned erase_offset)
+{
+   unsigned int i;
+
+   for (i=erase_offset; i<(erase_offset+128); ++i)
+      data[i^S8] = 0xff;
+}
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static void fill(uint8_t *buf, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+		buf[i] = (uint8_t)rng();
+}
+
+static void prepare(void)
+{
+	fill(src_buf, BUF_SIZE);
+	fill(dst_old, BUF_SIZE);
+	memcpy(dst_new, dst_old, BUF_SIZE);
+}
+
+/* counts a mismatch of the case just run, prints the first one of a kind */
+static int differs(const char *kind, uint32_t *mismatches,
+		uint32_t dst_addr, uint32_t src_addr, uint32_t length, uint32_t count, uint32_t skip)
+{
+	size_t j;
+
+	if (!memcmp(dst_old, dst_new, BUF_SIZE))
+		return 0;
+
+	if (!(*mismatches)++)
+	{
+		for (j = 0; j < BUF_SIZE && dst_old[j] == dst_new[j]; j++)
+			;
+		printf("%s dst %x, src %x, length %u, count %u, skip %u differs at byte %x: %02x, was %02x\n",
+				kind, dst_addr, src_addr, length, count, skip, (unsigned)j, dst_new[j], dst_old[j]);
+	}
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t cases = 100000, seed = 1, i, total = 0;
+	uint32_t small = 0, pi = 0, sp = 0, erase = 0;
+	uint32_t dst_addr, src_addr, length;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			cases = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			seed = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n cases] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rng_state = seed ? seed : 1;
+
+	/* every alignment pair with every short length */
+	for (dst_addr = 0x100; dst_addr < 0x108; dst_addr++)
+		for (src_addr = 0x200; src_addr < 0x208; src_addr++)
+			for (length = 0; length <= MAX_SMALL; length++)
+			{
+				prepare();
+				old_copy(dst_old, dst_addr, src_buf, src_addr, length);
+				dma_copy(dst_new, dst_addr, src_buf, src_addr, length);
+				differs("small", &small, dst_addr, src_addr, length, 1, 0);
+				total++;
+			}
+	printf("small %u cases, %u differ\n", total, small);
+
+	for (i = 0; i < cases; i++)
+	{
+		length   = rng() % (MAX_PI + 1);
+		dst_addr = rng() % (BUF_SIZE - MAX_PI);
+		src_addr = rng() % (BUF_SIZE - MAX_PI);
+
+		/* same alignment most of the time, as the word path needs it */
+		if (rng() & 1)
+			src_addr = (src_addr & ~3u) | (dst_addr & 3);
+
+		prepare();
+		old_copy(dst_old, dst_addr, src_buf, src_addr, length);
+		dma_copy(dst_new, dst_addr, src_buf, src_addr, length);
+		differs("pi", &pi, dst_addr, src_addr, length, 1, 0);
+	}
+	printf("pi %u cases, %u differ\n", cases, pi);
+
+	for (i = 0; i < cases; i++)
+	{
+		/* SP_RD_LEN_REG: length, count and skip, all in 8 byte units on
+		 * hardware, any value here */
+		uint32_t count = 1 + rng() % 8;
+		uint32_t skip  = rng() % 0x100;
+
+		length   = rng() % (SP_MEM_SIZE / count + 1);
+		dst_addr = rng() % (SP_MEM_SIZE - length * count + 1);
+		src_addr = rng() % (BUF_SIZE - (length + skip) * count + 1);
+
+		prepare();
+		old_sp(dst_old, src_buf, dst_addr, src_addr, length, count, skip);
+		new_sp(dst_new, src_buf, dst_addr, src_addr, length, count, skip);
+		differs("sp", &sp, dst_addr, src_addr, length, count, skip);
+	}
+	printf("sp %u cases, %u differ\n", cases, sp);
+
+	for (i = 0; i < BUF_SIZE / 128; i++)
+	{
+		prepare();
+		old_erase(dst_old, i * 128);
+		memset(dst_new + i * 128, 0xff, 128);
+		differs("erase", &erase, i * 128, 0, 128, 1, 0);
+	}
+	printf("erase %u cases, %u differ\n", BUF_SIZE / 128, erase);
+
+	return small || pi || sp || erase;
+}
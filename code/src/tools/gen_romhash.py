@@ -0,0 +1,254 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# usage: gen_romhash.py rom_luts.c Glide64mk2.ini [rom_db.c]
+#
+# Folds the per-setting lookup tables of rom_luts.c into one table with an
+# entry per ROM and writes it out with a perfect hash index, so open_rom()
+# finds every setting of a ROM with a single probe.
+#
+# The Glide64 sections of Glide64mk2.ini go into the same table, keyed by
+# header name: every pattern of a section gets an entry that points at the
+# sections the ROM with that name matches, and the sections themselves are
+# written out in order for the names that are not in the table.
+import re
+import sys
+
+OUTPUT_FILE = 'rom_db.c'
+
+# flag per table, in the order rom.c used to apply them
+FLAG_TABLES = [
+    ('lut_ee16k',         'ROM_DB_EEPROM_16KB'),
+    ('lut_audiosignal',   'ROM_DB_AUDIO_SIGNAL'),
+    ('lut_fixedaudiopos', 'ROM_DB_FIXED_AUDIO_POS'),
+    ('lut_alternate_vi',  'ROM_DB_ALTERNATE_VI'),
+    ('lut_vi_clock_1500', 'ROM_DB_VI_CLOCK_1500'),
+    ('lut_vi_clock_1600', 'ROM_DB_VI_CLOCK_1600'),
+    ('lut_vi_clock_2200', 'ROM_DB_VI_CLOCK_2200'),
+    ('lut_ee4k',          'ROM_DB_EEPROM_4KB'),
+    ('lut_flashram',      'ROM_DB_FLASH_RAM'),
+]
+
+# (table, flag, field)
+VALUE_TABLES = [
+    ('lut_cpop',          'ROM_DB_COUNT_PER_OP',   'count_per_op'),
+    ('lut_sidmaduration', 'ROM_DB_SI_DMA_DURATION', 'sidmaduration'),
+    ('lut_delaysi',       'ROM_DB_DELAY_SI',       'delay_si'),
+]
+
+MASK64 = (1 << 64) - 1
+
+# must match rom_db_hash() in rom.c
+def rom_db_hash(id, seed):
+    h = ((id ^ ((seed * 0x9E3779B97F4A7C15) & MASK64)) * 0xFF51AFD7ED558CCD) & MASK64
+    return (h >> 32) ^ (h & 0xFFFFFFFF)
+
+def parse_tables(path):
+    tables = dict()
+    name = None
+    entryRe = re.compile(r'0x([0-9A-Fa-f]+)ULL\s*(?:,\s*(0x[0-9A-Fa-f]+|\d+))?\s*\}?\s*,?\s*(/\*.*\*/)?')
+    for line in open(path):
+        m = re.match(r'static const uint64_t (\w+)\[', line)
+        if m:
+            name = m.group(1)
+            tables[name] = []
+            continue
+        if line.startswith('};'):
+            name = None
+            continue
+        if name is None:
+            continue
+        m = entryRe.search(line)
+        if m:
+            value = m.group(2)
+            if value is not None:
+                value = int(value, 0)
+            comment = (m.group(3) or '').strip('/* ')
+            tables[name].append((int(m.group(1), 16), value, comment))
+    return tables
+
+# must match rom_db_name_id() in rom.c
+def name_id(name):
+    h = 0xCBF29CE484222325
+    for c in bytearray(name):
+        h = ((h ^ c) * 0x100000001B3) & MASK64
+    return h
+
+def unescape(text):
+    return re.sub(br'\\x([0-9A-Fa-f]{2})', lambda m: bytes(bytearray([int(m.group(1), 16)])),
+                  text.encode('latin-1'))
+
+def parse_gfx(path):
+    # [patterns] and [hacks: patterns] sections, in file order
+    lists = { 'titles': [], 'hacks': [] }
+    section = None
+    for line in open(path, 'rb'):
+        line = line.decode('latin-1').strip()
+        if not line or line.startswith(';'):
+            continue
+        m = re.match(r'\[(hacks: )?(.*)\]$', line)
+        if m:
+            patterns = [[unescape(part) for part in alt.split('+')]
+                        for alt in m.group(2).split('|')]
+            # header names are 20 bytes, rom_db_gfx_matches() has no room for more
+            if any(not 0 < len(part) <= 20 for alt in patterns for part in alt):
+                sys.stderr.write("%s: bad pattern in '%s'\n" % (path, line))
+                sys.exit(1)
+            section = { 'patterns': patterns, 'settings': [] }
+            lists['hacks' if m.group(1) else 'titles'].append(section)
+            continue
+        m = re.match(r'(\w+)\s*=\s*(\S+)$', line)
+        if not m or section is None:
+            sys.stderr.write("%s: cannot parse '%s'\n" % (path, line))
+            sys.exit(1)
+        section['settings'].append('%s=%s' % m.groups())
+    return lists
+
+def gfx_matches(section, name):
+    return any(all(part in name for part in alt) for alt in section['patterns'])
+
+# index + 1 of the first section that matches, like the strstr() chains
+def gfx_first(sections, name):
+    for i, section in enumerate(sections):
+        if gfx_matches(section, name):
+            return i + 1
+    return 0
+
+def c_string(data):
+    out = ''
+    for c in bytearray(data):
+        if c in (0x22, 0x3F, 0x5C):
+            out += '\\' + chr(c)
+        elif 0x20 <= c < 0x7F:
+            out += chr(c)
+        elif c == 0x0A:
+            out += '\\n'
+        else:
+            out += '\\%03o' % c
+    return '"' + out + '"'
+
+def c_comment(data):
+    return ''.join(chr(c) if 0x20 <= c < 0x7F and c != 0x2A else '\\x%02X' % c
+                   for c in bytearray(data))
+
+def build_hash(ids):
+    # hash and displace: every bucket gets the first seed that puts all
+    # its keys in free slots, biggest buckets first
+    size = len(ids)
+    nbuckets = max(1, (size + 1) // 2)
+    buckets = [[] for _ in range(nbuckets)]
+    for id in ids:
+        buckets[rom_db_hash(id, 0) % nbuckets].append(id)
+
+    disp = [0] * nbuckets
+    slots = [None] * size
+    order = sorted(range(nbuckets), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            taken = [rom_db_hash(id, seed) % size for id in buckets[b]]
+            if len(set(taken)) == len(taken) and all(slots[s] is None for s in taken):
+                break
+            seed = seed + 1
+            if seed > 0xFFFF:
+                sys.stderr.write("no displacement found, try again with more slots\n")
+                sys.exit(1)
+        disp[b] = seed
+        for id, s in zip(buckets[b], taken):
+            slots[s] = id
+    return disp, slots
+
+if len(sys.argv) < 3:
+    print("usage: %s rom_luts.c Glide64mk2.ini [rom_db.c]" % sys.argv[0])
+    sys.exit(0)
+
+if len(sys.argv) > 3:
+    OUTPUT_FILE = sys.argv[3]
+
+sys.stderr.write("Parsing " + sys.argv[1] + "...\n")
+tables = parse_tables(sys.argv[1])
+sys.stderr.write("Parsing " + sys.argv[2] + "...\n")
+gfx = parse_gfx(sys.argv[2])
+
+games = dict()
+
+def game(id, comment):
+    if id not in games:
+        games[id] = { 'flags': [], 'count_per_op': 0, 'sidmaduration': 0,
+                      'delay_si': 0, 'gfx_title': 0, 'gfx_hacks': 0, 'name': comment }
+    return games[id]
+
+for table, flag in FLAG_TABLES:
+    for id, _, comment in tables.get(table, []):
+        g = game(id, comment)
+        if flag not in g['flags']:
+            g['flags'].append(flag)
+
+# rom.c stopped at the first match of these
+for table, flag, field in VALUE_TABLES:
+    for id, value, comment in tables.get(table, []):
+        g = game(id, comment)
+        if flag in g['flags']:
+            continue
+        g['flags'].append(flag)
+        g[field] = value
+
+for section in gfx['titles'] + gfx['hacks']:
+    for alt in section['patterns']:
+        if len(alt) > 1:
+            continue
+        name = alt[0]
+        id = name_id(name)
+        if id in games and 'ROM_DB_NAME' not in games[id]['flags']:
+            sys.stderr.write("name id of %s is the id of %s\n" % (c_comment(name), games[id]['name']))
+            sys.exit(1)
+        g = game(id, 'Glide64: ' + c_comment(name))
+        g['flags'] = ['ROM_DB_NAME']
+        g['gfx_title'] = gfx_first(gfx['titles'], name)
+        g['gfx_hacks'] = gfx_first(gfx['hacks'], name)
+
+ids = sorted(games.keys())
+disp, slots = build_hash(ids)
+
+romdb = open(OUTPUT_FILE, 'w')
+romdb.write("/* This file was generated by gen_romhash.py from rom_luts.c and Glide64mk2.ini, */\n")
+romdb.write("/* edit those and run it again instead of editing this file */\n")
+romdb.write("\n")
+romdb.write("#define ROM_DB_SIZE %d\n" % len(slots))
+romdb.write("#define ROM_DB_BUCKETS %d\n" % len(disp))
+romdb.write("\n")
+romdb.write("static const uint16_t rom_db_disp[ROM_DB_BUCKETS] = {\n")
+for i in range(0, len(disp), 12):
+    row = ', '.join('%5d' % d for d in disp[i:i + 12])
+    comma = ',' if i + 12 < len(disp) else ''
+    romdb.write('   ' + row + comma + '\n')
+romdb.write("};\n")
+romdb.write("\n")
+romdb.write("static const struct rom_db_entry rom_db[ROM_DB_SIZE] = {\n")
+for i, id in enumerate(slots):
+    g = games[id]
+    comma = ',' if i < len(slots) - 1 else ' '
+    flags = ' | '.join(g['flags'])
+    romdb.write('   { 0x%016XULL, %s, %d, %d, 0x%X, %d, %d }%s /* %s */\n' % (
+        id, flags, g['count_per_op'], g['delay_si'], g['sidmaduration'],
+        g['gfx_title'], g['gfx_hacks'], comma, g['name']))
+romdb.write("};\n")
+
+for kind, define in (('titles', 'ROM_DB_GFX_TITLES'), ('hacks', 'ROM_DB_GFX_HACKS')):
+    sections = gfx[kind]
+    romdb.write("\n")
+    romdb.write("#define %s %d\n" % (define, len(sections)))
+    romdb.write("\n")
+    romdb.write("static const struct rom_db_gfx rom_db_gfx_%s[%s] = {\n" % (kind, define))
+    for i, section in enumerate(sections):
+        comma = ',' if i < len(sections) - 1 else ''
+        patterns = b'|'.join(b'+'.join(alt) for alt in section['patterns'])
+        settings = ''.join(line + '\n' for line in section['settings'])
+        romdb.write('   { %s,\n      %s }%s\n' % (
+            c_string(patterns), c_string(settings.encode('latin-1')), comma))
+    romdb.write("};\n")
+romdb.close()
+
+print("Wrote " + OUTPUT_FILE + " (%d entries, %d + %d Glide64 sections)" % (
+    len(slots), len(gfx['titles']), len(gfx['hacks'])))
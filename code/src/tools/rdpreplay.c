@@ -0,0 +1,578 @@
+/* rdpreplay
+ * Replays an RDP dump (written by angrylion when built with HAVE_RDP_DUMP
+ * and run with RDP_DUMP=<file>) through the angrylion renderer without the
+ * CPU core, hashes every frame (VI output and RDRAM contents) and reports
+ * the time spent per RDP command type.
+ *
+ * Usage: rdpreplay [-w workers] [-p] [-l loops] [-o hashes.txt] [-c hashes.txt] dump.rdp
+ *     -w  number of render workers, 1 (default) gives per-command timings
+ *     -p  run the VI filters pipelined on their own thread
+ *     -l  replay the dump this many times for timing
+ *     -o  write the frame hashes to a file
+ *     -c  compare the frame hashes against a file written with -o
+ *
+ * The VI gamma dither noise is seeded per worker, so VI output hashes only
+ * match between runs with the same -w; RDRAM hashes always match. Pipelined
+ * VI output is filtered by a single thread and matches -w 1.
+ */
+
+#if defined(_WIN32)
+# include <windows.h>
+#else
+# include <time.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdarg.h>
+
+/* the renderer is built into this file, as n64video.c does for its parts */
+#include "../mupen64plus-video-angrylion/n64video.c"
+#include "../mupen64plus-video-angrylion/rdp_dump.h"
+
+static const char *cmd_names[64] = {
+	[CMD_ID_NO_OP]                           = "no_op",
+	[CMD_ID_FILL_TRIANGLE]                   = "tri",
+	[CMD_ID_FILL_ZBUFFER_TRIANGLE]           = "tri_z",
+	[CMD_ID_TEXTURE_TRIANGLE]                = "tri_tex",
+	[CMD_ID_TEXTURE_ZBUFFER_TRIANGLE]        = "tri_tex_z",
+	[CMD_ID_SHADE_TRIANGLE]                  = "tri_shade",
+	[CMD_ID_SHADE_ZBUFFER_TRIANGLE]          = "tri_shade_z",
+	[CMD_ID_SHADE_TEXTURE_TRIANGLE]          = "tri_texshade",
+	[CMD_ID_SHADE_TEXTURE_Z_BUFFER_TRIANGLE] = "tri_texshade_z",
+	[CMD_ID_TEXTURE_RECTANGLE]               = "tex_rect",
+	[CMD_ID_TEXTURE_RECTANGLE_FLIP]          = "tex_rect_flip",
+	[CMD_ID_SYNC_LOAD]                       = "sync_load",
+	[CMD_ID_SYNC_PIPE]                       = "sync_pipe",
+	[CMD_ID_SYNC_TILE]                       = "sync_tile",
+	[CMD_ID_SYNC_FULL]                       = "sync_full",
+	[CMD_ID_SET_KEY_GB]                      = "set_key_gb",
+	[CMD_ID_SET_KEY_R]                       = "set_key_r",
+	[CMD_ID_SET_CONVERT]                     = "set_convert",
+	[CMD_ID_SET_SCISSOR]                     = "set_scissor",
+	[CMD_ID_SET_PRIM_DEPTH]                  = "set_prim_depth",
+	[CMD_ID_SET_OTHER_MODES]                 = "set_other_modes",
+	[CMD_ID_LOAD_TLUT]                       = "load_tlut",
+	[CMD_ID_SET_TILE_SIZE]                   = "set_tile_size",
+	[CMD_ID_LOAD_BLOCK]                      = "load_block",
+	[CMD_ID_LOAD_TILE]                       = "load_tile",
+	[CMD_ID_SET_TILE]                        = "set_tile",
+	[CMD_ID_FILL_RECTANGLE]                  = "fill_rect",
+	[CMD_ID_SET_FILL_COLOR]                  = "set_fill_color",
+	[CMD_ID_SET_FOG_COLOR]                   = "set_fog_color",
+	[CMD_ID_SET_BLEND_COLOR]                 = "set_blend_color",
+	[CMD_ID_SET_PRIM_COLOR]                  = "set_prim_color",
+	[CMD_ID_SET_ENV_COLOR]                   = "set_env_color",
+	[CMD_ID_SET_COMBINE]                     = "set_combine",
+	[CMD_ID_SET_TEXTURE_IMAGE]               = "set_texture_image",
+	[CMD_ID_SET_MASK_IMAGE]                  = "set_mask_image",
+	[CMD_ID_SET_COLOR_IMAGE]                 = "set_color_image",
+};
+
+static struct
+{
+	uint8_t *rdram;
+	uint32_t rdram_size;
+	uint32_t hidden_size;
+	uint32_t dmem[0x400];
+	uint32_t vi_regs[VI_NUM_REG];
+	uint32_t dp_regs[DP_NUM_REG];
+	uint32_t mi_intr;
+} hw;
+
+static struct
+{
+	uint64_t usec[64];
+	uint64_t count[64];
+	uint64_t vi_usec;
+	uint64_t vi_filter_usec;
+	uint64_t vi_latency_usec;
+	uint32_t vi_frames;
+	uint64_t total_usec;
+	uint64_t pixels[4];
+	uint32_t frames;
+} stats;
+
+struct frame_hash
+{
+	uint64_t vi;
+	uint64_t rdram;
+};
+
+static struct frame_hash *frame_hashes;
+static uint32_t frame_hashes_cap;
+static uint32_t frame_index;
+static uint64_t vi_hash;
+
+/* with -p the VI output of a frame arrives on the next update (or on close),
+ * this is the frame it belongs to, -1 if none is pending */
+static int pipelined;
+static int64_t vi_pending_frame = -1;
+
+static uint64_t time_usec(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (uint64_t)(count.QuadPart * 1000000 / freq.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+/* FNV-1a */
+static uint64_t hash_bytes(uint64_t h, const void *data, size_t size)
+{
+	const uint8_t *p = data;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		h ^= p[i];
+		h *= 0x100000001b3ULL;
+	}
+	return h;
+}
+
+void msg_error(const char *err, ...)
+{
+	va_list ap;
+	va_start(ap, err);
+	fprintf(stderr, "error: ");
+	vfprintf(stderr, err, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+void msg_warning(const char *err, ...)
+{
+	va_list ap;
+	va_start(ap, err);
+	fprintf(stderr, "warning: ");
+	vfprintf(stderr, err, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+}
+
+void msg_debug(const char *err, ...)
+{
+}
+
+void vdac_init(struct n64video_config *config) { }
+void vdac_read(struct frame_buffer *fb, bool alpha) { }
+void vdac_sync(bool invalid) { }
+void vdac_close(void) { }
+
+void vdac_write(struct frame_buffer *fb)
+{
+	uint64_t h = 0xcbf29ce484222325ULL;
+	uint32_t y;
+
+	h = hash_bytes(h, &fb->width, sizeof(fb->width));
+	h = hash_bytes(h, &fb->height, sizeof(fb->height));
+	for (y = 0; y < fb->height; y++)
+		h = hash_bytes(h, fb->pixels + y * fb->pitch, fb->width * sizeof(*fb->pixels));
+
+	if (!pipelined)
+		vi_hash = h;
+	else if (vi_pending_frame >= 0)
+	{
+		frame_hashes[vi_pending_frame].vi = h;
+		vi_pending_frame = -1;
+	}
+}
+
+static void record_frame(void)
+{
+	if (frame_index >= frame_hashes_cap)
+	{
+		frame_hashes_cap = frame_hashes_cap ? frame_hashes_cap * 2 : 256;
+		frame_hashes = realloc(frame_hashes, frame_hashes_cap * sizeof(*frame_hashes));
+		if (!frame_hashes)
+			msg_error("out of memory");
+	}
+	frame_hashes[frame_index].vi = pipelined ? 0 : vi_hash;
+	frame_hashes[frame_index].rdram = hash_bytes(0xcbf29ce484222325ULL, hw.rdram, hw.rdram_size);
+	frame_index++;
+}
+
+static void mi_intr(void)
+{
+}
+
+static void run_command(const uint32_t *words, uint32_t count)
+{
+	uint32_t id = (words[0] >> 24) & 0x3f;
+	uint64_t start;
+
+	memcpy(hw.dmem, words, count * sizeof(*words));
+	hw.dp_regs[DP_STATUS] = DP_STATUS_XBUS_DMA;
+	hw.dp_regs[DP_START] = hw.dp_regs[DP_CURRENT] = 0;
+	hw.dp_regs[DP_END] = count * sizeof(*words);
+
+	start = time_usec();
+	n64video_process_list();
+	stats.usec[id] += time_usec() - start;
+	stats.count[id]++;
+}
+
+static void renderer_open(uint32_t workers)
+{
+	static uint32_t *vi_ptrs[VI_NUM_REG];
+	static uint32_t *dp_ptrs[DP_NUM_REG];
+	struct n64video_config cfg;
+	uint32_t i;
+
+	for (i = 0; i < VI_NUM_REG; i++)
+		vi_ptrs[i] = &hw.vi_regs[i];
+	for (i = 0; i < DP_NUM_REG; i++)
+		dp_ptrs[i] = &hw.dp_regs[i];
+
+	n64video_config_init(&cfg);
+	cfg.gfx.rdram = hw.rdram;
+	cfg.gfx.rdram_size = hw.rdram_size;
+	cfg.gfx.dmem = (uint8_t*)hw.dmem;
+	cfg.gfx.vi_reg = vi_ptrs;
+	cfg.gfx.dp_reg = dp_ptrs;
+	cfg.gfx.mi_intr_reg = &hw.mi_intr;
+	cfg.gfx.mi_intr_cb = mi_intr;
+	cfg.parallel = workers > 1;
+	cfg.num_workers = workers;
+	cfg.vi.pipelined = pipelined;
+	/* the VI filters the libretro core turns on in update_variables() */
+	cfg.vi.vi_dedither = true;
+	cfg.vi.vi_blur = true;
+
+	n64video_init(&cfg);
+}
+
+#define READ(ptr, size) \
+	do { \
+		if ((size) > len || pos > len - (size)) \
+			msg_error("truncated dump at offset %u", pos); \
+		memcpy((ptr), data + pos, (size)); \
+		pos += (size); \
+	} while (0)
+
+/* after n64video_close(), which shows the last pipelined frame */
+static void collect_vi_stats(void)
+{
+	uint64_t filter_usec, latency_usec;
+	uint32_t frames;
+
+	n64video_vi_stats(&filter_usec, &latency_usec, &frames);
+	stats.vi_filter_usec += filter_usec;
+	stats.vi_latency_usec += latency_usec;
+	stats.vi_frames += frames;
+}
+
+/* Runs the whole dump once, recording the frame hashes if asked to. */
+static void replay(const uint8_t *data, uint32_t len, uint32_t workers, int recording)
+{
+	uint32_t pos = 16;
+	uint32_t cmd, offset, size, value, words[CMD_MAX_INTS];
+	uint64_t start, frame_start;
+	uint32_t pixels[4];
+	uint32_t i;
+
+	memset(hw.rdram, 0, hw.rdram_size);
+	memset(hw.vi_regs, 0, sizeof(hw.vi_regs));
+	renderer_open(workers);
+	memset(rdram_hidden, 0, sizeof(rdram_hidden));
+	n64video_pixel_stats(pixels);
+
+	frame_start = time_usec();
+
+	for (;;)
+	{
+		READ(&cmd, sizeof(cmd));
+
+		switch (cmd)
+		{
+		case RDP_DUMP_CMD_UPDATE_DRAM:
+		case RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM:
+			READ(&offset, sizeof(offset));
+			READ(&size, sizeof(size));
+			if (cmd == RDP_DUMP_CMD_UPDATE_DRAM)
+			{
+				if (size > hw.rdram_size || offset > hw.rdram_size - size)
+					msg_error("dram update out of range at offset %u", pos);
+				READ(hw.rdram + offset, size);
+			}
+			else
+			{
+				if (size > sizeof(rdram_hidden) || offset > sizeof(rdram_hidden) - size)
+					msg_error("hidden dram update out of range at offset %u", pos);
+				READ(rdram_hidden + offset, size);
+			}
+			break;
+
+		case RDP_DUMP_CMD_UPDATE_DRAM_FLUSH:
+		case RDP_DUMP_CMD_UPDATE_HIDDEN_DRAM_FLUSH:
+			break;
+
+		case RDP_DUMP_CMD_RDP_COMMAND:
+			READ(&value, sizeof(value));
+			READ(&size, sizeof(size));
+			if (size == 0 || size > CMD_MAX_INTS)
+				msg_error("bad command length %u at offset %u", size, pos);
+			READ(words, size * sizeof(*words));
+			run_command(words, size);
+			break;
+
+		case RDP_DUMP_CMD_SIGNAL_COMPLETE:
+			words[0] = CMD_ID_SYNC_FULL << 24;
+			words[1] = 0;
+			run_command(words, 2);
+			break;
+
+		case RDP_DUMP_CMD_SET_VI_REGISTER:
+			READ(&offset, sizeof(offset));
+			READ(&value, sizeof(value));
+			if (offset < VI_NUM_REG)
+				hw.vi_regs[offset] = value;
+			break;
+
+		case RDP_DUMP_CMD_END_FRAME:
+			vi_hash = 0;
+			start = time_usec();
+			n64video_update_screen();
+			stats.vi_usec += time_usec() - start;
+			if (recording)
+			{
+				record_frame();
+				if (vi_pipeline_pending)
+					vi_pending_frame = frame_index - 1;
+			}
+			stats.total_usec += time_usec() - frame_start;
+			stats.frames++;
+			frame_start = time_usec();
+			break;
+
+		case RDP_DUMP_CMD_EOF:
+			n64video_pixel_stats(pixels);
+			for (i = 0; i < 4; i++)
+				stats.pixels[i] += pixels[i];
+			n64video_close();
+			collect_vi_stats();
+			return;
+
+		default:
+			msg_error("unknown dump command %u at offset %u", cmd, pos - 4);
+		}
+
+		if (pos == len)
+		{
+			/* dump was not closed cleanly */
+			n64video_pixel_stats(pixels);
+			for (i = 0; i < 4; i++)
+				stats.pixels[i] += pixels[i];
+			n64video_close();
+			collect_vi_stats();
+			return;
+		}
+	}
+}
+
+static uint8_t *load_file(const char *path, uint32_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *data;
+	long size;
+
+	if (!f)
+		return NULL;
+
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	data = malloc(size ? size : 1);
+	if (!data || fread(data, 1, size, f) != (size_t)size)
+	{
+		free(data);
+		fclose(f);
+		return NULL;
+	}
+
+	fclose(f);
+	*len = (uint32_t)size;
+	return data;
+}
+
+static int check_hashes(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	unsigned long long vi, rdram;
+	uint32_t i = 0, bad = 0;
+
+	if (!f)
+	{
+		fprintf(stderr, "cannot open %s\n", path);
+		return 0;
+	}
+
+	while (fscanf(f, "%llx %llx", &vi, &rdram) == 2)
+	{
+		if (i >= frame_index)
+		{
+			printf("frame %u: missing\n", i);
+			bad++;
+		}
+		else if (frame_hashes[i].rdram != rdram)
+		{
+			printf("frame %u: rdram %016llx, expected %016llx\n", i, (unsigned long long)frame_hashes[i].rdram, rdram);
+			bad++;
+		}
+		else if (frame_hashes[i].vi != vi)
+		{
+			printf("frame %u: vi output %016llx, expected %016llx\n", i, (unsigned long long)frame_hashes[i].vi, vi);
+			bad++;
+		}
+		i++;
+	}
+	fclose(f);
+
+	if (i < frame_index)
+	{
+		printf("%u frame(s) more than expected\n", frame_index - i);
+		bad++;
+	}
+
+	printf("%u of %u frame hash(es) match\n", i - (bad > i ? i : bad), i);
+	return bad == 0;
+}
+
+static void print_stats(uint32_t workers, uint32_t loops)
+{
+	uint64_t rdp_usec = 0;
+	uint32_t i;
+
+	for (i = 0; i < 64; i++)
+		rdp_usec += stats.usec[i];
+
+	printf("%u frame(s), %u worker(s)%s, %u loop(s)\n", stats.frames / loops, workers,
+			pipelined ? ", pipelined vi" : "", loops);
+	if (!stats.frames || !stats.total_usec)
+		return;
+
+	printf("%.3f ms/frame (rdp %.3f, vi %.3f)\n",
+			stats.total_usec / 1000.0 / stats.frames,
+			rdp_usec / 1000.0 / stats.frames,
+			stats.vi_usec / 1000.0 / stats.frames);
+	if (stats.vi_frames)
+		printf("vi filters %.3f ms/frame, %.3f ms from vi update to screen\n",
+				stats.vi_filter_usec / 1000.0 / stats.vi_frames,
+				stats.vi_latency_usec / 1000.0 / stats.vi_frames);
+	printf("pixels/frame: 1-cycle %llu, 2-cycle %llu, copy %llu, fill %llu\n",
+			(unsigned long long)(stats.pixels[0] / stats.frames),
+			(unsigned long long)(stats.pixels[1] / stats.frames),
+			(unsigned long long)(stats.pixels[2] / stats.frames),
+			(unsigned long long)(stats.pixels[3] / stats.frames));
+
+	/* with several workers most commands are only buffered and the work
+	 * is charged to whichever command flushes the buffer */
+	if (workers > 1)
+		return;
+
+	printf("\n%-20s %10s %12s %10s %6s\n", "command", "count", "total ms", "avg us", "%");
+	for (i = 0; i < 64; i++)
+	{
+		if (!stats.count[i])
+			continue;
+		printf("%-20s %10llu %12.3f %10.3f %6.2f\n",
+				cmd_names[i] ? cmd_names[i] : "invalid",
+				(unsigned long long)stats.count[i],
+				stats.usec[i] / 1000.0,
+				(double)stats.usec[i] / stats.count[i],
+				rdp_usec ? 100.0 * stats.usec[i] / rdp_usec : 0.0);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *out_path = NULL, *check_path = NULL, *dump_path = NULL;
+	uint32_t workers = 1, loops = 1, len = 0, i;
+	uint8_t *data;
+	int ok = 1;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-w") && i + 1 < (uint32_t)argc)
+			workers = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-p"))
+			pipelined = 1;
+		else if (!strcmp(argv[i], "-l") && i + 1 < (uint32_t)argc)
+			loops = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-o") && i + 1 < (uint32_t)argc)
+			out_path = argv[++i];
+		else if (!strcmp(argv[i], "-c") && i + 1 < (uint32_t)argc)
+			check_path = argv[++i];
+		else
+			dump_path = argv[i];
+	}
+
+	if (!dump_path)
+	{
+		fprintf(stderr, "usage: %s [-w workers] [-p] [-l loops] [-o hashes.txt] [-c hashes.txt] dump.rdp\n", argv[0]);
+		return 1;
+	}
+
+	if (!workers)
+		workers = 1;
+	if (workers > PARALLEL_MAX_WORKERS)
+		workers = PARALLEL_MAX_WORKERS;
+	if (!loops)
+		loops = 1;
+
+	data = load_file(dump_path, &len);
+	if (!data || len < 16 || memcmp(data, "RDPDUMP2", 8))
+	{
+		fprintf(stderr, "%s is not an RDP dump\n", dump_path);
+		return 1;
+	}
+
+	memcpy(&hw.rdram_size, data + 8, sizeof(hw.rdram_size));
+	memcpy(&hw.hidden_size, data + 12, sizeof(hw.hidden_size));
+	if (!hw.rdram_size || hw.rdram_size > RDRAM_MAX_SIZE || hw.hidden_size > sizeof(rdram_hidden))
+	{
+		fprintf(stderr, "%s: unsupported dram size\n", dump_path);
+		return 1;
+	}
+
+	hw.rdram = calloc(1, hw.rdram_size);
+	if (!hw.rdram)
+		return 1;
+
+	for (i = 0; i < loops; i++)
+		replay(data, len, workers, i == 0);
+
+	print_stats(workers, loops);
+
+	if (out_path)
+	{
+		FILE *f = fopen(out_path, "w");
+		if (f)
+		{
+			for (i = 0; i < frame_index; i++)
+				fprintf(f, "%016llx %016llx\n",
+						(unsigned long long)frame_hashes[i].vi,
+						(unsigned long long)frame_hashes[i].rdram);
+			fclose(f);
+		}
+	}
+
+	if (check_path)
+		ok = check_hashes(check_path);
+
+	free(hw.rdram);
+	free(frame_hashes);
+	free(data);
+	return ok ? 0 : 2;
+}
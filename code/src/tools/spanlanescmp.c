@@ -0,0 +1,387 @@
+/* spanlanescmp
+ * Checks the span lanes of angrylion (mupen64plus-video-angrylion/n64video/
+ * rdp/lanes.c) against the per pixel shade color, z and coverage code they
+ * replaced, kept below as it was. Every case walks a random span twice,
+ * once the way the 1-cycle renderers do and once the way the 2-cycle
+ * renderers do, shading each pixel one step ahead, and compares the shade
+ * color, z, coverage and coverage bit of every pixel.
+ * The interpolants, their steps and the derivatives are drawn from the
+ * whole int range and the coverage table is random, so overflowing spans
+ * and offsets the real table doesn't have are covered too.
+ *
+ * Usage: spanlanescmp [-n cases] [-s seed]
+ *     -n  number of random spans, 100000 by default
+ *     -s  seed of the case generator
+ *
+ * Exits with 1 and prints the first differing pixel of every walk that
+ * doesn't match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../mupen64plus-video-angrylion/common.h"
+
+#define MAX_LENGTH   1023
+
+/* the parts of the renderer state the lanes read and write */
+struct color
+{
+    int32_t r, g, b, a;
+};
+
+static struct
+{
+    int spans_cdr, spans_drdy;
+    int spans_cdg, spans_dgdy;
+    int spans_cdb, spans_dbdy;
+    int spans_cda, spans_dady;
+    int spans_cdz, spans_dzdy;
+    struct color shade_color;
+    uint8_t cvgbuf[1024];
+} state[1];
+
+static struct  {
+    uint8_t cvg;
+    uint8_t cvbit;
+    uint8_t xoff;
+    uint8_t yoff;
+} cvarray[0x100];
+
+static uint32_t special_9bit_clamptable[512];
+
+#include "../mupen64plus-video-angrylion/n64video/rdp/lanes.c"
+
+/* the per pixel code before lanes.c */
+
+static STRICTINLINE void lookup_cvmask_derivatives(uint8_t mask, uint8_t* offx, uint8_t* offy, uint32_t* curpixel_cvg, uint32_t* curpixel_cvbit)
+{
+    *curpixel_cvg = cvarray[mask].cvg;
+    *curpixel_cvbit = cvarray[mask].cvbit;
+    *offx = cvarray[mask].xoff;
+    *offy = cvarray[mask].yoff;
+}
+
+static STRICTINLINE void rgba_correct(uint32_t wid, int offx, int offy, int r, int g, int b, int a, uint32_t cvg)
+{
+    int summand_r, summand_b, summand_g, summand_a;
+
+
+
+    if (cvg == 8)
+    {
+        r >>= 2;
+        g >>= 2;
+        b >>= 2;
+        a >>= 2;
+    }
+    else
+    {
+        summand_r = offx * state[wid].spans_cdr + offy * state[wid].spans_drdy;
+        summand_g = offx * state[wid].spans_cdg + offy * state[wid].spans_dgdy;
+        summand_b = offx * state[wid].spans_cdb + offy * state[wid].spans_dbdy;
+        summand_a = offx * state[wid].spans_cda + offy * state[wid].spans_dady;
+
+        r = ((r << 2) + summand_r) >> 4;
+        g = ((g << 2) + summand_g) >> 4;
+        b = ((b << 2) + summand_b) >> 4;
+        a = ((a << 2) + summand_a) >> 4;
+    }
+
+
+    state[wid].shade_color.r = special_9bit_clamptable[r & 0x1ff];
+    state[wid].shade_color.g = special_9bit_clamptable[g & 0x1ff];
+    state[wid].shade_color.b = special_9bit_clamptable[b & 0x1ff];
+    state[wid].shade_color.a = special_9bit_clamptable[a & 0x1ff];
+}
+
+static STRICTINLINE void z_correct(uint32_t wid, int offx, int offy, int* z, uint32_t cvg)
+{
+    int summand_z;
+    int sz = *z;
+    int zanded;
+
+
+
+    if (cvg == 8)
+        sz = sz >> 3;
+    else
+    {
+        summand_z = offx * state[wid].spans_cdz + offy * state[wid].spans_dzdy;
+
+        sz = ((sz << 2) + summand_z) >> 5;
+    }
+
+
+
+    zanded = (sz & 0x60000) >> 17;
+
+
+    switch (zanded)
+    {
+        case 0: *z = sz & 0x3ffff;                      break;
+        case 1: *z = sz & 0x3ffff;                      break;
+        case 2: *z = 0x3ffff;                           break;
+        case 3: *z = 0;                                 break;
+    }
+}
+
+/* what a span walk leaves for the combiner, blender and z compare */
+struct pixel
+{
+    struct color shade;
+    int z;
+    uint32_t cvg, cvbit;
+};
+
+static struct pixel pix_old[MAX_LENGTH + 1];
+static struct pixel pix_new[MAX_LENGTH + 1];
+
+struct span
+{
+    int x, xinc, length;
+    int r, g, b, a, z;
+    int drinc, dginc, dbinc, dainc, dzinc;
+};
+
+static void old_walk(const struct span* sp)
+{
+    uint8_t offx, offy;
+    uint32_t curpixel_cvg, curpixel_cvbit;
+    int r = sp->r, g = sp->g, b = sp->b, a = sp->a, z = sp->z;
+    int sr, sg, sb, sa, sz;
+    int x = sp->x, j;
+
+    for (j = 0; j <= sp->length; j++)
+    {
+        sr = r >> 14;
+        sg = g >> 14;
+        sb = b >> 14;
+        sa = a >> 14;
+        sz = (z >> 10) & 0x3fffff;
+
+        lookup_cvmask_derivatives(state[0].cvgbuf[x], &offx, &offy, &curpixel_cvg, &curpixel_cvbit);
+
+        rgba_correct(0, offx, offy, sr, sg, sb, sa, curpixel_cvg);
+        z_correct(0, offx, offy, &sz, curpixel_cvg);
+
+        pix_old[j].shade = state[0].shade_color;
+        pix_old[j].z = sz;
+        pix_old[j].cvg = curpixel_cvg;
+        pix_old[j].cvbit = curpixel_cvbit;
+
+        x += sp->xinc;
+        r += sp->drinc;
+        g += sp->dginc;
+        b += sp->dbinc;
+        a += sp->dainc;
+        z += sp->dzinc;
+    }
+}
+
+/* as render_spans_1cycle_* */
+static void walk_1cycle(const struct span* sp)
+{
+    struct span_lanes lanes;
+    int r = sp->r, g = sp->g, b = sp->b, a = sp->a, z = sp->z;
+    int x = sp->x, j, k, sz;
+
+    for (j = 0; j <= sp->length; j++)
+    {
+        k = j & (SPAN_LANES - 1);
+        if (!k)
+            span_lanes_shade(0, &lanes, x, sp->xinc, sp->length - j + 1, r, g, b, a, z, sp->drinc, sp->dginc, sp->dbinc, sp->dainc, sp->dzinc);
+
+        pix_new[j].cvg = lanes.cvg[k];
+        pix_new[j].cvbit = lanes.cvbit[k];
+
+        span_lanes_load(0, &lanes, k, &sz);
+
+        pix_new[j].shade = state[0].shade_color;
+        pix_new[j].z = sz;
+
+        x += sp->xinc;
+        r += sp->drinc;
+        g += sp->dginc;
+        b += sp->dbinc;
+        a += sp->dainc;
+        z += sp->dzinc;
+    }
+}
+
+/* as render_spans_2cycle_*, which shade the next pixel at the end of the
+ * current one */
+static void walk_2cycle(const struct span* sp)
+{
+    struct span_lanes lanes;
+    int r = sp->r, g = sp->g, b = sp->b, a = sp->a, z = sp->z;
+    int x = sp->x, j, k;
+    uint32_t curpixel_cvg = 0, curpixel_cvbit = 0, nextpixel_cvg;
+
+    for (j = 0; j <= sp->length; j++)
+    {
+        if (!j)
+        {
+            span_lanes_shade(0, &lanes, x, sp->xinc, sp->length + 1, r, g, b, a, z, sp->drinc, sp->dginc, sp->dbinc, sp->dainc, sp->dzinc);
+
+            curpixel_cvg = lanes.cvg[0];
+            curpixel_cvbit = lanes.cvbit[0];
+
+            span_lanes_color(0, &lanes, 0);
+        }
+
+        pix_new[j].shade = state[0].shade_color;
+        pix_new[j].z = lanes.z[j & (SPAN_LANES - 1)];
+        pix_new[j].cvg = curpixel_cvg;
+        pix_new[j].cvbit = curpixel_cvbit;
+
+        x += sp->xinc;
+        r += sp->drinc;
+        g += sp->dginc;
+        b += sp->dbinc;
+        a += sp->dainc;
+
+        k = (j + 1) & (SPAN_LANES - 1);
+        if (j < sp->length)
+        {
+            if (!k)
+                span_lanes_shade(0, &lanes, x, sp->xinc, sp->length - j, r, g, b, a, z + sp->dzinc, sp->drinc, sp->dginc, sp->dbinc, sp->dainc, sp->dzinc);
+
+            nextpixel_cvg = lanes.cvg[k];
+            curpixel_cvbit = lanes.cvbit[k];
+
+            span_lanes_color(0, &lanes, k);
+        }
+        else
+            nextpixel_cvg = 0;
+
+        curpixel_cvg = nextpixel_cvg;
+
+        z += sp->dzinc;
+    }
+}
+
+static int compare(const char *walk, const struct span* sp, uint32_t *mismatches)
+{
+    int j;
+
+    for (j = 0; j <= sp->length; j++)
+        if (memcmp(&pix_old[j], &pix_new[j], sizeof(struct pixel)))
+            break;
+
+    if (j > sp->length)
+        return 0;
+
+    if (!(*mismatches)++)
+        printf("%s x %d, xinc %d, length %d differs at pixel %d: "
+                "shade %d %d %d %d z %x cvg %u/%u, was shade %d %d %d %d z %x cvg %u/%u\n",
+                walk, sp->x, sp->xinc, sp->length, j,
+                pix_new[j].shade.r, pix_new[j].shade.g, pix_new[j].shade.b, pix_new[j].shade.a,
+                pix_new[j].z, pix_new[j].cvg, pix_new[j].cvbit,
+                pix_old[j].shade.r, pix_old[j].shade.g, pix_old[j].shade.b, pix_old[j].shade.a,
+                pix_old[j].z, pix_old[j].cvg, pix_old[j].cvbit);
+    return 1;
+}
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+/* mostly the magnitudes of real spans, sometimes anything */
+static int interp(int shift)
+{
+	int v = (int)rng();
+
+	if (rng() & 3)
+		v >>= shift + rng() % 8;
+	return v;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t cases = 100000, seed = 1, i, m1 = 0, m2 = 0;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			cases = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			seed = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n cases] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rng_state = seed ? seed : 1;
+
+	for (i = 0; i < 0x100; i++)
+	{
+		cvarray[i].cvg = rng() % 9;
+		cvarray[i].cvbit = rng() & 1;
+		cvarray[i].xoff = rng();
+		cvarray[i].yoff = rng();
+	}
+	cvarray[0xff].cvg = 8;
+	for (i = 0; i < 512; i++)
+		special_9bit_clamptable[i] = rng();
+
+	for (i = 0; i < cases; i++)
+	{
+		struct span sp;
+		uint32_t j;
+
+		/* short spans are the common case, long ones cross many lane groups */
+		sp.length = rng() & 1 ? rng() % 24 : rng() % (MAX_LENGTH + 1);
+		sp.xinc = rng() & 1 ? 1 : -1;
+		sp.x = sp.xinc > 0 ? rng() % (1024 - sp.length) : sp.length + rng() % (1024 - sp.length);
+
+		sp.r = interp(0);
+		sp.g = interp(0);
+		sp.b = interp(0);
+		sp.a = interp(0);
+		sp.z = interp(0);
+		sp.drinc = interp(8);
+		sp.dginc = interp(8);
+		sp.dbinc = interp(8);
+		sp.dainc = interp(8);
+		sp.dzinc = interp(8);
+
+		state[0].spans_cdr = interp(8);
+		state[0].spans_drdy = interp(8);
+		state[0].spans_cdg = interp(8);
+		state[0].spans_dgdy = interp(8);
+		state[0].spans_cdb = interp(8);
+		state[0].spans_dbdy = interp(8);
+		state[0].spans_cda = interp(8);
+		state[0].spans_dady = interp(8);
+		state[0].spans_cdz = interp(8);
+		state[0].spans_dzdy = interp(8);
+
+		/* fully covered runs with partial pixels at the edges, or anything */
+		for (j = 0; j < 1024; j++)
+			state[0].cvgbuf[j] = rng() & 3 ? 0xff : rng();
+
+		old_walk(&sp);
+
+		walk_1cycle(&sp);
+		compare("1-cycle", &sp, &m1);
+
+		walk_2cycle(&sp);
+		compare("2-cycle", &sp, &m2);
+	}
+
+	printf("1-cycle %u spans, %u differ\n", cases, m1);
+	printf("2-cycle %u spans, %u differ\n", cases, m2);
+	return m1 || m2;
+}
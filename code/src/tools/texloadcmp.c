@@ -0,0 +1,558 @@
+/* texloadcmp
+ * Checks the TMEM row converters of Glide64 (glide2gl/src/Glide64/TexLoadRow.h)
+ * against the converters they replaced, kept below as they were. Every case
+ * runs both on the same random TMEM, palette and output buffer and compares
+ * the whole output buffer, line padding included, byte for byte.
+ *
+ * Usage: texloadcmp [-n cases] [-s seed]
+ *     -n  number of random cases per converter, 20000 by default
+ *     -s  seed of the case generator
+ *
+ * Exits with 1 and prints the first differing case of every converter that
+ * doesn't match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../mupen64plus-core/src/main/util.h"
+
+/* from Glide64's Util.h, which pulls in the whole plugin */
+static INLINE uint16_t ror16(uint16_t value, uint16_t amount)
+{
+    return (value << (-(int16_t)amount & 15)) | (value >> amount);
+}
+
+static INLINE uint32_t ror32(uint32_t value, uint32_t amount)
+{
+    return (value << (-(int32_t)amount & 31)) | (value >> amount);
+}
+
+#include "../glide2gl/src/Glide64/TexLoadRow.h"
+
+/* the converters before TexLoadRow.h */
+
+#define ALOWORD(x)   (*((uint16_t*)&x))   // low word
+
+static INLINE void old_load4bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, uint16_t line, int ext, uint16_t *palette)
+{
+    uint32_t *src32 =(uint32_t*)src;
+    uint32_t *dst32 =(uint32_t*)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            uint32_t v12 = m64p_swap32(src32[odd]);
+            uint32_t v16 = m64p_swap32(src32[!odd]);
+            uint32_t pix = width + 1;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 23) & 0x1E)), 1);
+            pix = pix << 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 27) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 15) & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 19) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 7) & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 11) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint8_t)v12 & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v12 >> 3) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 23) & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 27) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 15) & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 19) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 7) & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 11) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint8_t)v16 & 0x1E)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((v16 >> 3) & 0x1E)), 1);
+            *dst32++ = pix;
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
+        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
+
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_load4bIAPal(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    uint32_t *src32 =(uint32_t*)src;
+    uint32_t *dst32 =(uint32_t*)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+        while (width--)
+        {
+            uint32_t ab = m64p_swap32(src32[odd]);
+            uint32_t cd = m64p_swap32(src32[!odd]);
+            uint32_t pix = width + 1;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 23) & 0x1E)), 8);
+            pix = pix << 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 27) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 15) & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 19) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 7) & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 11) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + (2 *(uint8_t)ab & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((ab >> 3) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 23) & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 27) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 15) & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 19) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 7) & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 11) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + (2 *(uint8_t)cd & 0x1E)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((char *)palette + ((cd >> 3) & 0x1E)), 8);
+            *dst32++ = pix;
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
+        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
+
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_load4bIA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+   unsigned odd = 0;
+   uint32_t *src32 = (uint32_t*)src;
+   uint32_t *dst32 = (uint32_t*)dst;
+
+   while (height--)
+   {
+      int count = wid_64;
+      while (count--)
+      {
+         uint32_t v1, v2, v3, v4, v5, v6, v7, v8, v9, v10;
+
+#define do_load4biA \
+         v2 = v1;\
+         v3 = (8 * (v1 & 0x100000)) | (4 * (v1 & 0x100000)) | (2 * (v1 & 0x100000)) | (v1 & 0x100000) | ((((v1 >> 16) & 0xE00) >> 3) & 0x100) | ((v1 >> 16) & 0xE00) | (8 * ((v1 >> 12) & 0x1000)) | (4 * ((v1 >> 12) & 0x1000)) | (2 * ((v1 >> 12) & 0x1000)) | ((v1 >> 12) & 0x1000) | ((((v1 >> 28) & 0xE) >> 3)) | ((v1 >> 28) & 0xE) | (8 * ((v1 >> 24) & 0x10)) | (4 * ((v1 >> 24) & 0x10)) | (2 * ((v1 >> 24) & 0x10)) | ((v1 >> 24) & 0x10);\
+         v1 = (v1 >> 4) & 0xE0000u;\
+         v4 = v1 | v3;\
+         v1 >>= 3;\
+         *dst32++ = ((((v2 << 8) & 0xE000000) >> 3) & 0x1000000) | ((v2 << 8) & 0xE000000) | (8 * ((v2 << 12) & 0x10000000)) | (4 * ((v2 << 12) & 0x10000000)) | (2 * ((v2 << 12) & 0x10000000)) | ((v2 << 12) & 0x10000000) | (v1 & 0x10000) | v4;\
+         \
+         v5 = 16 * (uint16_t)v2 & 0x1000;\
+         v6 = (((v2 & 0xE00) >> 3) & 0x100) | (v2 & 0xE00) | (8 * v5) | (4 * v5) | (2 * v5) | (v5) | ((((v2 >> 12) & 0xE) >> 3)) | ((v2 >> 12) & 0xE) | (8 * ((v2 >> 8) & 0x10)) | (4 * ((v2 >> 8) & 0x10)) | (2 * ((v2 >> 8) & 0x10)) | ((v2 >> 8) & 0x10);\
+         v7 = v2 << 16;\
+         v8 = (8 * (v7 & 0x100000)) | (4 * (v7 & 0x100000)) | (2 * (v7 & 0x100000)) | (v7 & 0x100000) | v6;\
+         v9 = (v2 << 12) & 0xE0000u;\
+         v10 = v9 | v8;\
+         v9 >>= 3;\
+         *dst32++ = ((((v2 << 24) & 0xE000000) >> 3) & 0x1000000) | ((v2 << 24) & 0xE000000) | (8 * ((v2 << 28) & 0x10000000)) | (4 * ((v2 << 28) & 0x10000000)) | (2 * ((v2 << 28) & 0x10000000)) | ((v2 << 28) & 0x10000000) | (v9 & 0x10000) | v10
+
+         v1 = m64p_swap32(src32[odd]);
+         do_load4biA;
+
+         v1 = m64p_swap32(src32[!odd]);
+
+         do_load4biA;
+#undef do_load4biA
+
+         src32 += 2;
+      }
+
+      src32 = (uint32_t*)((char*)src32 + line);
+      dst32 = (uint32_t*)((char*)dst32 + ext);
+      odd ^= 1;
+   }
+}
+
+static INLINE void old_load4bI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uint32_t *src32 =(uint32_t*)src;
+    uint32_t *dst32 =(uint32_t*)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            uint32_t ab = m64p_swap32(src32[odd]);
+            uint32_t cd = m64p_swap32(src32[!odd]);
+            uint32_t pix;
+
+            pix = ab >> 4;
+            *dst32++ = (16 * ((ab << 8) & 0xF000000)) | ((ab << 8) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * ((ab >> 16) & 0xF00)) | ((ab >> 16) & 0xF00) | (16 * (ab >> 28)) | (ab >> 28);
+
+            pix = ab << 12;
+            *dst32++ = (16 * ((ab << 24) & 0xF000000)) | ((ab << 24) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * (ab & 0xF00)) | (ab & 0xF00) | (16 * ((uint16_t)ab >> 12)) | ((uint16_t)ab >> 12);
+
+            pix = cd >> 4;
+            *dst32++ = (16 * ((cd << 8) & 0xF000000)) | ((cd << 8) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * ((cd >> 16) & 0xF00)) | ((cd >> 16) & 0xF00) | (16 * (cd >> 28)) | (cd >> 28);
+
+            pix = cd << 12;
+            *dst32++ = (16 * ((cd << 24) & 0xF000000)) | ((cd << 24) & 0xF000000) | (16 * (pix & 0xF0000)) | (pix & 0xF0000) | (16 * (cd & 0xF00)) | (cd & 0xF00) | (16 * ((uint16_t)cd >> 12)) | ((uint16_t)cd >> 12);
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)((uint8_t*)src32 + line);
+        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_load8bCI(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    uint32_t *src32 =(uint32_t*)src;
+    uint32_t *dst32 =(uint32_t *)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            uint32_t abcd = m64p_swap32(src32[odd]);
+            uint32_t efgh = m64p_swap32(src32[!odd]);
+            uint32_t pix = width + 1;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 15) & 0x1FE)), 1);
+            pix = pix << 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 23) & 0x1FE)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint16_t)abcd & 0x1FE)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((abcd >> 7) & 0x1FE)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 15) & 0x1FE)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 23) & 0x1FE)), 1);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + (2 *(uint16_t)efgh & 0x1FE)), 1);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t*)((uint8_t*)palette + ((efgh >> 7) & 0x1FE)), 1);
+            *dst32++ = pix;
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0x7FF];
+        dst32 =(uint32_t*)((char *)dst32 + ext);
+
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_load8bIA8(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext, uint16_t *palette)
+{
+    uint32_t *src32 =(uint32_t *)src;
+    uint32_t *dst32 =(uint32_t *)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            uint32_t abcd = m64p_swap32(src32[odd]);
+            uint32_t efgh = m64p_swap32(src32[!odd]);
+            uint32_t pix  = width + 1;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 15) & 0x1FE)), 8);
+            pix = pix << 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 23) & 0x1FE)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + (2 *(uint16_t)abcd & 0x1FE)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((abcd >> 7) & 0x1FE)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 15) & 0x1FE)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 23) & 0x1FE)), 8);
+            *dst32++ = pix;
+
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + (2 *(uint16_t)efgh & 0x1FE)), 8);
+            pix <<= 16;
+            ALOWORD(pix) = ror16(*(uint16_t *)((uint8_t*)palette + ((efgh >> 7) & 0x1FE)), 8);
+            *dst32++ = pix;
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t *)((uint8_t*)src32 + line);
+        dst32 =(uint32_t *)((uint8_t*)dst32 + ext);
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_load16bRGBA(uint8_t *src, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+    uint32_t *src32 =(uint32_t*)src;
+    uint32_t *dst32 =(uint32_t*)dst;
+    unsigned odd = 0;
+
+    while (height--)
+    {
+        int width = wid_64;
+
+        while (width--)
+        {
+            uint32_t ab = m64p_swap32(src32[odd]);
+            uint32_t cd = m64p_swap32(src32[!odd]);
+
+            ALOWORD(ab) = ror16((uint16_t)ab, 1);
+            ALOWORD(cd) = ror16((uint16_t)cd, 1);
+            ab = ror32(ab, 16);
+            cd = ror32(cd, 16);
+            ALOWORD(ab) = ror16((uint16_t)ab, 1);
+            ALOWORD(cd) = ror16((uint16_t)cd, 1);
+
+            *dst32++ = ab;
+            *dst32++ = cd;
+
+            src32 += 2;
+        }
+
+        src32 =(uint32_t*)&src[(line +(uintptr_t)src32 -(uintptr_t)src) & 0xFFF];
+        dst32 =(uint32_t*)((uint8_t*)dst32 + ext);
+
+        odd ^= 1;
+    }
+}
+
+static INLINE void old_dxt_swap(uint32_t *line, int width)
+{
+   while (width--)
+   {
+      line[0] ^= line[1];
+      line[1] ^= line[0];
+      line[0] ^= line[1];
+      line += 2;
+   }
+}
+
+#define TMEM_BYTES   0x10000
+#define OUT_BYTES    0x20000
+#define MAX_WID_64   40
+#define MAX_HEIGHT   32
+#define MAX_LINE     64
+#define MAX_EXT      64
+
+enum
+{
+	CONV_4B_CI,
+	CONV_4B_IA_PAL,
+	CONV_4B_IA,
+	CONV_4B_I,
+	CONV_8B_CI,
+	CONV_8B_IA8,
+	CONV_16B_RGBA,
+	CONV_DXT_SWAP,
+	CONV_COUNT
+};
+
+static const char *conv_names[CONV_COUNT] = {
+	"load4bCI", "load4bIAPal", "load4bIA", "load4bI",
+	"load8bCI", "load8bIA8", "load16bRGBA", "dxt_swap"
+};
+
+static uint32_t tmem[TMEM_BYTES / 4];
+static uint16_t palette[256];
+static uint32_t out_old[OUT_BYTES / 4];
+static uint32_t out_new[OUT_BYTES / 4];
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+static void fill(uint32_t *buf, size_t words)
+{
+	size_t i;
+
+	for (i = 0; i < words; i++)
+		buf[i] = rng();
+}
+
+static void run(int conv, int old, uint8_t *dst, int wid_64, int height, int line, int ext)
+{
+	uint8_t *src = (uint8_t*)tmem;
+
+	switch (conv)
+	{
+		case CONV_4B_CI:
+			if (old)
+				old_load4bCI(src, dst, wid_64, height, line, ext, palette);
+			else
+				load4bCI(src, dst, wid_64, height, line, ext, palette);
+			break;
+		case CONV_4B_IA_PAL:
+			if (old)
+				old_load4bIAPal(src, dst, wid_64, height, line, ext, palette);
+			else
+				load4bIAPal(src, dst, wid_64, height, line, ext, palette);
+			break;
+		case CONV_4B_IA:
+			if (old)
+				old_load4bIA(src, dst, wid_64, height, line, ext);
+			else
+				load4bIA(src, dst, wid_64, height, line, ext);
+			break;
+		case CONV_4B_I:
+			if (old)
+				old_load4bI(src, dst, wid_64, height, line, ext);
+			else
+				load4bI(src, dst, wid_64, height, line, ext);
+			break;
+		case CONV_8B_CI:
+			if (old)
+				old_load8bCI(src, dst, wid_64, height, line, ext, palette);
+			else
+				load8bCI(src, dst, wid_64, height, line, ext, palette);
+			break;
+		case CONV_8B_IA8:
+			if (old)
+				old_load8bIA8(src, dst, wid_64, height, line, ext, palette);
+			else
+				load8bIA8(src, dst, wid_64, height, line, ext, palette);
+			break;
+		case CONV_16B_RGBA:
+			if (old)
+				old_load16bRGBA(src, dst, wid_64, height, line, ext);
+			else
+				load16bRGBA(src, dst, wid_64, height, line, ext);
+			break;
+		case CONV_DXT_SWAP:
+			/* swaps the words of wid_64 texel pairs in place */
+			memcpy(dst, tmem, wid_64 * 8);
+			if (old)
+				old_dxt_swap((uint32_t*)dst, wid_64);
+			else
+				dxt_swap((uint32_t*)dst, wid_64);
+			break;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t cases = 20000, seed = 1, i;
+	int conv, failed = 0;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			cases = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			seed = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n cases] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rng_state = seed ? seed : 1;
+
+	for (conv = 0; conv < CONV_COUNT; conv++)
+	{
+		uint32_t mismatches = 0;
+
+		for (i = 0; i < cases; i++)
+		{
+			int wid_64 = 1 + rng() % MAX_WID_64;
+			int height = 1 + rng() % MAX_HEIGHT;
+			int line   = (rng() % (MAX_LINE / 8 + 1)) * 8;
+			int ext    = (rng() % (MAX_EXT / 4 + 1)) * 4;
+			size_t j;
+
+			fill(tmem, TMEM_BYTES / 4);
+			fill((uint32_t*)palette, sizeof(palette) / 4);
+			fill(out_old, OUT_BYTES / 4);
+			memcpy(out_new, out_old, OUT_BYTES);
+
+			run(conv, 1, (uint8_t*)out_old, wid_64, height, line, ext);
+			run(conv, 0, (uint8_t*)out_new, wid_64, height, line, ext);
+
+			if (!memcmp(out_old, out_new, OUT_BYTES))
+				continue;
+
+			if (!mismatches++)
+			{
+				for (j = 0; j < OUT_BYTES && ((uint8_t*)out_old)[j] == ((uint8_t*)out_new)[j]; j++)
+					;
+				printf("%s: wid_64 %d, height %d, line %d, ext %d differs at byte %u: %02x, was %02x\n",
+						conv_names[conv], wid_64, height, line, ext, (unsigned)j,
+						((uint8_t*)out_new)[j], ((uint8_t*)out_old)[j]);
+			}
+		}
+
+		printf("%-12s %u cases, %u differ\n", conv_names[conv], cases, mismatches);
+		if (mismatches)
+			failed = 1;
+	}
+
+	return failed;
+}
@@ -0,0 +1,178 @@
+/* vifiltercmp
+ * Checks the VI filters of angrylion that work on r, g and b lanes
+ * (mupen64plus-video-angrylion/n64video/vi/lerp.c and divot.c) against the
+ * per channel versions they replaced, kept below as they were.
+ *
+ * The lerp is run for every pair of 8-bit values and every fraction, the
+ * divot filter for every triple of 8-bit values. Each value goes through
+ * a different lane in each channel, so every lane sees every case. Then
+ * random pixels, coverage included, are run through both.
+ *
+ * Usage: vifiltercmp [-n cases] [-s seed]
+ *     -n  number of random cases per filter, 1000000 by default
+ *     -s  seed of the case generator
+ *
+ * Exits with 1 and prints the first differing case of every filter that
+ * doesn't match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../mupen64plus-video-angrylion/common.h"
+
+/* from vdac.h, which pulls in the whole renderer interface */
+struct rgba
+{
+    uint8_t b;
+    uint8_t g;
+    uint8_t r;
+    uint8_t a;
+};
+
+#include "../mupen64plus-video-angrylion/n64video/vi/lerp.c"
+#include "../mupen64plus-video-angrylion/n64video/vi/divot.c"
+
+/* the filters before lerp.c and divot.c worked on lanes */
+
+static STRICTINLINE void old_vi_vl_lerp(struct rgba* up, struct rgba down, uint32_t frac)
+{
+    uint32_t r0, g0, b0;
+    if (!frac)
+        return;
+
+    r0 = up->r;
+    g0 = up->g;
+    b0 = up->b;
+
+    up->r = ((((down.r - r0) * frac + 16) >> 5) + r0) & 0xff;
+    up->g = ((((down.g - g0) * frac + 16) >> 5) + g0) & 0xff;
+    up->b = ((((down.b - b0) * frac + 16) >> 5) + b0) & 0xff;
+}
+
+static STRICTINLINE void old_divot_filter(struct rgba* final, struct rgba center, struct rgba left, struct rgba right)
+{
+    *final = center;
+
+    if ((center.a & left.a & right.a) == 7)
+    {
+        return;
+    }
+
+    if ((left.r >= center.r && right.r >= left.r) || (left.r >= right.r && center.r >= left.r))
+        final->r = left.r;
+    else if ((right.r >= center.r && left.r >= right.r) || (right.r >= left.r && center.r >= right.r))
+        final->r = right.r;
+
+    if ((left.g >= center.g && right.g >= left.g) || (left.g >= right.g && center.g >= left.g))
+        final->g = left.g;
+    else if ((right.g >= center.g && left.g >= right.g) || (right.g >= left.g && center.g >= right.g))
+        final->g = right.g;
+
+    if ((left.b >= center.b && right.b >= left.b) || (left.b >= right.b && center.b >= left.b))
+        final->b = left.b;
+    else if ((right.b >= center.b && left.b >= right.b) || (right.b >= left.b && center.b >= right.b))
+        final->b = right.b;
+}
+
+static struct rgba pixel(uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+{
+    struct rgba p;
+
+    p.r = r;
+    p.g = g;
+    p.b = b;
+    p.a = a;
+    return p;
+}
+
+static uint32_t lerp_mismatches, divot_mismatches;
+
+static void check_lerp(struct rgba up, struct rgba down, uint32_t frac)
+{
+    struct rgba o = up, n = up;
+
+    old_vi_vl_lerp(&o, down, frac);
+    vi_vl_lerp(&n, down, frac);
+
+    if (!memcmp(&o, &n, sizeof(o)))
+        return;
+
+    if (!lerp_mismatches++)
+        printf("lerp up %02x %02x %02x, down %02x %02x %02x, frac %u gives %02x %02x %02x, was %02x %02x %02x\n",
+                up.r, up.g, up.b, down.r, down.g, down.b, frac, n.r, n.g, n.b, o.r, o.g, o.b);
+}
+
+static void check_divot(struct rgba center, struct rgba left, struct rgba right)
+{
+    struct rgba o, n;
+
+    old_divot_filter(&o, center, left, right);
+    divot_filter(&n, center, left, right);
+
+    if (!memcmp(&o, &n, sizeof(o)))
+        return;
+
+    if (!divot_mismatches++)
+        printf("divot center %02x %02x %02x %u, left %02x %02x %02x %u, right %02x %02x %02x %u"
+                " gives %02x %02x %02x, was %02x %02x %02x\n",
+                center.r, center.g, center.b, center.a, left.r, left.g, left.b, left.a,
+                right.r, right.g, right.b, right.a, n.r, n.g, n.b, o.r, o.g, o.b);
+}
+
+static uint32_t rng_state;
+
+static uint32_t rng(void)
+{
+	/* xorshift32 */
+	rng_state ^= rng_state << 13;
+	rng_state ^= rng_state >> 17;
+	rng_state ^= rng_state << 5;
+	return rng_state;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t cases = 1000000, seed = 1, i, u, d, c, frac;
+
+	for (i = 1; i < (uint32_t)argc; i++)
+	{
+		if (!strcmp(argv[i], "-n") && i + 1 < (uint32_t)argc)
+			cases = strtoul(argv[++i], NULL, 0);
+		else if (!strcmp(argv[i], "-s") && i + 1 < (uint32_t)argc)
+			seed = strtoul(argv[++i], NULL, 0);
+		else
+		{
+			fprintf(stderr, "usage: %s [-n cases] [-s seed]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rng_state = seed ? seed : 1;
+
+	for (u = 0; u < 0x100; u++)
+		for (d = 0; d < 0x100; d++)
+			for (frac = 0; frac < 32; frac++)
+				check_lerp(pixel(u, d, u ^ d, 0), pixel(d, u, ~u & 0xff, 0), frac);
+
+	/* coverage 0 everywhere, so the filter always runs */
+	for (u = 0; u < 0x100; u++)
+		for (d = 0; d < 0x100; d++)
+			for (c = 0; c < 0x100; c++)
+				check_divot(pixel(u, d, c, 0), pixel(d, c, u, 0), pixel(c, u, d, 0));
+
+	for (i = 0; i < cases; i++)
+	{
+		uint32_t a = rng(), b = rng(), e = rng();
+
+		check_lerp(pixel(a, a >> 8, a >> 16, a >> 24), pixel(b, b >> 8, b >> 16, b >> 24), e & 31);
+		check_divot(pixel(a, a >> 8, a >> 16, (a >> 24) & 7), pixel(b, b >> 8, b >> 16, (b >> 24) & 7),
+				pixel(e, e >> 8, e >> 16, rng() & 3 ? 7 : (e >> 24) & 7));
+	}
+
+	printf("lerp %u cases, %u differ\n", 0x100 * 0x100 * 32 + cases, lerp_mismatches);
+	printf("divot %u cases, %u differ\n", 0x1000000 + cases, divot_mismatches);
+	return lerp_mismatches || divot_mismatches;
+}
@@ -52,7 +52,15 @@ class MyClass {
             settings: {
                 CLOUDSAVEURL: "",
                 SHOWADVANCED: false,
-                SHOWFPS: true
+                SHOWFPS: true,
+                SOFTWARERENDERER: false,
+                RUNAHEAD: 0,
+                FASTFORWARDSPEED: 4,
+                FRAMESKIP: false,
+                TEXTURECACHE: false,
+                DLISTREPLAY: 0,
+                VIPIPELINE: false,
+                VIPACING: true
             }
         };
 
@@ -165,6 +173,8 @@ class MyClass {
             FS.writeFile('custom.v64',byteArray);
             this.beforeRun();
             this.WriteConfigFile();
+            if (this.rivetsData.settings.TEXTURECACHE)
+                await this.loadTextureCache();
             $('#canvasDiv').show();
             Module.callMain(['custom.v64']);
             this.findInDatabase();
@@ -195,14 +205,47 @@ class MyClass {
         this.audioThreadLock = false;
 
 
-        //emulator is synced to the OnAudioProcess event because it's way
-        //more accurate than emscripten_set_main_loop or RAF
-        //and the old method was having constant emulator slowdown swings
-        //so the audio suffered as a result
         this.pcmPlayer = this.audioContext.createScriptProcessor(AUDIOBUFFSIZE, 2, 2);
         this.pcmPlayer.onaudioprocess = this.AudioProcessRecurring.bind(this);
         this.pcmPlayer.connect(this.gainNode);
 
+        //frames are run from requestAnimationFrame, as many as are due on
+        //the game's VI rate, so they line up with the display's refreshes.
+        //Without VIPACING (or with a build that doesn't export
+        //neil_frames_due) the emulator is synced to the OnAudioProcess
+        //event like before, which keeps audio steady but presents frames
+        //whenever an audio buffer runs out
+        this.viPacing = this.rivetsData.settings.VIPACING !== false && typeof Module._neil_frames_due === 'function';
+        if (this.viPacing) {
+            this.animationFrameCallback = this.AnimationFrameRecurring.bind(this);
+            requestAnimationFrame(this.animationFrameCallback);
+        }
+
+    }
+
+    //samples the emulator has written that the audio output hasn't played yet
+    queuedAudioSamples(){
+        let writePosition = Module._neilGetAudioWritePosition();
+        return ((writePosition - this.audioReadPosition + 64000) % 64000) / 2;
+    }
+
+    AnimationFrameRecurring(timestamp){
+
+        let frames = Module._neil_frames_due(timestamp);
+
+        //the display and the audio output don't run on exactly the VI
+        //rate, drop a frame when audio piles up and add one before it
+        //runs dry
+        let queued = this.queuedAudioSamples();
+        if (queued > AUDIOBUFFSIZE * 4 && frames > 0)
+            frames--;
+        else if (queued < AUDIOBUFFSIZE / 2 && frames == 0)
+            frames = 1;
+
+        for (let i = 0; i < frames; i++)
+            Module._runMainLoop();
+
+        requestAnimationFrame(this.animationFrameCallback);
     }
 
     hasEnoughSamples(){
@@ -247,14 +290,17 @@ class MyClass {
         let outputData1 = outputBuffer.getChannelData(0);
         let outputData2 = outputBuffer.getChannelData(1);
 
-        Module._runMainLoop();
+        if (!this.viPacing)
+        {
+            Module._runMainLoop();
 
-        this.audioWritePosition = Module._neilGetAudioWritePosition();
+            this.audioWritePosition = Module._neilGetAudioWritePosition();
 
 
-        if (!this.hasEnoughSamples())
-        {
-            Module._runMainLoop();
+            if (!this.hasEnoughSamples())
+            {
+                Module._runMainLoop();
+            }
         }
 
         this.audioWritePosition = Module._neilGetAudioWritePosition();
@@ -355,6 +401,27 @@ class MyClass {
 
         //swap sticks
         if (this.rivetsData.swapSticks) configString += "1" + "\r\n"; else configString += "0" + "\r\n";
+
+        //software renderer
+        if (this.rivetsData.settings.SOFTWARERENDERER) configString += "1" + "\r\n"; else configString += "0" + "\r\n";
+
+        //run-ahead frames
+        configString += (this.rivetsData.settings.RUNAHEAD || 0) + "\r\n";
+
+        //fast-forward speed
+        configString += (this.rivetsData.settings.FASTFORWARDSPEED || 4) + "\r\n";
+
+        //adaptive frameskip
+        if (this.rivetsData.settings.FRAMESKIP) configString += "1" + "\r\n"; else configString += "0" + "\r\n";
+
+        //texture disk cache
+        if (this.rivetsData.settings.TEXTURECACHE) configString += "1" + "\r\n"; else configString += "0" + "\r\n";
+
+        //display list replay
+        configString += (this.rivetsData.settings.DLISTREPLAY || 0) + "\r\n";
+
+        //pipelined software renderer VI
+        if (this.rivetsData.settings.VIPIPELINE) configString += "1" + "\r\n"; else configString += "0" + "\r\n";
          
         FS.writeFile('config.txt',configString);
     }
@@ -757,6 +824,104 @@ class MyClass {
         };
 
     }
+
+    //converted textures from earlier sessions of this rom, the
+    //emulator reads texcache.bin when it first loads a texture.
+    //the file is stored as chunks, ".texcache" from the start of the
+    //file and ".texcache.1", ".texcache.2"... with what got appended
+    loadTextureCache() {
+
+        myClass.texcache_chunks = 0;
+        return new Promise(function (resolve) {
+            if (window["indexedDB"]==undefined){
+                resolve();
+                return;
+            }
+
+            var request = indexedDB.open('N64WASMDB');
+            request.onsuccess = function (ev) {
+                var db = ev.target.result;
+                var file = new Uint8Array(0);
+                var readChunk = function (romStore) {
+                    var cache = romStore.get(myClass.texCacheChunkName(myClass.texcache_chunks));
+                    cache.onsuccess = function (event) {
+                        if (!cache.result) {
+                            if (file.length)
+                                FS.writeFile('texcache.bin', file);
+                            resolve();
+                            return;
+                        }
+                        //chunks from before they had offsets hold the whole file
+                        var offset = cache.result.data ? cache.result.offset : 0;
+                        var data = cache.result.data ? cache.result.data : cache.result;
+                        var joined = new Uint8Array(offset + data.length);
+                        joined.set(file.subarray(0, offset));
+                        joined.set(data, offset);
+                        file = joined;
+                        myClass.texcache_chunks++;
+                        readChunk(romStore);
+                    };
+                    cache.onerror = function (event) {
+                        resolve();
+                    };
+                };
+                try {
+                    readChunk(db.transaction("N64WASMSTATES", "readonly").objectStore("N64WASMSTATES"));
+                } catch (error) {
+                    console.log(error);
+                    resolve();
+                }
+            }
+            request.onerror = function (ev) {
+                resolve();
+            }
+        });
+    }
+
+    texCacheChunkName(index) {
+        if (index == 0)
+            return myClass.rom_name + '.texcache';
+        return myClass.rom_name + '.texcache.' + index;
+    }
+
+    //when the emulator has appended textures to texcache.bin,
+    //start and end are the file offsets of what is new since the last call
+    TexCacheEvent(start, end) {
+
+        if (window["indexedDB"]==undefined)
+            return;
+
+        //a file written from the start, or too many chunks, replaces them all
+        var chunks = myClass.texcache_chunks;
+        if (start == 0 || chunks >= 32)
+            start = 0;
+
+        var stream = FS.open('texcache.bin', 'r');
+        var data = new Uint8Array(end - start);
+        FS.read(stream, data, 0, data.length, start);
+        FS.close(stream);
+
+        var index = start == 0 ? 0 : chunks;
+        myClass.texcache_chunks = index + 1;
+
+        var request = indexedDB.open('N64WASMDB');
+        request.onsuccess = function (ev) {
+            var db = ev.target.result;
+            var romStore = db.transaction("N64WASMSTATES", "readwrite").objectStore("N64WASMSTATES");
+            var addRequest = romStore.put({ offset: start, data: data }, myClass.texCacheChunkName(index));
+            addRequest.onsuccess = function (event) {
+                console.log('texture cache saved: ', data.length, ' bytes at ', start);
+            };
+            addRequest.onerror = function (event) {
+                console.log('error saving texture cache');
+                console.log(event);
+            };
+            if (index == 0) {
+                for (var i = 1; i < chunks; i++)
+                    romStore.delete(myClass.texCacheChunkName(i));
+            }
+        }
+    }
     
 
     exportEep(){
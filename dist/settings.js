@@ -1,5 +1,13 @@
 var N64WASMSETTINGS = {
     CLOUDSAVEURL: "",
     SHOWADVANCED: false, //set this to true to enable importing of save files (eep, sra, fla)
-    SHOWFPS: true
+    SHOWFPS: true,
+    SOFTWARERENDERER: false, //set this to true to use the angrylion software renderer instead of WebGL
+    RUNAHEAD: 0, //frames to run ahead to cut input lag (0 to 4), each one costs a full extra frame of emulation
+    FASTFORWARDSPEED: 4, //frames emulated per frame shown while Fast Forward is on in the menu (2 to 8)
+    FRAMESKIP: false, //set this to true to stop drawing some frames when the device can't keep up, turns off RUNAHEAD
+    TEXTURECACHE: false, //set this to true to keep converted textures in the browser so scenes load faster next time
+    DLISTREPLAY: 0, //1 to redraw unchanged static geometry from a cache instead of rebuilding it, 2 to only check the cache against real rendering
+    VIPIPELINE: false, //set this to true to run the software renderer's video filters on their own thread, shows frames one frame later and needs a threaded build
+    VIPACING: true //paces frames on the game's video rate and the display's refresh rate, set this to false to let the audio output drive the emulator instead
 }
\ No newline at end of file